@@ -0,0 +1,179 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Accuracy profiles: the high-level functions, routed to the cheapest models that meet a target accuracy,
+ implemented in C99.
+
+ iauApco13, iauApci13 and iauAtco13 always use the full IAU 2006/2000A precession-nutation and the iauEpv00
+ ephemeris, and iauGst06a the full nutation too: a few hundred microseconds, whatever the accuracy needed.
+ A terse_alternate_iauACCURACY context, from terse_alternate_iauAccuracyInit, selects the cheapest of these profiles that meets a target:
+
+   IAU_ACCURACY_FULL    the SOFA functions themselves.
+   IAU_ACCURACY_MAS     IAU 2006 precession with IAU 2000B nutation (iauPfw06, iauNut00b); iauEpv00.
+   IAU_ACCURACY_ARCSEC  IAU 2006 precession with the 10 largest terms of the nutation; s = -XY/2 and s' = 0;
+                        the Earth from iauPlan94 (the Earth-Moon barycenter, heliocentric for barycentric).
+   IAU_ACCURACY_ARCMIN  IAU 2006 precession alone, without nutation; otherwise as IAU_ACCURACY_ARCSEC.
+
+ The published table, terse_alternate_iauAccuracyProfiles, gives each profile's largest error against the full models from
+ 1995 to 2050 (the span in which IAU 2000B meets 1 mas): on the sky, and in sidereal time (as an angle).
+ They differ: an error in the nutation in longitude moves the equinox along the equator by dpsi cos(eps),
+ but the sky only by dpsi sin(eps). So places on the sky and sidereal time each route to their own cheapest
+ profile. The equation of the origins (eo) has the error of sidereal time. The table also gives the times,
+ relative to the full models; the tests check the errors, and the benchmarks measure the times.
+ Outside 1995-2050 the truncated models degrade slowly.
+*/
+
+/* The published table: the errors are the largest found by the tests, rounded up; the times, from the benchmarks. */
+const terse_alternate_iauACCURACYPROFILE terse_alternate_iauAccuracyProfiles[IAU_ACCURACY_PROFILES] = {
+   {"full",     0.0,           0.0,           1.00,  1.00,
+    "IAU 2006/2000A precession-nutation, iauEpv00"},
+   {"1 mas",    1.0 * DMAS2R,  2.5 * DMAS2R,  0.40,  0.09,
+    "IAU 2006 precession, IAU 2000B nutation, iauEpv00"},
+   {"1 arcsec", 0.1 * DAS2R,   0.1 * DAS2R,   0.020, 0.010,
+    "IAU 2006 precession, 10-term nutation, iauPlan94"},
+   {"1 arcmin", 20.0 * DAS2R,  20.0 * DAS2R,  0.015, 0.004,
+    "IAU 2006 precession, no nutation, iauPlan94"}
+};
+
+/*
+ Select the cheapest profiles whose published errors are within target (radians): one for places on the
+ sky, one for sidereal time. IAU_ACCURACY_FULL for targets below the errors of every other profile.
+*/
+void terse_alternate_iauAccuracyInit(double target, terse_alternate_iauACCURACY *acc) {
+   acc->target = target;
+   acc->profile = IAU_ACCURACY_FULL;
+   acc->gst_profile = IAU_ACCURACY_FULL;
+   for (int p = IAU_ACCURACY_PROFILES - 1; p > IAU_ACCURACY_FULL; --p) {
+      if (acc->profile == IAU_ACCURACY_FULL && terse_alternate_iauAccuracyProfiles[p].sky_error <= target) acc->profile = p;
+      if (acc->gst_profile == IAU_ACCURACY_FULL && terse_alternate_iauAccuracyProfiles[p].gst_error <= target) acc->gst_profile = p;
+   }
+}
+
+/*
+ The 10 largest terms of the luni-solar nutation, from iauNut00b (the same arguments and units): Delaunay
+ multipliers, then longitude sin, t*sin, cos and obliquity cos, t*cos, sin, in 0.1 microarcsec.
+ The largest omitted term is 0.016"; all of them together, with the planetary terms, stay under 0.15".
+*/
+static const struct {
+   int nl, nlp, nf, nd, nom;
+   double ps, pst, pc;
+   double ec, ect, es;
+} NUTATION_TERMS[] = {
+   { 0, 0, 0, 0,1, -172064161.0, -174666.0, 33386.0, 92052331.0, 9086.0, 15377.0},
+   { 0, 0, 2,-2,2,  -13170906.0,   -1675.0,-13696.0,  5730336.0,-3015.0, -4587.0},
+   { 0, 0, 2, 0,2,   -2276413.0,    -234.0,  2796.0,   978459.0, -485.0,  1374.0},
+   { 0, 0, 0, 0,2,    2074554.0,     207.0,  -698.0,  -897492.0,  470.0,  -291.0},
+   { 0, 1, 0, 0,0,    1475877.0,   -3633.0, 11817.0,    73871.0, -184.0, -1924.0},
+   { 0, 1, 2,-2,2,    -516821.0,    1226.0,  -524.0,   224386.0, -677.0,  -174.0},
+   { 1, 0, 0, 0,0,     711159.0,      73.0,  -872.0,    -6750.0,    0.0,   358.0},
+   { 0, 0, 2, 0,1,    -387298.0,    -367.0,   380.0,   200728.0,   18.0,   318.0},
+   { 1, 0, 2, 0,2,    -301461.0,     -36.0,   816.0,   129025.0,  -63.0,   367.0},
+   { 0,-1, 2,-2,2,     215829.0,    -494.0,   111.0,   -95929.0,  299.0,   132.0}
+};
+
+/* The truncated nutation, in the manner of iauNut00b. */
+static void nutation_truncated(double date1, double date2, double *dpsi, double *deps) {
+   double t = ((date1 - DJ00) + date2) / DJC;
+   double el = fmod(485868.249036 + 1717915923.2178 * t, TURNAS) * DAS2R;
+   double elp = fmod(1287104.79305 + 129596581.0481 * t, TURNAS) * DAS2R;
+   double f = fmod(335779.526232 + 1739527262.8478 * t, TURNAS) * DAS2R;
+   double d = fmod(1072260.70369 + 1602961601.2090 * t, TURNAS) * DAS2R;
+   double om = fmod(450160.398036 - 6962890.5431 * t, TURNAS) * DAS2R;
+   double dp = 0.0, de = 0.0;
+   for (int i = (int)(sizeof NUTATION_TERMS / sizeof NUTATION_TERMS[0]) - 1; i >= 0; --i) {
+      double arg = NUTATION_TERMS[i].nl * el + NUTATION_TERMS[i].nlp * elp + NUTATION_TERMS[i].nf * f
+          + NUTATION_TERMS[i].nd * d + NUTATION_TERMS[i].nom * om;
+      double sarg = sin(arg), carg = cos(arg);
+      dp += (NUTATION_TERMS[i].ps + NUTATION_TERMS[i].pst * t) * sarg + NUTATION_TERMS[i].pc * carg;
+      de += (NUTATION_TERMS[i].ec + NUTATION_TERMS[i].ect * t) * carg + NUTATION_TERMS[i].es * sarg;
+   }
+   *dpsi = dp * (DAS2R / 1e7);
+   *deps = de * (DAS2R / 1e7);
+}
+
+/* The BPN matrix, CIP X,Y and the CIO locator s of a profile (not IAU_ACCURACY_FULL), at the TT date1+date2. */
+static void precession_nutation(int profile, double date1, double date2, double r[3][3],
+    double *x, double *y, double *s) {
+   double gamb, phib, psib, epsa, dp = 0.0, de = 0.0;
+   iauPfw06(date1, date2, &gamb, &phib, &psib, &epsa);
+   if (profile == IAU_ACCURACY_MAS) iauNut00b(date1, date2, &dp, &de);
+   else if (profile == IAU_ACCURACY_ARCSEC) nutation_truncated(date1, date2, &dp, &de);
+   iauFw2m(gamb, phib, psib + dp, epsa + de, r);
+   iauBpn2xy(r, x, y);
+   //s + XY/2 is a few mas at most, from 1995 to 2050
+   *s = (profile == IAU_ACCURACY_MAS) ? iauS06(date1, date2, *x, *y) : -0.5 * *x * *y;
+}
+
+/* The Earth's heliocentric and barycentric position and velocity (au, au/d) for a profile, at the TT date1+date2. */
+static void earth(int profile, double date1, double date2, double ehpv[2][3], double ebpv[2][3]) {
+   if (profile == IAU_ACCURACY_MAS) {
+      (void)iauEpv00(date1, date2, ehpv, ebpv);
+   } else {
+      //the Earth-Moon barycenter, with the Sun for the solar-system barycenter: under 0.02" of aberration
+      (void)iauPlan94(date1, date2, 3, ehpv);
+      iauCpv(ehpv, ebpv);
+   }
+}
+
+/* iauApco13, using the models of the profile selected by acc. */
+int terse_alternate_iauApco13p(const terse_alternate_iauACCURACY *acc, double utc1, double utc2, double dut1,
+    double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl, iauASTROM *astrom, double *eo) {
+   if (acc->profile == IAU_ACCURACY_FULL) {
+      return iauApco13(utc1, utc2, dut1, elong, phi, hm, xp, yp, phpa, tc, rh, wl, astrom, eo);
+   }
+   double tai1, tai2, tt1, tt2, ut11, ut12, ehpv[2][3], ebpv[2][3], r[3][3], x, y, s, refa, refb;
+   int j = iauUtctai(utc1, utc2, &tai1, &tai2);
+   if (j < 0) return -1;
+   j = iauTaitt(tai1, tai2, &tt1, &tt2);
+   j = iauUtcut1(utc1, utc2, dut1, &ut11, &ut12);
+   if (j < 0) return -1;
+   earth(acc->profile, tt1, tt2, ehpv, ebpv);
+   precession_nutation(acc->profile, tt1, tt2, r, &x, &y, &s);
+   double sp = (acc->profile == IAU_ACCURACY_MAS) ? iauSp00(tt1, tt2) : 0.0;
+   iauRefco(phpa, tc, rh, wl, &refa, &refb);
+   iauApco(tt1, tt2, ebpv, ehpv[0], x, y, s, iauEra00(ut11, ut12), elong, phi, hm, xp, yp, sp, refa, refb, astrom);
+   *eo = iauEors(r, s);
+   return j;
+}
+
+/* iauApci13, using the models of the profile selected by acc. */
+void terse_alternate_iauApci13p(const terse_alternate_iauACCURACY *acc, double date1, double date2, iauASTROM *astrom, double *eo) {
+   if (acc->profile == IAU_ACCURACY_FULL) {
+      iauApci13(date1, date2, astrom, eo);
+      return;
+   }
+   double ehpv[2][3], ebpv[2][3], r[3][3], x, y, s;
+   earth(acc->profile, date1, date2, ehpv, ebpv);
+   precession_nutation(acc->profile, date1, date2, r, &x, &y, &s);
+   iauApci(date1, date2, ebpv, ehpv[0], x, y, s, astrom);
+   *eo = iauEors(r, s);
+}
+
+/* iauAtco13, using the models of the profile selected by acc. */
+int terse_alternate_iauAtco13p(const terse_alternate_iauACCURACY *acc, double rc, double dc, double pr, double pd, double px, double rv,
+    double utc1, double utc2, double dut1, double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl,
+    double *aob, double *zob, double *hob, double *dob, double *rob, double *eo) {
+   iauASTROM astrom;
+   double ri, di;
+   int j = terse_alternate_iauApco13p(acc, utc1, utc2, dut1, elong, phi, hm, xp, yp, phpa, tc, rh, wl, &astrom, eo);
+   if (j < 0) return j;
+   iauAtciq(rc, dc, pr, pd, px, rv, &astrom, &ri, &di);
+   iauAtioq(ri, di, &astrom, aob, zob, hob, dob, rob);
+   return j;
+}
+
+/*
+ Greenwich apparent sidereal time (radians), as iauGst06a, using the models of the sidereal-time profile
+ selected by acc.
+ Given uta+utb (UT1) and tta+ttb (TT), as for iauGst06a.
+*/
+double terse_alternate_iauGstp(const terse_alternate_iauACCURACY *acc, double uta, double utb, double tta, double ttb) {
+   if (acc->gst_profile == IAU_ACCURACY_FULL) return iauGst06a(uta, utb, tta, ttb);
+   double r[3][3], x, y, s;
+   precession_nutation(acc->gst_profile, tta, ttb, r, &x, &y, &s);
+   return iauAnp(iauEra00(uta, utb) - iauEors(r, s));
+}
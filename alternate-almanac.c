@@ -0,0 +1,370 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ A precomputed, memory-mapped astrometry almanac, implemented in C99.
+
+ Every process that calls iauApci13 or iauApco13 recomputes the same expensive per-epoch quantities.
+ Instead, a tool computes them once, on a fixed grid of TT, into a binary file.
+ Readers map the file into memory, and build the iauASTROM context by interpolating between grid nodes.
+ Processes start instantly, and all of them on one host share the same physical pages.
+
+ Create an almanac with:
+   ./run_tests.exe almanac <file> <first TT as JD> <number of days> [<step in days> [<IERS finals file>]]
+ The Earth orientation comes from an IERS finals file (finals2000A.data, or the like), if one is given;
+ without one, UT1-UTC and polar motion are zero, which puts the hour angle out by up to 13 arcseconds.
+
+ The file is:
+   - a 64-byte header: magic "SOFAALM", format version, record size, count, byte-order mark, first TT, step,
+     checksum.
+   - count records of ALMANAC_RECORD_SIZE doubles each, one per grid node:
+       ebpv[2][3]   Earth barycentric position/velocity (au, au/day), from iauEpv00
+       ehp[3]       Earth heliocentric position (au), from iauEpv00
+       x, y         CIP X,Y (radians), from iauPnm06a and iauBpn2xy
+       s            CIO locator (radians), from iauS06
+       sp           TIO locator s' (radians), from iauSp00
+       dut1         UT1-UTC (s)
+       xp, yp       polar motion (radians)
+                    (UT1-UTC and polar motion are taken as zero if no EOP source was given)
+       eo           equation of the origins (radians), from iauEors
+       dat          TAI-UTC (s), from iauDat, at the start of the UTC day
+   The numbers are in the byte order of the host that wrote the file; a reader on a host with a
+   different byte order rejects the file, because the byte-order mark (an int) doesn't match.
+   The checksum is the 64-bit FNV-1a hash of the header (with the checksum as zero) and the records.
+
+ Interpolation is 4-point Lagrangian. With the default step of 0.25 day, the interpolated CIP X,Y
+ are within a few microarcseconds of the directly computed values, and the observed places
+ computed from the interpolated context agree with iauApci13/iauApco13 to within 0.01 mas.
+ UT1-UTC and TAI-UTC are stored apart, because either may jump at a leap second: UT1-UTC does in real EOP
+ series (UT1-TAI doesn't), but not when no EOP source is given (UT1 is then UTC, and UT1-TAI jumps). So
+ UT1-UTC is interpolated only from nodes on the same side of any leap second as the time asked for (a
+ change of TAI-UTC of more than half a second), extrapolating by up to a step if need be.
+*/
+
+static const char ALMANAC_MAGIC[8] = {'S', 'O', 'F', 'A', 'A', 'L', 'M', '\0'};
+static const int ALMANAC_VERSION = 3;
+static const int ALMANAC_BYTE_ORDER = 0x01020304;
+
+/* Indexes of the quantities within a record. */
+enum { A_EBPV = 0, A_EHP = 6, A_X = 9, A_Y = 10, A_S = 11, A_SP = 12, A_DUT1 = 13, A_XP = 14, A_YP = 15, A_EO = 16, A_DAT = 17 };
+
+typedef struct {
+  char magic[8];
+  int version;
+  int record_size;     //in doubles
+  int count;
+  int byte_order;      //ALMANAC_BYTE_ORDER, as written
+  double tt1;          //first node, as a two-part JD
+  double tt2;
+  double step;         //days
+  unsigned long long checksum;
+  double padding;
+} almanac_header;
+
+/* TAI-UTC (s) for a UTC, as iauUtcut1 takes it: that of the start of its day. */
+static double utc_dat(double utc1, double utc2) {
+  int iy, im, id;
+  double fd, dat = 0.0;
+  if (iauJd2cal(utc1, utc2, &iy, &im, &id, &fd) == 0) (void)iauDat(iy, im, id, 0.0, &dat);
+  return dat;
+}
+
+/* Compute the record for the given TT. */
+static void almanac_record(double tt1, double tt2, terse_alternate_iauEOPFUNC eop, void *eop_ctx, double *record) {
+  double ehpv[2][3], ebpv[2][3], r[3][3], x, y;
+  memset(record, 0, ALMANAC_RECORD_SIZE * sizeof(double));
+  (void) iauEpv00(tt1, tt2, ehpv, ebpv);
+  memcpy(&record[A_EBPV], ebpv, 6 * sizeof(double));
+  memcpy(&record[A_EHP], ehpv[0], 3 * sizeof(double));
+  iauPnm06a(tt1, tt2, r);
+  iauBpn2xy(r, &x, &y);
+  double s = iauS06(tt1, tt2, x, y);
+  record[A_X] = x;
+  record[A_Y] = y;
+  record[A_S] = s;
+  record[A_SP] = iauSp00(tt1, tt2);
+  record[A_EO] = iauEors(r, s);
+  //UT1-UTC and TAI-UTC at the corresponding UTC
+  double tai1, tai2, utc1, utc2;
+  iauTttai(tt1, tt2, &tai1, &tai2);
+  iauTaiutc(tai1, tai2, &utc1, &utc2);
+  if (eop != NULL) {
+    eop(eop_ctx, utc1, utc2, &record[A_DUT1], &record[A_XP], &record[A_YP]);
+  }
+  record[A_DAT] = utc_dat(utc1, utc2);
+}
+
+/*
+ Write an almanac with n nodes, at TT = tt1 + (tt2 + i*step), i = 0..n-1.
+ The EOP function may be NULL, in which case UT1-UTC and polar motion are stored as zero.
+ Returns 0 for success, -1 for bad arguments, -2 for an I/O error.
+*/
+int terse_alternate_iauAlmanacWrite(const char *path, double tt1, double tt2, double step, int n, terse_alternate_iauEOPFUNC eop, void *eop_ctx) {
+  if (n < 4 || step <= 0.0) return -1;
+  double *records = malloc((size_t)n * ALMANAC_RECORD_SIZE * sizeof(double));
+  if (records == NULL) return -2;
+  for (int i = 0; i < n; ++i) {
+    almanac_record(tt1, tt2 + i * step, eop, eop_ctx, &records[(size_t)i * ALMANAC_RECORD_SIZE]);
+  }
+  size_t records_size = (size_t)n * ALMANAC_RECORD_SIZE * sizeof(double);
+
+  almanac_header header;
+  memset(&header, 0, sizeof header);
+  memcpy(header.magic, ALMANAC_MAGIC, sizeof header.magic);
+  header.version = ALMANAC_VERSION;
+  header.record_size = ALMANAC_RECORD_SIZE;
+  header.count = n;
+  header.byte_order = ALMANAC_BYTE_ORDER;
+  header.tt1 = tt1;
+  header.tt2 = tt2;
+  header.step = step;
+  header.checksum = terse_alternate_fnv1a64_more(terse_alternate_fnv1a64(&header, sizeof header), records, records_size);
+
+  int status = 0;
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) {
+    status = -2;
+  } else {
+    if (fwrite(&header, sizeof header, 1, file) != 1) status = -2;
+    if (status == 0 && fwrite(records, records_size, 1, file) != 1) status = -2;
+    if (fclose(file) != 0) status = -2;
+  }
+  free(records);
+  return status;
+}
+
+/*
+ Map an almanac into memory. If verify is non-zero, the checksum is checked (which reads every page).
+ Returns 0 for success, -1 if the file can't be mapped, -2 if it isn't an almanac of this version
+ (or was written on a host with a different byte order), -3 for a bad checksum.
+*/
+int terse_alternate_iauAlmanacOpen(const char *path, int verify, terse_alternate_iauALMANAC *almanac) {
+  if (terse_alternate_map_file(path, &almanac->mapping) != 0) return -1;
+  const almanac_header *header = almanac->mapping.base;
+  size_t expected_size = 0;
+  if (almanac->mapping.size >= sizeof *header) {
+    expected_size = sizeof *header + (size_t)header->count * ALMANAC_RECORD_SIZE * sizeof(double);
+  }
+  if (expected_size == 0 || memcmp(header->magic, ALMANAC_MAGIC, sizeof header->magic) != 0 ||
+      header->byte_order != ALMANAC_BYTE_ORDER || header->version != ALMANAC_VERSION || header->record_size != ALMANAC_RECORD_SIZE ||
+      header->count < 4 || almanac->mapping.size != expected_size) {
+    terse_alternate_unmap_file(&almanac->mapping);
+    return -2;
+  }
+  almanac->records = (const double *)(header + 1);
+  almanac->n = header->count;
+  almanac->tt1 = header->tt1;
+  almanac->tt2 = header->tt2;
+  almanac->step = header->step;
+  almanac_header unsummed = *header;
+  unsummed.checksum = 0;
+  if (verify && terse_alternate_fnv1a64_more(terse_alternate_fnv1a64(&unsummed, sizeof unsummed), almanac->records, expected_size - sizeof *header) != header->checksum) {
+    terse_alternate_iauAlmanacClose(almanac);
+    return -3;
+  }
+  return 0;
+}
+
+void terse_alternate_iauAlmanacClose(terse_alternate_iauALMANAC *almanac) {
+  terse_alternate_unmap_file(&almanac->mapping);
+  almanac->records = NULL;
+  almanac->n = 0;
+}
+
+/* Lagrange weights for nodes at 0, 1, 2, 3, at position p relative to the first. */
+static void lagrange_weights(double p, double w[4]) {
+  w[0] = -(p - 1.0) * (p - 2.0) * (p - 3.0) / 6.0;
+  w[1] = p * (p - 2.0) * (p - 3.0) / 2.0;
+  w[2] = -p * (p - 1.0) * (p - 3.0) / 2.0;
+  w[3] = p * (p - 1.0) * (p - 2.0) / 6.0;
+}
+
+/* The first of the 4 nodes to interpolate from at position u (in steps from the first node). */
+static int first_node(const terse_alternate_iauALMANAC *almanac, double u) {
+  int k = (int)floor(u) - 1;
+  if (k < 0) k = 0;
+  if (k > almanac->n - 4) k = almanac->n - 4;
+  return k;
+}
+
+/*
+ Interpolate a whole record at the given TT, with a 4-point Lagrange formula.
+ Near the ends of the table, the 4 points are shifted to stay inside it.
+ The UT1-UTC in the record is interpolated regardless of leap seconds (terse_alternate_iauAlmanacApco doesn't use it).
+ Returns 0 for success, -1 if the TT is outside the range of the table.
+*/
+int terse_alternate_iauAlmanacInterp(const terse_alternate_iauALMANAC *almanac, double tt1, double tt2, double record[ALMANAC_RECORD_SIZE]) {
+  double u = ((tt1 - almanac->tt1) + (tt2 - almanac->tt2)) / almanac->step;
+  if (u < 0.0 || u > almanac->n - 1) return -1;
+  int k = first_node(almanac, u);
+  double w[4];
+  lagrange_weights(u - k, w);
+
+  const double *r = &almanac->records[(size_t)k * ALMANAC_RECORD_SIZE];
+  for (int j = 0; j < ALMANAC_RECORD_SIZE; ++j) {
+    record[j] = w[0] * r[j] + w[1] * r[j + ALMANAC_RECORD_SIZE] +
+                w[2] * r[j + 2 * ALMANAC_RECORD_SIZE] + w[3] * r[j + 3 * ALMANAC_RECORD_SIZE];
+  }
+  return 0;
+}
+
+/*
+ UT1-UTC at position u (in steps from the first node), for a time with TAI-UTC dat (s): from the 4 nodes
+ nearest on the same side of any leap second.
+*/
+static double interpolate_dut1(const terse_alternate_iauALMANAC *almanac, double u, double dat) {
+  const double *r = almanac->records;
+  int k = first_node(almanac, u);
+  while (k > 0 && fabs(r[(size_t)(k + 3) * ALMANAC_RECORD_SIZE + A_DAT] - dat) > 0.5) --k;
+  while (k < almanac->n - 4 && fabs(r[(size_t)k * ALMANAC_RECORD_SIZE + A_DAT] - dat) > 0.5) ++k;
+  double w[4], dut1 = 0.0;
+  lagrange_weights(u - k, w);
+  for (int i = 0; i < 4; ++i) dut1 += w[i] * r[(size_t)(k + i) * ALMANAC_RECORD_SIZE + A_DUT1];
+  return dut1;
+}
+
+/*
+ Like iauApci13, but using the almanac instead of computing the Earth ephemeris and precession-nutation.
+ Returns 0 for success, -1 if the TT is outside the range of the almanac.
+*/
+int terse_alternate_iauAlmanacApci(const terse_alternate_iauALMANAC *almanac, double tt1, double tt2, iauASTROM *astrom, double *eo) {
+  double record[ALMANAC_RECORD_SIZE], ebpv[2][3];
+  if (terse_alternate_iauAlmanacInterp(almanac, tt1, tt2, record) != 0) return -1;
+  memcpy(ebpv, &record[A_EBPV], sizeof ebpv);
+  iauApci(tt1, tt2, ebpv, &record[A_EHP], record[A_X], record[A_Y], record[A_S], astrom);
+  *eo = record[A_EO];
+  return 0;
+}
+
+/*
+ Like iauApco13, but using the almanac for the Earth ephemeris, precession-nutation,
+ and Earth orientation (UT1-UTC and polar motion).
+ If eop isn't NULL, its UT1-UTC (s), xp and yp (radians) are used instead of the almanac's.
+ Returns +1 for a dubious year, 0 for success, -1 for an unacceptable UTC, -2 if outside the range of the almanac.
+*/
+int terse_alternate_iauAlmanacApco(const terse_alternate_iauALMANAC *almanac, double utc1, double utc2, const double eop[3],
+    double elong, double phi, double hm, double phpa, double tc, double rh, double wl,
+    iauASTROM *astrom, double *eo) {
+  double tai1, tai2, tt1, tt2, refa, refb, record[ALMANAC_RECORD_SIZE], ebpv[2][3];
+  int j = iauUtctai(utc1, utc2, &tai1, &tai2);
+  if (j < 0) return -1;
+  iauTaitt(tai1, tai2, &tt1, &tt2);
+  if (terse_alternate_iauAlmanacInterp(almanac, tt1, tt2, record) != 0) return -2;
+
+  double u = ((tt1 - almanac->tt1) + (tt2 - almanac->tt2)) / almanac->step;
+  double dat = utc_dat(utc1, utc2);
+  double ut1mtai = ((eop != NULL) ? eop[0] : interpolate_dut1(almanac, u, dat)) - dat;
+  double xp = (eop != NULL) ? eop[1] : record[A_XP];
+  double yp = (eop != NULL) ? eop[2] : record[A_YP];
+
+  memcpy(ebpv, &record[A_EBPV], sizeof ebpv);
+  iauRefco(phpa, tc, rh, wl, &refa, &refb);
+  iauApco(tt1, tt2, ebpv, &record[A_EHP], record[A_X], record[A_Y], record[A_S],
+      iauEra00(tai1, tai2 + ut1mtai / DAYSEC), elong, phi, hm, xp, yp, record[A_SP], refa, refb, astrom);
+  *eo = record[A_EO];
+  return j;
+}
+
+/* Earth orientation from an IERS finals file: one row per day of MJD, UT1-UTC (s), xp, yp (radians). */
+typedef struct {
+  double (*rows)[4];
+  int n;
+  int outside;         //set if asked for a UTC outside the file
+} finals_eop;
+
+/* The number in columns first..first+width-1 (counting from 1) of a line; returns 0 if blank. */
+static int finals_field(const char *line, int first, int width, double *value) {
+  char field[16], *end;
+  memcpy(field, line + first - 1, (size_t)width);
+  field[width] = '\0';
+  *value = strtod(field, &end);
+  return end != field;
+}
+
+/*
+ Read the Bulletin A MJD, polar motion and UT1-UTC columns of an IERS finals file, up to the last day with UT1-UTC.
+ Returns 0 for success, -1 if the file can't be read or has no usable rows.
+*/
+static int read_finals(const char *path, finals_eop *finals) {
+  FILE *file = fopen(path, "r");
+  char line[256];
+  int capacity = 0;
+  finals->rows = NULL;
+  finals->n = 0;
+  finals->outside = 0;
+  if (file == NULL) return -1;
+  while (fgets(line, sizeof line, file) != NULL) {
+    double mjd, xp, yp, dut1;
+    if (strlen(line) < 68 || !finals_field(line, 8, 8, &mjd) || !finals_field(line, 19, 9, &xp) ||
+        !finals_field(line, 38, 9, &yp) || !finals_field(line, 59, 10, &dut1)) break;
+    if (finals->n == capacity) {
+      capacity = capacity ? 2 * capacity : 1024;
+      double (*rows)[4] = realloc(finals->rows, (size_t)capacity * sizeof *rows);
+      if (rows == NULL) break;
+      finals->rows = rows;
+    }
+    finals->rows[finals->n][0] = mjd;
+    finals->rows[finals->n][1] = dut1;
+    finals->rows[finals->n][2] = xp * DAS2R;
+    finals->rows[finals->n][3] = yp * DAS2R;
+    ++finals->n;
+  }
+  fclose(file);
+  return finals->n >= 2 ? 0 : -1;
+}
+
+/*
+ The terse_alternate_iauEOPFUNC for an IERS finals file: linear interpolation between the daily rows. A jump of UT1-UTC
+ between two rows is a leap second at the end of the first day, so it isn't interpolated across.
+*/
+static void finals_eop_at(void *ctx, double utc1, double utc2, double *dut1, double *xp, double *yp) {
+  finals_eop *finals = ctx;
+  double mjd = (utc1 - DJM0) + utc2;
+  int lo = 0, hi = finals->n - 1;
+  if (mjd < finals->rows[lo][0] || mjd > finals->rows[hi][0]) finals->outside = 1;
+  while (hi - lo > 1) {
+    int mid = (lo + hi) / 2;
+    if (finals->rows[mid][0] <= mjd) lo = mid; else hi = mid;
+  }
+  const double *a = finals->rows[lo], *b = finals->rows[hi];
+  double f = (mjd - a[0]) / (b[0] - a[0]);
+  f = (f < 0.0) ? 0.0 : (f > 1.0) ? 1.0 : f;
+  double jump = b[1] - a[1];
+  jump = (fabs(jump) > 0.5) ? floor(jump + 0.5) : 0.0;
+  *dut1 = a[1] + (b[1] - jump - a[1]) * f;
+  *xp = a[2] + (b[2] - a[2]) * f;
+  *yp = a[3] + (b[3] - a[3]) * f;
+}
+
+/* The command-line tool: almanac <file> <first TT as JD> <number of days> [<step in days> [<IERS finals file>]]. */
+int terse_alternate_run_almanac_tool(int argc, char *argv[]) {
+  if (argc < 5) {
+    printf("Usage: almanac <file> <first TT as JD> <number of days> [<step in days> [<IERS finals file>]]\n");
+    return 1;
+  }
+  double first = atof(argv[3]);
+  double days = atof(argv[4]);
+  double step = (argc > 5) ? atof(argv[5]) : 0.25;
+  int n = (int)(days / step) + 1;
+  double whole = floor(first);
+  finals_eop finals = { NULL, 0, 0 };
+  if (argc > 6 && read_finals(argv[6], &finals) != 0) {
+    printf("%s: not a readable IERS finals file.\n", argv[6]);
+    free(finals.rows);
+    return 1;
+  }
+  int status = terse_alternate_iauAlmanacWrite(argv[2], whole, first - whole, step, n, (argc > 6) ? finals_eop_at : NULL, &finals);
+  free(finals.rows);
+  if (finals.outside) {
+    printf("%s: the almanac runs past the end of %s.\n", argv[2], argv[6]);
+    remove(argv[2]);
+    return 1;
+  }
+  printf("%s: %d nodes from JD %.5f TT, every %g days, %s. Status %d.\n", argv[2], n, first, step,
+      (argc > 6) ? "with Earth orientation" : "without Earth orientation", status);
+  return status == 0 ? 0 : 1;
+}
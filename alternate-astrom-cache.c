@@ -0,0 +1,274 @@
+#define _POSIX_C_SOURCE 200112L
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ A cache of astrometry contexts, shared by the threads of a process, implemented in C99 with POSIX threads
+ and the __atomic builtins of gcc and clang.
+
+ A server whose threads each call iauApci13 or iauApco13, for the same few sites and for times within
+ moments of each other, rebuilds the same contexts over and over. Here the time is rounded to the nearest
+ multiple of a quantum (seconds), and the context for the rounded time and the site is built once and shared:
+
+   - reads take no locks: each slot of the table is guarded by a sequence number (a seqlock), odd while the
+     slot is being written, so a reader copies the slot and then checks that the number hasn't changed.
+   - a missing context is built by just one thread: the others asking for it meanwhile wait for it, rather
+     than building it too.
+   - the table has a fixed size, in sets of SET_SIZE slots. A new context replaces an empty slot of its set,
+     or else the one whose time is farthest from its own (servers mostly move forward in time, so that's
+     usually the oldest).
+   - counters of hits, misses, waits and evictions.
+
+ For iauApco13, the Earth rotation angle of the shared context is advanced from the rounded time to the time
+ asked for, as by iauAper13, so the error is only in the slowly changing quantities; the largest is in the
+ aberration, from the rotation of the site's velocity (up to 23 microarcseconds per second of offset, at the
+ equator) and the Earth's orbital acceleration (4 uas per second). With a 1 s quantum the offset is at most
+ 0.5 s, so the places found with the contexts are within 14 uas of those found with iauApco13, and 2 uas of
+ those found with iauApci13 (more, within a few degrees of the Sun); the errors grow in proportion to the
+ quantum.
+ Contexts for times within a quantum of a leap second may be in error by the leap second's rotation.
+*/
+
+/* The number of slots per set, and the most constructions that waiting threads can be told about. */
+enum { SET_SIZE = 4, MAX_BUILDING = 32 };
+
+/* Which function built a context. */
+enum { APCI13 = 1, APCO13 = 2 };
+
+/* The rate of the Earth's rotation (radians per second of UT1). */
+static const double EARTH_RATE = D2PI * 1.00273781191135448 / DAYSEC;
+
+/* A context's key: the function, the time as a number of quanta from J2000, and the site. */
+typedef struct {
+  long long kind;
+  long long k;
+  double site[10];   /* dut1, elong, phi, hm, xp, yp, phpa, tc, rh, wl (zero for iauApci13) */
+} cache_key;
+
+typedef struct {
+  unsigned long seq;    /* 0 empty, odd while being written; only through the __atomic builtins */
+  cache_key key;
+  iauASTROM astrom;
+  double eo;
+  int status;
+} cache_slot;
+
+struct terse_alternate_iauASTROMCACHE {
+  double quantum;          /* seconds */
+  unsigned long nsets;     /* a power of 2 */
+  cache_slot *slots;
+
+  /* misses: only under the lock */
+  pthread_mutex_t lock;
+  pthread_cond_t built;
+  cache_key building[MAX_BUILDING];
+  int is_building[MAX_BUILDING];
+
+  /* only through the __atomic builtins */
+  long long hits, misses, waits, evictions;
+};
+
+static int same_key(const cache_key *a, const cache_key *b) {
+  if (a->kind != b->kind || a->k != b->k) return 0;
+  for (int i = 0; i < 10; ++i) {
+    if (a->site[i] != b->site[i]) return 0;
+  }
+  return 1;
+}
+
+/* The set for a key (FNV-1a over its bytes). */
+static unsigned long set_of(const terse_alternate_iauASTROMCACHE *cache, const cache_key *key) {
+  const unsigned char *p = (const unsigned char *)key;
+  unsigned long long h = 14695981039346656037ULL;
+  for (size_t i = 0; i < sizeof *key; ++i) h = (h ^ p[i]) * 1099511628211ULL;
+  return (unsigned long)(h ^ (h >> 32)) & (cache->nsets - 1);
+}
+
+/* Copy out the context for a key, if it's in the table. Takes no locks. */
+static int lookup(terse_alternate_iauASTROMCACHE *cache, const cache_key *key, cache_slot *out) {
+  cache_slot *set = &cache->slots[set_of(cache, key) * SET_SIZE];
+  for (int w = 0; w < SET_SIZE; ++w) {
+    unsigned long before = __atomic_load_n(&set[w].seq, __ATOMIC_ACQUIRE);
+    if (before == 0 || (before & 1)) continue;
+    memcpy(out, &set[w], sizeof *out);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&set[w].seq, __ATOMIC_RELAXED) == before && same_key(&out->key, key)) return 1;
+  }
+  return 0;
+}
+
+/* Put a context in the table, in place of an empty slot or the farthest in time. Only under the lock. */
+static void insert(terse_alternate_iauASTROMCACHE *cache, const cache_slot *entry) {
+  cache_slot *set = &cache->slots[set_of(cache, &entry->key) * SET_SIZE];
+  cache_slot *victim = NULL;
+  long long farthest = -1;
+  for (int w = 0; w < SET_SIZE && farthest < LLONG_MAX; ++w) {
+    if (set[w].seq == 0) {
+      victim = &set[w];
+      farthest = LLONG_MAX;
+    } else {
+      long long d = llabs(set[w].key.k - entry->key.k);
+      if (d > farthest) {
+        victim = &set[w];
+        farthest = d;
+      }
+    }
+  }
+  unsigned long seq = victim->seq;
+  if (seq != 0) __atomic_fetch_add(&cache->evictions, 1, __ATOMIC_RELAXED);
+  __atomic_store_n(&victim->seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  victim->key = entry->key;
+  victim->astrom = entry->astrom;
+  victim->eo = entry->eo;
+  victim->status = entry->status;
+  __atomic_store_n(&victim->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+/* The context for a key: from the table, or built by this thread, or by another one while this one waits. */
+static void get(terse_alternate_iauASTROMCACHE *cache, const cache_key *key, double date1, double date2, cache_slot *out) {
+  if (lookup(cache, key, out)) {
+    __atomic_fetch_add(&cache->hits, 1, __ATOMIC_RELAXED);
+    return;
+  }
+  pthread_mutex_lock(&cache->lock);
+  for (;;) {
+    if (lookup(cache, key, out)) {
+      pthread_mutex_unlock(&cache->lock);
+      __atomic_fetch_add(&cache->hits, 1, __ATOMIC_RELAXED);
+      return;
+    }
+    int b = 0, free_b = -1;
+    for (; b < MAX_BUILDING; ++b) {
+      if (cache->is_building[b] && same_key(&cache->building[b], key)) break;
+      if (!cache->is_building[b] && free_b < 0) free_b = b;
+    }
+    if (b == MAX_BUILDING) {
+      //build it here, telling the others, if there's room
+      if (free_b >= 0) {
+        cache->building[free_b] = *key;
+        cache->is_building[free_b] = 1;
+      }
+      pthread_mutex_unlock(&cache->lock);
+      __atomic_fetch_add(&cache->misses, 1, __ATOMIC_RELAXED);
+      out->key = *key;
+      if (key->kind == APCI13) {
+        iauApci13(date1, date2, &out->astrom, &out->eo);
+        out->status = 0;
+      } else {
+        const double *s = key->site;
+        out->status = iauApco13(date1, date2, s[0], s[1], s[2], s[3], s[4], s[5], s[6], s[7], s[8], s[9],
+            &out->astrom, &out->eo);
+      }
+      pthread_mutex_lock(&cache->lock);
+      if (out->status >= 0) insert(cache, out);
+      if (free_b >= 0) {
+        cache->is_building[free_b] = 0;
+        pthread_cond_broadcast(&cache->built);
+      }
+      pthread_mutex_unlock(&cache->lock);
+      return;
+    }
+    //another thread is building it: wait, and look again (it may have failed, or already been evicted)
+    __atomic_fetch_add(&cache->waits, 1, __ATOMIC_RELAXED);
+    while (cache->is_building[b] && same_key(&cache->building[b], key)) pthread_cond_wait(&cache->built, &cache->lock);
+  }
+}
+
+/*
+ A cache of at least capacity contexts, for times rounded to multiples of quantum seconds (0 for 1 s).
+ Returns 0, -1 for bad arguments, -2 if there isn't the memory.
+*/
+int terse_alternate_iauAstromCacheNew(int capacity, double quantum, terse_alternate_iauASTROMCACHE **cache) {
+  *cache = NULL;
+  if (capacity <= 0 || quantum < 0.0) return -1;
+  terse_alternate_iauASTROMCACHE *c = calloc(1, sizeof *c);
+  if (c == NULL) return -2;
+  c->quantum = (quantum == 0.0) ? 1.0 : quantum;
+  c->nsets = 1;
+  while (c->nsets * SET_SIZE < (unsigned long)capacity) c->nsets *= 2;
+  c->slots = calloc(c->nsets * SET_SIZE, sizeof *c->slots);
+  if (c->slots == NULL) {
+    free(c);
+    return -2;
+  }
+  if (pthread_mutex_init(&c->lock, NULL) != 0) {
+    free(c->slots);
+    free(c);
+    return -2;
+  }
+  if (pthread_cond_init(&c->built, NULL) != 0) {
+    pthread_mutex_destroy(&c->lock);
+    free(c->slots);
+    free(c);
+    return -2;
+  }
+  *cache = c;
+  return 0;
+}
+
+/* Free a cache. No other thread may be using it. */
+void terse_alternate_iauAstromCacheFree(terse_alternate_iauASTROMCACHE *cache) {
+  if (cache == NULL) return;
+  pthread_cond_destroy(&cache->built);
+  pthread_mutex_destroy(&cache->lock);
+  free(cache->slots);
+  free(cache);
+}
+
+/* The number of quanta from J2000 nearest a two-part date, and the seconds from it to the date. */
+static long long round_time(const terse_alternate_iauASTROMCACHE *cache, double date1, double date2, double *offset) {
+  double seconds = ((date1 - DJ00) + date2) * DAYSEC;
+  long long k = (long long)floor(seconds / cache->quantum + 0.5);
+  *offset = seconds - k * cache->quantum;
+  return k;
+}
+
+/* iauApci13, for the TDB date1+date2 rounded to the cache's quantum, from the cache. */
+void terse_alternate_iauAstromCacheApci13(terse_alternate_iauASTROMCACHE *cache, double date1, double date2, iauASTROM *astrom, double *eo) {
+  cache_key key;
+  cache_slot entry;
+  double offset;
+  memset(&key, 0, sizeof key);
+  key.kind = APCI13;
+  key.k = round_time(cache, date1, date2, &offset);
+  get(cache, &key, DJ00, key.k * cache->quantum / DAYSEC, &entry);
+  *astrom = entry.astrom;
+  *eo = entry.eo;
+}
+
+/*
+ iauApco13, from the cache: the context for the UTC rounded to the cache's quantum, with the Earth rotation
+ angle for utc1+utc2 itself. Returns the status of iauApco13 (errors aren't cached).
+*/
+int terse_alternate_iauAstromCacheApco13(terse_alternate_iauASTROMCACHE *cache, double utc1, double utc2, double dut1,
+    double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl, iauASTROM *astrom, double *eo) {
+  cache_key key;
+  cache_slot entry;
+  double offset;
+  memset(&key, 0, sizeof key);
+  key.kind = APCO13;
+  key.k = round_time(cache, utc1, utc2, &offset);
+  double site[10] = {dut1, elong, phi, hm, xp, yp, phpa, tc, rh, wl};
+  memcpy(key.site, site, sizeof site);
+  get(cache, &key, DJ00, key.k * cache->quantum / DAYSEC, &entry);
+  if (entry.status < 0) return entry.status;
+  *astrom = entry.astrom;
+  astrom->eral += EARTH_RATE * offset;
+  *eo = entry.eo;
+  return entry.status;
+}
+
+/* The cache's counters, so far. */
+void terse_alternate_iauAstromCacheStats(const terse_alternate_iauASTROMCACHE *cache, terse_alternate_iauASTROMCACHESTATS *stats) {
+  stats->hits = __atomic_load_n(&cache->hits, __ATOMIC_RELAXED);
+  stats->misses = __atomic_load_n(&cache->misses, __ATOMIC_RELAXED);
+  stats->waits = __atomic_load_n(&cache->waits, __ATOMIC_RELAXED);
+  stats->evictions = __atomic_load_n(&cache->evictions, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,738 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Benchmarks, implemented in C99.
+
+ Run them with:
+   ./run_tests.exe bench
+
+ Times are averages per call. 'Cold' times are measured with the caches flushed
+ before every call, by sweeping through a buffer larger than the last-level cache.
+ That's a portable stand-in for counting cache misses; on Linux the misses themselves
+ can be counted with:
+   perf stat -e cache-misses,L1-dcache-load-misses ./run_tests.exe bench
+*/
+
+static const int WARM_CALLS = 2000;
+static const int COLD_CALLS = 200;
+static const size_t SWEEP_BYTES = 64u * 1024u * 1024u;
+
+static unsigned char *sweep_buffer = NULL;
+static volatile unsigned sweep_sink = 0;
+
+/* Push the tables out of the caches, by touching every cache line of a large buffer. */
+static void flush_caches(void) {
+  if (sweep_buffer == NULL) {
+    sweep_buffer = malloc(SWEEP_BYTES);
+    memset(sweep_buffer, 1, SWEEP_BYTES);
+  }
+  unsigned sum = 0;
+  for (size_t i = 0; i < SWEEP_BYTES; i += 64) {
+    sweep_buffer[i] += 1;
+    sum += sweep_buffer[i];
+  }
+  sweep_sink += sum;
+}
+
+/* The average time of n calls of func(ctx, i), in nanoseconds, with warm caches. */
+static double bench_ns_per_call(void (*func)(void *ctx, int i), void *ctx, int n) {
+  func(ctx, 0);
+  double start = terse_alternate_now_ns();
+  for (int i = 0; i < n; ++i) {
+    func(ctx, i);
+  }
+  return (terse_alternate_now_ns() - start) / n;
+}
+
+/* The average time of n calls of func(ctx, i), in nanoseconds, with the caches flushed before each call. */
+static double bench_cold_ns_per_call(void (*func)(void *ctx, int i), void *ctx, int n) {
+  double total = 0.0;
+  for (int i = 0; i < n; ++i) {
+    flush_caches();
+    double start = terse_alternate_now_ns();
+    func(ctx, i);
+    total += terse_alternate_now_ns() - start;
+  }
+  return total / n;
+}
+
+static double sink = 0.0; //keeps the compiler from discarding the results
+
+static void call_nut00a(void *ctx, int i) {
+  double dpsi, deps;
+  (void)ctx;
+  iauNut00a(2451545.0, 0.37 * i, &dpsi, &deps);
+  sink += dpsi;
+}
+
+static void call_nut00a_packed(void *ctx, int i) {
+  double dpsi, deps;
+  (void)ctx;
+  terse_alternate_iauNut00aPacked(2451545.0, 0.37 * i, &dpsi, &deps);
+  sink += dpsi;
+}
+
+static void call_xy06(void *ctx, int i) {
+  double x, y;
+  (void)ctx;
+  iauXy06(2451545.0, 0.37 * i, &x, &y);
+  sink += x;
+}
+
+static void call_xy06_packed(void *ctx, int i) {
+  double x, y;
+  (void)ctx;
+  terse_alternate_iauXy06Packed(2451545.0, 0.37 * i, &x, &y);
+  sink += x;
+}
+
+static void call_nut_stepper(void *ctx, int i) {
+  double dpsi, deps;
+  (void)i;
+  terse_alternate_iauNutStep((terse_alternate_iauNUTSTEP *)ctx, &dpsi, &deps);
+  sink += dpsi;
+}
+
+static void compare(const char *name, void (*func)(void *ctx, int i), void *ctx) {
+  double warm = bench_ns_per_call(func, ctx, WARM_CALLS);
+  double cold = bench_cold_ns_per_call(func, ctx, COLD_CALLS);
+  printf("%-34s warm %9.0f ns/call   cold %9.0f ns/call\n", name, warm, cold);
+}
+
+/* The packed series tables versus the tables in nut00a.c and xy06.c. */
+static void bench_packed_tables(void) {
+  //sizes of the tables in nut00a.c and xy06.c, from their declarations there
+  size_t nut_original = NUT_LS_N * (5 * sizeof(int) + 6 * sizeof(double)) + NUT_PL_N * 17 * sizeof(int);
+  size_t xy_original = (XY_LS_N * 5 + XY_PL_N * 14 + XY_PL_N + XY_LS_N) * sizeof(int) + XY_AMP_N * sizeof(double);
+  size_t nut_packed = sizeof terse_alternate_nut_ls_mult + 6 * sizeof terse_alternate_nut_ls_sp + sizeof terse_alternate_nut_pl_mult + 4 * sizeof terse_alternate_nut_pl_sp;
+  size_t xy_packed = sizeof terse_alternate_xy_pl_mult + sizeof terse_alternate_xy_ls_mult + sizeof terse_alternate_xy_count + sizeof terse_alternate_xy_amp;
+
+  printf("Packed series tables.\n");
+  printf("Table bytes: nut00a %lu -> %lu, xy06 %lu -> %lu\n", (unsigned long)nut_original,
+      (unsigned long)nut_packed, (unsigned long)xy_original, (unsigned long)xy_packed);
+  compare("iauNut00a", call_nut00a, NULL);
+  compare("terse_alternate_iauNut00aPacked", call_nut00a_packed, NULL);
+  compare("iauXy06", call_xy06, NULL);
+  compare("terse_alternate_iauXy06Packed", call_xy06_packed, NULL);
+}
+
+/* The nutation stepper versus fresh evaluation, at 1-second steps. */
+static void bench_nutation_stepper(void) {
+  static terse_alternate_iauNUTSTEP ns;
+  terse_alternate_iauNutStepInit(&ns, 2451545.0, 8000.0, 1.0 / 86400.0, 0);
+  printf("\nNutation stepper, 1 second steps, refresh every 256 steps.\n");
+  compare("iauNut00a", call_nut00a, NULL);
+  compare("terse_alternate_iauNutStep", call_nut_stepper, &ns);
+}
+
+/* The average time per epoch of terse_alternate_iauNut00av, in nanoseconds. */
+static double nut00av_ns_per_epoch(const terse_alternate_iauEPOCHS *tt, int nthreads, double *dpsi, double *deps) {
+  double start = terse_alternate_now_ns();
+  terse_alternate_iauNut00av(tt, nthreads, dpsi, deps);
+  return (terse_alternate_now_ns() - start) / tt->n;
+}
+
+/* The average time per star of terse_alternate_iauAtciqv, in nanoseconds. */
+static double atciqv_ns_per_star(int n, int nthreads, const double *rc, const double *dc, iauASTROM *astrom, double *ri, double *di) {
+  double start = terse_alternate_now_ns();
+  terse_alternate_iauAtciqv(n, nthreads, rc, dc, NULL, NULL, NULL, NULL, astrom, ri, di);
+  return (terse_alternate_now_ns() - start) / n;
+}
+
+/* The cost of the reproducible mode, for 1 thread and for one per CPU. */
+static void bench_reproducible_mode(void) {
+  enum { NUM_EPOCHS = 20000, NUM_STARS = 200000 };
+  terse_alternate_iauEPOCHS tt = {2451545.0, 8000.0, 1.0 / 86400.0, NUM_EPOCHS};
+  double *dpsi = malloc(NUM_EPOCHS * sizeof(double));
+  double *deps = malloc(NUM_EPOCHS * sizeof(double));
+  double *rc = malloc(NUM_STARS * sizeof(double));
+  double *dc = malloc(NUM_STARS * sizeof(double));
+  double *ri = malloc(NUM_STARS * sizeof(double));
+  double *di = malloc(NUM_STARS * sizeof(double));
+  iauASTROM astrom;
+  double eo;
+  iauApci13(2456165.5, 0.401182685, &astrom, &eo);
+  for (int i = 0; i < NUM_STARS; ++i) {
+    rc[i] = 0.0003 * i;
+    dc[i] = -1.5 + 1.5e-5 * i;
+  }
+  int cpus = terse_alternate_iauNumCpus();
+  printf("\nReproducible mode, %d epochs at 1 second steps, %d stars, %d CPUs.\n", NUM_EPOCHS, NUM_STARS, cpus);
+  for (int mode = 0; mode <= 1; ++mode) {
+    terse_alternate_iauReproducible(mode);
+    printf("%-14s terse_alternate_iauNut00av 1 thread %7.0f ns/epoch, %d threads %7.0f ns/epoch;  terse_alternate_iauAtciqv 1 thread %5.0f ns/star, %d threads %5.0f ns/star\n",
+        mode ? "reproducible" : "normal",
+        nut00av_ns_per_epoch(&tt, 1, dpsi, deps), cpus, nut00av_ns_per_epoch(&tt, cpus, dpsi, deps),
+        atciqv_ns_per_star(NUM_STARS, 1, rc, dc, &astrom, ri, di), cpus, atciqv_ns_per_star(NUM_STARS, cpus, rc, dc, &astrom, ri, di));
+  }
+  terse_alternate_iauReproducible(0);
+  free(dpsi); free(deps); free(rc); free(dc); free(ri); free(di);
+}
+
+static void call_unix_to_tt(void *ctx, int i) {
+  double tt1, tt2;
+  (void)ctx;
+  terse_alternate_iauUnixToTt(1700000000000000000LL + 1000003LL * i, &tt1, &tt2);
+  sink += tt2;
+}
+
+/* The route that terse_alternate_iauUnixToTt replaces: calendar fields, then iauDtf2d, iauUtctai and iauTaitt. */
+static void call_unix_to_tt_by_calendar(void *ctx, int i) {
+  long long ns = 1700000000000000000LL + 1000003LL * i;
+  long long s = ns / 1000000000LL;
+  long long sod = s % 86400;
+  int iy, im, id;
+  double fd, utc1, utc2, tai1, tai2, tt1, tt2;
+  (void)ctx;
+  iauJd2cal(2440587.5 + (double)(s / 86400), 0.0, &iy, &im, &id, &fd);
+  iauDtf2d("UTC", iy, im, id, (int)(sod / 3600), (int)(sod / 60 % 60), (double)(sod % 60) + (ns % 1000000000LL) * 1e-9, &utc1, &utc2);
+  iauUtctai(utc1, utc2, &tai1, &tai2);
+  iauTaitt(tai1, tai2, &tt1, &tt2);
+  sink += tt2;
+}
+
+static void call_now(void *ctx, int i) {
+  double tt1, tt2, ut11, ut12;
+  (void)i;
+  terse_alternate_iauNow((terse_alternate_iauCLOCK *)ctx, NULL, NULL, &tt1, &tt2, &ut11, &ut12);
+  sink += tt2 + ut12;
+}
+
+/* POSIX time to TT, directly and through calendar fields. */
+static void bench_timestamps(void) {
+  printf("\nPOSIX time to TT.\n");
+  printf("%-34s %9.1f ns/call\n", "terse_alternate_iauUnixToTt", bench_ns_per_call(call_unix_to_tt, NULL, 1000000));
+  printf("%-34s %9.1f ns/call\n", "calendar route", bench_ns_per_call(call_unix_to_tt_by_calendar, NULL, 1000000));
+  terse_alternate_iauCLOCK clock;
+  terse_alternate_iauClockInit(&clock, NULL, NULL);
+  printf("%-34s %9.1f ns/call (TT and UT1, %s)\n", "terse_alternate_iauNow", bench_ns_per_call(call_now, &clock, 1000000),
+      clock.use_tai_clock ? "CLOCK_TAI" : "CLOCK_REALTIME");
+}
+
+/* UTC differences over arrays, with the leap-second table and with iauUtctai. */
+static void bench_utc_intervals(void) {
+  enum { N = 100000 };
+  double *a1 = malloc(N * sizeof(double)), *a2 = malloc(N * sizeof(double));
+  double *b1 = malloc(N * sizeof(double)), *b2 = malloc(N * sizeof(double)), *dt = malloc(N * sizeof(double));
+  for (int i = 0; i < N; ++i) {
+    a1[i] = 2457000.5 + (i % 3000);
+    a2[i] = 0.37;
+    b1[i] = a1[i] + 1.0;
+    b2[i] = 0.11;
+  }
+  printf("\nUTC differences, %d pairs.\n", N);
+  double start = terse_alternate_now_ns();
+  terse_alternate_iauUtcDiffv(N, a1, a2, b1, b2, dt);
+  printf("%-34s %9.1f ns/pair\n", "terse_alternate_iauUtcDiffv", (terse_alternate_now_ns() - start) / N);
+  start = terse_alternate_now_ns();
+  for (int i = 0; i < N; ++i) {
+    double ta1, ta2, tb1, tb2;
+    iauUtctai(a1[i], a2[i], &ta1, &ta2);
+    iauUtctai(b1[i], b2[i], &tb1, &tb2);
+    dt[i] = ((tb1 - ta1) + (tb2 - ta2)) * DAYSEC;
+  }
+  printf("%-34s %9.1f ns/pair\n", "iauUtctai", (terse_alternate_now_ns() - start) / N);
+  free(a1); free(a2); free(b1); free(b2); free(dt);
+}
+
+static void call_starpm_jac(void *ctx, int i) {
+  double r[6], jac[6][6];
+  (void)ctx;
+  terse_alternate_iauStarpmJac(1.234 + 1e-3 * i, -0.5, 2e-9, -1e-9, 0.0012, 25.0, 2457389.0, 0.0, 2451545.0, 0.0,
+      &r[0], &r[1], &r[2], &r[3], &r[4], &r[5], jac);
+  sink += jac[0][2];
+}
+
+/* The Jacobian by central differences: 12 calls of iauStarpm, and the one for the result. */
+static void call_starpm_differences(void *ctx, int i) {
+  static const double h[6] = {1e-7, 1e-7, 1e-10, 1e-10, 1e-6, 1e-3};
+  double star[6] = {1.234 + 1e-3 * i, -0.5, 2e-9, -1e-9, 0.0012, 25.0};
+  double r[6], plus[6], minus[6], jac[6][6];
+  (void)ctx;
+  iauStarpm(star[0], star[1], star[2], star[3], star[4], star[5], 2457389.0, 0.0, 2451545.0, 0.0,
+      &r[0], &r[1], &r[2], &r[3], &r[4], &r[5]);
+  for (int k = 0; k < 6; ++k) {
+    double a[6], b[6];
+    memcpy(a, star, sizeof a);
+    memcpy(b, star, sizeof b);
+    a[k] += h[k];
+    b[k] -= h[k];
+    iauStarpm(a[0], a[1], a[2], a[3], a[4], a[5], 2457389.0, 0.0, 2451545.0, 0.0,
+        &plus[0], &plus[1], &plus[2], &plus[3], &plus[4], &plus[5]);
+    iauStarpm(b[0], b[1], b[2], b[3], b[4], b[5], 2457389.0, 0.0, 2451545.0, 0.0,
+        &minus[0], &minus[1], &minus[2], &minus[3], &minus[4], &minus[5]);
+    for (int m = 0; m < 6; ++m) jac[m][k] = (plus[m] - minus[m]) / (2.0 * h[k]);
+  }
+  sink += jac[0][2];
+}
+
+static void bench_epoch_propagation(void) {
+  printf("\nEpoch propagation with the Jacobian.\n");
+  printf("%-34s %9.1f ns/call\n", "terse_alternate_iauStarpmJac", bench_ns_per_call(call_starpm_jac, NULL, WARM_CALLS));
+  printf("%-34s %9.1f ns/call\n", "differences", bench_ns_per_call(call_starpm_differences, NULL, WARM_CALLS));
+}
+
+static void bench_ecliptic_batches(void) {
+  enum { N = 100000 };
+  double *lon = malloc(N * sizeof(double)), *lat = malloc(N * sizeof(double));
+  double *ra = malloc(N * sizeof(double)), *dec = malloc(N * sizeof(double));
+  for (int i = 0; i < N; ++i) {
+    lon[i] = 1e-4 * i;
+    lat[i] = 0.3 * sin(1e-3 * i);
+  }
+  printf("\nEcliptic to ICRS, %d coordinates at one epoch.\n", N);
+  double start = terse_alternate_now_ns();
+  terse_alternate_iauEceq06v(2451545.0, 8000.5, N, lon, lat, ra, dec);
+  printf("%-34s %9.1f ns/coordinate\n", "terse_alternate_iauEceq06v", (terse_alternate_now_ns() - start) / N);
+  start = terse_alternate_now_ns();
+  for (int i = 0; i < N; ++i) {
+    iauEceq06(2451545.0, 8000.5, lon[i], lat[i], &ra[i], &dec[i]);
+  }
+  printf("%-34s %9.1f ns/coordinate\n", "iauEceq06", (terse_alternate_now_ns() - start) / N);
+  free(lon); free(lat); free(ra); free(dec);
+}
+
+static void bench_galactic_batches(void) {
+  enum { N = 1000000 };
+  double *ra = malloc(N * sizeof(double)), *dec = malloc(N * sizeof(double));
+  double *lon = malloc(N * sizeof(double)), *lat = malloc(N * sizeof(double));
+  for (int i = 0; i < N; ++i) {
+    ra[i] = 6.28e-6 * i;
+    dec[i] = 1.5 * sin(1e-3 * i);
+  }
+  printf("\nICRS to galactic, %d stars.\n", N);
+  double start = terse_alternate_now_ns();
+  for (int i = 0; i < N; ++i) {
+    iauIcrs2g(ra[i], dec[i], &lon[i], &lat[i]);
+  }
+  printf("%-34s %9.1f ns/star\n", "iauIcrs2g", (terse_alternate_now_ns() - start) / N);
+  start = terse_alternate_now_ns();
+  terse_alternate_iauIcrs2gv(N, 1, ra, dec, lon, lat);
+  printf("%-34s %9.1f ns/star\n", "terse_alternate_iauIcrs2gv", (terse_alternate_now_ns() - start) / N);
+  start = terse_alternate_now_ns();
+  terse_alternate_iauIcrs2gv(N, 0, ra, dec, lon, lat);
+  printf("%-34s %9.1f ns/star (%d threads)\n", "terse_alternate_iauIcrs2gv", (terse_alternate_now_ns() - start) / N, terse_alternate_iauNumCpus());
+  free(ra); free(dec); free(lon); free(lat);
+}
+
+static void bench_sexagesimal_batches(void) {
+  enum { N = 200000, STRIDE = 16 };
+  double *angle = malloc(N * sizeof(double)), *back = malloc(N * sizeof(double));
+  int *status = malloc(N * sizeof(int));
+  char *text = malloc(N * STRIDE);
+  for (int i = 0; i < N; ++i) {
+    angle[i] = 3.1e-5 * i;
+  }
+  printf("\nSexagesimal text, %d angles.\n", N);
+  int width;
+  double start = terse_alternate_now_ns();
+  terse_alternate_iauA2tfv(3, ':', N, angle, text, STRIDE, &width);
+  printf("%-34s %9.1f ns/angle\n", "terse_alternate_iauA2tfv", (terse_alternate_now_ns() - start) / N);
+  start = terse_alternate_now_ns();
+  for (int i = 0; i < N; ++i) {
+    char sign;
+    int f[4];
+    iauA2tf(3, angle[i], &sign, f);
+    sprintf(text + i * STRIDE, "%c%02d:%02d:%02d.%03d", sign, f[0], f[1], f[2], f[3]);
+  }
+  printf("%-34s %9.1f ns/angle\n", "iauA2tf, sprintf", (terse_alternate_now_ns() - start) / N);
+  start = terse_alternate_now_ns();
+  terse_alternate_iauTf2av(N, text, STRIDE, back, status);
+  printf("%-34s %9.1f ns/angle\n", "terse_alternate_iauTf2av", (terse_alternate_now_ns() - start) / N);
+  start = terse_alternate_now_ns();
+  for (int i = 0; i < N; ++i) {
+    char sign;
+    int h, m;
+    double sec;
+    if (sscanf(text + i * STRIDE, "%c%d:%d:%lf", &sign, &h, &m, &sec) == 4) iauTf2a(sign, h, m, sec, &back[i]);
+  }
+  printf("%-34s %9.1f ns/angle\n", "sscanf, iauTf2a", (terse_alternate_now_ns() - start) / N);
+  free(angle); free(back); free(status); free(text);
+}
+
+static const terse_alternate_iauTRACKTARGET BENCH_TARGET = {2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, 0.1550675, -0.527800806, -1.2345856,
+    2738.0, 2.47230737e-7, 1.82640464e-6, 731.0, 12.8, 0.59, 0.55};
+
+/* Times within the first interval, a millisecond apart. */
+static void call_tracker_get(void *ctx, int i) {
+  double az, zd, pa, err;
+  terse_alternate_iauTrackerGet((terse_alternate_iauTRACKER *)ctx, 2456384.5, 0.969254051 + 1e-3 * (i % 4000) / DAYSEC, &az, &zd, &pa, &err);
+  sink += az;
+}
+
+static void call_atco13_hd2pa(void *ctx, int i) {
+  const terse_alternate_iauTRACKTARGET *g = &BENCH_TARGET;
+  double aob, zob, hob, dob, rob, eo;
+  (void)ctx;
+  iauAtco13(g->rc, g->dc, g->pr, g->pd, g->px, g->rv, 2456384.5, 0.969254051 + 1e-3 * (i % 4000) / DAYSEC,
+      g->dut1, g->elong, g->phi, g->hm, g->xp, g->yp, g->phpa, g->tc, g->rh, g->wl, &aob, &zob, &hob, &dob, &rob, &eo);
+  sink += aob + iauHd2pa(hob, dob, g->phi);
+}
+
+static void bench_tracker(void) {
+  terse_alternate_iauTRACKER *tracker;
+  if (terse_alternate_iauTrackerStart(&BENCH_TARGET, 2456384.5, 0.969254051, 5.0, &tracker) < 0) return;
+  printf("\nTracking one target.\n");
+  printf("%-34s %9.1f ns/call\n", "terse_alternate_iauTrackerGet", bench_ns_per_call(call_tracker_get, tracker, WARM_CALLS));
+  printf("%-34s %9.1f ns/call\n", "iauAtco13, Hd2pa", bench_ns_per_call(call_atco13_hd2pa, NULL, WARM_CALLS));
+  terse_alternate_iauTrackerStop(tracker);
+}
+
+static void call_apco13p(void *ctx, int i) {
+  iauASTROM astrom;
+  double eo;
+  terse_alternate_iauApco13p((const terse_alternate_iauACCURACY *)ctx, 2456384.5, 0.969254051 + 1e-3 * i, 0.1550675, -0.527800806, -1.2345856,
+      2738.0, 2.47230737e-7, 1.82640464e-6, 731.0, 12.8, 0.59, 0.55, &astrom, &eo);
+  sink += eo;
+}
+
+static void call_gstp(void *ctx, int i) {
+  sink += terse_alternate_iauGstp((const terse_alternate_iauACCURACY *)ctx, 2456384.5, 0.969254051 + 1e-3 * i, 2456384.5, 0.970054051 + 1e-3 * i);
+}
+
+/* The measured times of each profile, against the published ones (relative to the full models). */
+static void bench_accuracy_profiles(void) {
+  printf("\nAccuracy profiles: terse_alternate_iauApco13p and terse_alternate_iauGstp, and relative to the full models (published).\n");
+  double full_apco13 = 0.0, full_gst = 0.0;
+  for (int p = 0; p < IAU_ACCURACY_PROFILES; ++p) {
+    terse_alternate_iauACCURACY acc = {0.0, p, p};
+    double apco13 = bench_ns_per_call(call_apco13p, &acc, WARM_CALLS);
+    double gst = bench_ns_per_call(call_gstp, &acc, WARM_CALLS);
+    if (p == IAU_ACCURACY_FULL) {
+      full_apco13 = apco13;
+      full_gst = gst;
+    }
+    printf("%-10s %9.0f ns %6.3f (%5.3f)   %9.0f ns %6.3f (%5.3f)\n", terse_alternate_iauAccuracyProfiles[p].name,
+        apco13, apco13 / full_apco13, terse_alternate_iauAccuracyProfiles[p].apco13_time,
+        gst, gst / full_gst, terse_alternate_iauAccuracyProfiles[p].gst_time);
+  }
+}
+
+/* 40 wavelengths, 1000 field positions: terse_alternate_iauRefcov and terse_alternate_iauRefzv, against iauRefco and the refraction of iauAtioq per pair. */
+static void bench_refraction(void) {
+  enum { NWL = 40, N = 1000 };
+  double wl[NWL], refa[NWL], refb[NWL], zt[N];
+  double *dz = malloc(NWL * N * sizeof(double));
+  for (int k = 0; k < NWL; ++k) wl[k] = 0.35 + 0.05 * k;
+  for (int i = 0; i < N; ++i) zt[i] = 1.2 + 1e-4 * i;
+  printf("\nRefraction, %d wavelengths.\n", NWL);
+  double start = terse_alternate_now_ns();
+  for (int rep = 0; rep < 100; ++rep) terse_alternate_iauRefcov(731.0, 12.8, 0.59, NWL, wl, refa, refb);
+  printf("%-34s %9.1f ns/wavelength\n", "terse_alternate_iauRefcov", (terse_alternate_now_ns() - start) / (100 * NWL));
+  start = terse_alternate_now_ns();
+  for (int rep = 0; rep < 100; ++rep) {
+    for (int k = 0; k < NWL; ++k) iauRefco(731.0, 12.8, 0.59, wl[k], &refa[k], &refb[k]);
+  }
+  printf("%-34s %9.1f ns/wavelength\n", "iauRefco", (terse_alternate_now_ns() - start) / (100 * NWL));
+  start = terse_alternate_now_ns();
+  terse_alternate_iauRefzv(NWL, refa, refb, 10, N, zt, dz);
+  printf("%-34s %9.1f ns/position/wavelength (%d positions)\n", "terse_alternate_iauRefzv", (terse_alternate_now_ns() - start) / (NWL * N), N);
+  start = terse_alternate_now_ns();
+  for (int k = 0; k < NWL; ++k) {
+    for (int i = 0; i < N; ++i) {
+      //as iauAtioq: the observed vector from the unrefracted one, then its zenith distance
+      double r = sin(zt[i]), z = cos(zt[i]), tz = r / z, w = refb[k] * tz * tz;
+      double del = (refa[k] + w) * tz / (1.0 + (refa[k] + 3.0 * w) / (z * z));
+      double cosdel = 1.0 - del * del / 2.0, f = cosdel - del * z / r;
+      dz[k * N + i] = zt[i] - atan2(r * f, cosdel * z + del * r);
+    }
+  }
+  printf("%-34s %9.1f ns/position/wavelength\n", "per pair", (terse_alternate_now_ns() - start) / (NWL * N));
+  sink += dz[N];
+  free(dz);
+}
+
+static iauASTROM jacobian_astrom;
+
+static void call_quick_jacobian(void *ctx, int i) {
+  double ri, di, aob, zob, hob, dob, rob, jac1[2][2], jac2[5][3];
+  (void)ctx;
+  terse_alternate_iauAtciqJ(2.71 + 1e-4 * i, 0.174, 1e-5, 5e-6, 0.1, 55.0, &jacobian_astrom, &ri, &di, jac1);
+  terse_alternate_iauAtioqJ(ri, di, &jacobian_astrom, &aob, &zob, &hob, &dob, &rob, jac2);
+  sink += jac1[0][0] + jac2[1][2];
+}
+
+/* The same by central differences, in RA, Dec and time (through the Earth rotation angle): 7 passes. */
+static void call_quick_differences(void *ctx, int i) {
+  static const double h[3] = {1e-6, 1e-6, 0.1 * D2PI * 1.00273781191135448 / DAYSEC};
+  double ri, di, aob, zob, hob, dob, rob[2];
+  iauASTROM astrom = jacobian_astrom;
+  (void)ctx;
+  iauAtciq(2.71 + 1e-4 * i, 0.174, 1e-5, 5e-6, 0.1, 55.0, &astrom, &ri, &di);
+  iauAtioq(ri, di, &astrom, &aob, &zob, &hob, &dob, &rob[0]);
+  for (int k = 0; k < 3; ++k) {
+    for (int sign = -1; sign <= 1; sign += 2) {
+      astrom.eral = jacobian_astrom.eral + sign * (k == 2) * h[k];
+      iauAtciq(2.71 + 1e-4 * i + sign * (k == 0) * h[k], 0.174 + sign * (k == 1) * h[k], 1e-5, 5e-6, 0.1, 55.0,
+          &astrom, &ri, &di);
+      iauAtioq(ri, di, &astrom, &aob, &zob, &hob, &dob, &rob[(sign + 1) / 2]);
+    }
+    sink += rob[1] - rob[0];
+  }
+}
+
+static void bench_jacobians(void) {
+  double eo;
+  iauApco13(2456384.5, 0.969254051, 0.1550675, -0.527800806, -1.2345856, 2738.0, 2.47230737e-7, 1.82640464e-6,
+      731.0, 12.8, 0.59, 0.55, &jacobian_astrom, &eo);
+  printf("\nJacobians of iauAtciq and iauAtioq, in RA, Dec and time.\n");
+  printf("%-34s %9.1f ns/call\n", "terse_alternate_iauAtciqJ, AtioqJ", bench_ns_per_call(call_quick_jacobian, NULL, WARM_CALLS));
+  printf("%-34s %9.1f ns/call\n", "differences", bench_ns_per_call(call_quick_differences, NULL, WARM_CALLS));
+}
+
+static void call_c2t_rate(void *ctx, int i) {
+  double rc2t[3][3], rc2tdot[3][3];
+  (void)ctx;
+  terse_alternate_iauC2t06aDot(2460000.5, 0.25 + 1e-3 * i, 2460000.5, 0.2492 + 1e-3 * i, 2.55e-7, 1.86e-6, 1.2e-9, -0.8e-9,
+      rc2t, rc2tdot);
+  sink += rc2tdot[0][1];
+}
+
+/* The same by central differences of iauC2t06a: the matrix itself, and two more for the rate. */
+static void call_c2t_differences(void *ctx, int i) {
+  const double h = 1e-3;
+  double rc2t[3][3], plus[3][3], minus[3][3];
+  (void)ctx;
+  iauC2t06a(2460000.5, 0.25 + 1e-3 * i, 2460000.5, 0.2492 + 1e-3 * i, 2.55e-7, 1.86e-6, rc2t);
+  iauC2t06a(2460000.5, 0.25 + 1e-3 * i + h, 2460000.5, 0.2492 + 1e-3 * i + h, 2.55e-7, 1.86e-6, plus);
+  iauC2t06a(2460000.5, 0.25 + 1e-3 * i - h, 2460000.5, 0.2492 + 1e-3 * i - h, 2.55e-7, 1.86e-6, minus);
+  sink += rc2t[0][0] + (plus[0][1] - minus[0][1]) / (2.0 * h);
+}
+
+static void bench_c2t_rates(void) {
+  printf("\nThe celestial-to-terrestrial matrix with its rate.\n");
+  printf("%-34s %9.1f ns/call\n", "terse_alternate_iauC2t06aDot", bench_ns_per_call(call_c2t_rate, NULL, WARM_CALLS));
+  printf("%-34s %9.1f ns/call\n", "iauC2t06a x3", bench_ns_per_call(call_c2t_differences, NULL, WARM_CALLS));
+}
+
+/* 100 stations, 10^4 satellites: terse_alternate_iauItrs2aev, against the per-point route of iauGd2gc and iauHd2ae. */
+static void bench_topocentric(void) {
+  enum { NSTA = 100, N = 10000 };
+  static terse_alternate_iauTOPOSTATION station[NSTA];
+  static double site[NSTA][2], x[N], y[N], z[N];
+  double *az = malloc((size_t)NSTA * N * sizeof(double));
+  double *el = malloc((size_t)NSTA * N * sizeof(double));
+  double *range = malloc((size_t)NSTA * N * sizeof(double));
+  for (int k = 0; k < NSTA; ++k) {
+    site[k][0] = -3.1 + 0.062 * k;
+    site[k][1] = -1.2 + 0.024 * k;
+    terse_alternate_iauTopoStation(WGS84, site[k][0], site[k][1], 100.0, 2.7e-4, -3e-7, &station[k]);
+  }
+  for (int i = 0; i < N; ++i) {
+    double r = 6378e3 + 500e3 + 3e3 * (i % 100), lon = 0.0377 * i, lat = asin(-1.0 + 2.0 * (i + 0.5) / N);
+    x[i] = r * cos(lat) * cos(lon);
+    y[i] = r * cos(lat) * sin(lon);
+    z[i] = r * sin(lat);
+  }
+  printf("\nTopocentric azimuth, elevation and range, %d stations x %d positions.\n", NSTA, N);
+  //once to touch the pages of the outputs, then timed, refracted
+  terse_alternate_iauItrs2aev(NSTA, station, N, x, y, z, 1, az, el, range);
+  double start = terse_alternate_now_ns();
+  terse_alternate_iauItrs2aev(NSTA, station, N, x, y, z, 1, az, el, range);
+  printf("%-34s %9.1f ns/pair (1 thread)\n", "terse_alternate_iauItrs2aev", (terse_alternate_now_ns() - start) / ((double)NSTA * N));
+  start = terse_alternate_now_ns();
+  terse_alternate_iauItrs2aev(NSTA, station, N, x, y, z, 0, az, el, range);
+  printf("%-34s %9.1f ns/pair (%d CPUs)\n", "terse_alternate_iauItrs2aev", (terse_alternate_now_ns() - start) / ((double)NSTA * N), terse_alternate_iauNumCpus());
+  start = terse_alternate_now_ns();
+  for (int k = 0; k < NSTA; ++k) {
+    for (int i = 0; i < N; ++i) {
+      double pos[3], p[3] = {x[i], y[i], z[i]}, d[3], theta, phi;
+      size_t j = (size_t)k * N + i;
+      iauGd2gc(WGS84, site[k][0], site[k][1], 100.0, pos);
+      iauPmp(p, pos, d);
+      iauC2s(d, &theta, &phi);
+      iauHd2ae(site[k][0] - theta, phi, site[k][1], &az[j], &el[j]);
+      range[j] = iauPm(d);
+    }
+  }
+  printf("%-34s %9.1f ns/pair (unrefracted)\n", "per point", (terse_alternate_now_ns() - start) / ((double)NSTA * N));
+  sink += az[N] + el[N] + range[N];
+  free(az);
+  free(el);
+  free(range);
+}
+
+/* An application's executor that starts a thread per share of the tasks on every run, as a simple scheduler might. */
+typedef struct {
+  int nthreads;
+} spawning_executor;
+
+typedef struct {
+  void (*task)(void *arg, int i);
+  void *arg;
+  int begin, end;
+} spawned_share;
+
+static void *run_spawned_share(void *p) {
+  spawned_share *share = p;
+  for (int i = share->begin; i < share->end; ++i) share->task(share->arg, i);
+  return NULL;
+}
+
+static void run_spawning(void *executor, int ntasks, void (*task)(void *arg, int i), void *arg) {
+  int nthreads = ((spawning_executor *)executor)->nthreads;
+  spawned_share share[64];
+  pthread_t thread[64];
+  int started[64] = {0};
+  if (nthreads > 64) nthreads = 64;
+  for (int t = 0; t < nthreads; ++t) {
+    share[t] = (spawned_share){task, arg, ntasks * t / nthreads, ntasks * (t + 1) / nthreads};
+    if (t > 0) started[t] = (pthread_create(&thread[t], NULL, run_spawned_share, &share[t]) == 0);
+  }
+  run_spawned_share(&share[0]);
+  for (int t = 1; t < nthreads; ++t) {
+    if (started[t]) pthread_join(thread[t], NULL);
+    else run_spawned_share(&share[t]);
+  }
+}
+
+static void run_serially(void *executor, int ntasks, void (*task)(void *arg, int i), void *arg) {
+  (void)executor;
+  for (int i = 0; i < ntasks; ++i) task(arg, i);
+}
+
+/* The time per item of large batches, and per batch of small ones, on the built-in pool and on application executors. */
+static void bench_executors(void) {
+  enum { NUM_EPOCHS = 20000, NUM_STARS = 200000, SMALL = 256, SMALL_RUNS = 2000 };
+  terse_alternate_iauEPOCHS tt = {2451545.0, 8000.0, 1.0 / 1440.0, NUM_EPOCHS};
+  double (*rbpn)[3][3] = malloc(NUM_EPOCHS * sizeof *rbpn);
+  double *rc = malloc(NUM_STARS * sizeof(double));
+  double *dc = malloc(NUM_STARS * sizeof(double));
+  double *ri = malloc(NUM_STARS * sizeof(double));
+  double *di = malloc(NUM_STARS * sizeof(double));
+  iauASTROM astrom;
+  double eo;
+  iauApci13(2456165.5, 0.401182685, &astrom, &eo);
+  for (int i = 0; i < NUM_STARS; ++i) {
+    rc[i] = 0.0003 * i;
+    dc[i] = -1.5 + 1.5e-5 * i;
+  }
+  int cpus = terse_alternate_iauNumCpus();
+  spawning_executor spawning = {cpus};
+  terse_alternate_iauEXECUTOR executors[] = {{NULL, NULL, 0}, {run_spawning, &spawning, cpus}, {run_serially, NULL, cpus}};
+  const char *names[] = {"built-in pool", "spawning", "serial"};
+  printf("\nExecutors, %d CPUs: terse_alternate_iauPnm06av of %d epochs, terse_alternate_iauAtciqv of %d stars, and of %d stars %d times.\n",
+      cpus, NUM_EPOCHS, NUM_STARS, SMALL, SMALL_RUNS);
+  for (int k = 0; k < 3; ++k) {
+    terse_alternate_iauSetExecutor(k ? &executors[k] : NULL);
+    terse_alternate_iauAtciqv(SMALL, 0, rc, dc, NULL, NULL, NULL, NULL, &astrom, ri, di);
+    double start = terse_alternate_now_ns();
+    terse_alternate_iauPnm06av(&tt, 0, rbpn);
+    double pnm = (terse_alternate_now_ns() - start) / NUM_EPOCHS;
+    start = terse_alternate_now_ns();
+    terse_alternate_iauAtciqv(NUM_STARS, 0, rc, dc, NULL, NULL, NULL, NULL, &astrom, ri, di);
+    double atciq = (terse_alternate_now_ns() - start) / NUM_STARS;
+    start = terse_alternate_now_ns();
+    for (int run = 0; run < SMALL_RUNS; ++run) {
+      terse_alternate_iauAtciqv(SMALL, 0, rc + run, dc, NULL, NULL, NULL, NULL, &astrom, ri, di);
+    }
+    double small = (terse_alternate_now_ns() - start) / SMALL_RUNS / 1000.0;
+    printf("%-34s %7.0f ns/epoch %7.1f ns/star %7.1f us/small batch\n", names[k], pnm, atciq, small);
+    sink += rbpn[NUM_EPOCHS - 1][0][0] + ri[0];
+  }
+  terse_alternate_iauSetExecutor(NULL);
+  free(rbpn); free(rc); free(dc); free(ri); free(di);
+}
+
+/* A request every 1 ms of simulated time, so about 1000 per context with a 1 s quantum. */
+static void call_cached_apco13(void *ctx, int i) {
+  iauASTROM astrom;
+  double eo;
+  terse_alternate_iauAstromCacheApco13(ctx, 2456384.5, 0.969254051 + 1e-3 * i / 86400.0, 0.1550675, -0.527800806, -1.2345856,
+      2738.0, 2.47230737e-7, 1.82640464e-6, 731.0, 12.8, 0.59, 0.55, &astrom, &eo);
+  sink += astrom.eral;
+}
+
+static void call_apco13(void *ctx, int i) {
+  iauASTROM astrom;
+  double eo;
+  (void)ctx;
+  iauApco13(2456384.5, 0.969254051 + 1e-3 * i / 86400.0, 0.1550675, -0.527800806, -1.2345856,
+      2738.0, 2.47230737e-7, 1.82640464e-6, 731.0, 12.8, 0.59, 0.55, &astrom, &eo);
+  sink += astrom.eral;
+}
+
+typedef struct {
+  terse_alternate_iauASTROMCACHE *cache;
+  double ns;
+} cache_client;
+
+static void *run_cache_client(void *arg) {
+  cache_client *c = arg;
+  c->ns = bench_ns_per_call(call_cached_apco13, c->cache, 200000);
+  return NULL;
+}
+
+/* iauApco13 against the shared cache, from one thread and from one per CPU asking for the same contexts. */
+static void bench_astrom_cache(void) {
+  enum { MAX_CLIENTS = 64 };
+  terse_alternate_iauASTROMCACHE *cache;
+  terse_alternate_iauASTROMCACHESTATS stats;
+  static cache_client client[MAX_CLIENTS];
+  pthread_t id[MAX_CLIENTS];
+  int n = terse_alternate_iauNumCpus() < MAX_CLIENTS ? terse_alternate_iauNumCpus() : MAX_CLIENTS;
+  printf("\nAstrometry context cache, 1 s quantum, a request per ms of simulated time.\n");
+  printf("%-34s %9.1f ns/call\n", "iauApco13", bench_ns_per_call(call_apco13, NULL, WARM_CALLS));
+  terse_alternate_iauAstromCacheNew(1024, 1.0, &cache);
+  printf("%-34s %9.1f ns/call (1 thread)\n", "cached", bench_ns_per_call(call_cached_apco13, cache, 200000));
+  terse_alternate_iauAstromCacheFree(cache);
+  terse_alternate_iauAstromCacheNew(1024, 1.0, &cache);
+  int started[MAX_CLIENTS];
+  for (int t = 0; t < n; ++t) {
+    client[t].cache = cache;
+    started[t] = (pthread_create(&id[t], NULL, run_cache_client, &client[t]) == 0);
+  }
+  double worst = 0.0;
+  for (int t = 0; t < n; ++t) {
+    if (started[t]) pthread_join(id[t], NULL);
+    else run_cache_client(&client[t]);
+    if (client[t].ns > worst) worst = client[t].ns;
+  }
+  terse_alternate_iauAstromCacheStats(cache, &stats);
+  printf("%-34s %9.1f ns/call (%d threads; %lld hits, %lld misses, %lld waits)\n", "cached", worst, n,
+      stats.hits, stats.misses, stats.waits);
+  terse_alternate_iauAstromCacheFree(cache);
+}
+
+/* The eclipse search over a millennium, on one thread and on one per CPU. */
+static void bench_eclipses(void) {
+  static terse_alternate_iauECLIPSE found[5000];
+  int cpus = terse_alternate_iauNumCpus();
+  printf("\nEclipse search, 1000 years from -3000 January 1.\n");
+  for (int k = 0; k < 2; ++k) {
+    double start = terse_alternate_now_ns();
+    int n = terse_alternate_iauEclipseSearch(625332.5, 0.0, 365242.5, IAU_ECLIPSE_SOLAR | IAU_ECLIPSE_LUNAR, k ? 0 : 1, 5000, found);
+    printf("%-34s %9.2f ms/century (%d threads, %d eclipses)\n", "terse_alternate_iauEclipseSearch", (terse_alternate_now_ns() - start) / 1e7,
+        k ? cpus : 1, n);
+  }
+}
+
+/* Run all of the benchmarks. */
+void terse_alternate_run_benchmarks(void) {
+  bench_packed_tables();
+  bench_nutation_stepper();
+  bench_reproducible_mode();
+  bench_timestamps();
+  bench_utc_intervals();
+  bench_epoch_propagation();
+  bench_ecliptic_batches();
+  bench_galactic_batches();
+  bench_sexagesimal_batches();
+  bench_tracker();
+  bench_accuracy_profiles();
+  bench_refraction();
+  bench_jacobians();
+  bench_c2t_rates();
+  bench_topocentric();
+  bench_executors();
+  bench_astrom_cache();
+  bench_eclipses();
+  free(sweep_buffer);
+  sweep_buffer = NULL;
+}
@@ -0,0 +1,281 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ The celestial-to-terrestrial matrix with its time derivative, in a single pass, implemented in C99.
+
+ Velocities in the ITRS convert to the GCRS (and back) through the rate of the matrix as well as the matrix:
+ v_gcrs = rc2t^T v_itrs + rc2tdot^T r_itrs. Differencing two calls of iauC2t06a doubles the cost and, from
+ matrices of unit size, keeps few significant digits of a rate dominated by the Earth's rotation.
+
+ Here every factor of rc2t = RPOM * R3(ERA) * RC2I carries its rate with it, through the same calls as
+ iauC2t06a, so the matrices are identical to its own:
+
+   RC2I   the bias-precession-nutation matrix of iauPnm06a: the polynomial angles of iauPfw06 and the packed
+          IAU 2000A nutation series, differentiated term by term, through the rotations of iauFw2m; then the
+          CIP X,Y from it, s from iauS06 (its rate from that of -XY/2, and a central difference of the small,
+          slow remainder of the series), and the closed form of iauC2ixys.
+   R3     the Earth rotation angle, whose rate is 2pi * 1.00273781191135448 per day.
+   RPOM   the polar motion, whose rates xpdot, ypdot are given (the IERS publishes them with xp, yp), and s'.
+
+ The rates are the exact derivatives of the model, for about the cost of one iauC2t06a. All rates are per
+ day: for the slow terms, TT and UT1 days are the same.
+*/
+
+/* The Earth rotation angle's rate (radians per UT1 day), as in iauEra00. */
+static const double ERA_RATE = D2PI * 1.00273781191135448;
+
+/* The rates (radians per Julian century) of the arguments of terse_alternate_nut00a_ls_args, at t (Julian centuries). */
+static void nut00a_ls_arg_rates(double t, double fadot[5]) {
+   fadot[0] = (1717915923.2178 + t * (2.0 * 31.8792 + t * (3.0 * 0.051635 + t * (4.0 * -0.00024470)))) * DAS2R;
+   fadot[1] = (129596581.0481 + t * (2.0 * -0.5532 + t * (3.0 * 0.000136 + t * (4.0 * -0.00001149)))) * DAS2R;
+   fadot[2] = (1739527262.8478 + t * (2.0 * -12.7512 + t * (3.0 * -0.001037 + t * (4.0 * 0.00000417)))) * DAS2R;
+   fadot[3] = (1602961601.2090 + t * (2.0 * -6.3706 + t * (3.0 * 0.006593 + t * (4.0 * -0.00003169)))) * DAS2R;
+   fadot[4] = (-6962890.5431 + t * (2.0 * 7.4722 + t * (3.0 * 0.007702 + t * (4.0 * -0.00005939)))) * DAS2R;
+}
+
+/* The rates (radians per Julian century) of the arguments of terse_alternate_nut00a_pl_args, at t (Julian centuries). */
+static void nut00a_pl_arg_rates(double t, double fadot[13]) {
+   static const double rates[12] = {
+      8328.6914269554, 8433.466158131, 7771.3771468121, -33.757045, 2608.7903141574, 1021.3285546211,
+      628.3075849991, 334.0612426700, 52.9690962641, 21.3299104960, 7.4781598567, 3.8127774000
+   };
+   for (int i = 0; i < 12; i++) fadot[i] = rates[i];
+   fadot[12] = 0.024381750 + 2.0 * 0.00000538691 * t;
+}
+
+/*
+ The nutation dpsi, deps (radians), identical to that of iauNut00a, and its rates dpsidot, depsdot (radians
+ per day), in one pass over the packed series of terse_alternate_iauNut00aPacked. Given the TT date1+date2.
+*/
+void terse_alternate_iauNut00aDot(double date1, double date2, double *dpsi, double *deps, double *dpsidot, double *depsdot) {
+   //Units of 0.1 microarcsecond to radians
+   const double U2R = DAS2R / 1e7;
+   double fa[13], fadot[13];
+   double t = ((date1 - DJ00) + date2) / DJC;
+
+   //Luni-solar nutation, as in terse_alternate_iauNut00aPacked, with the derivative of each term.
+   terse_alternate_nut00a_ls_args(t, fa);
+   nut00a_ls_arg_rates(t, fadot);
+   double dp = 0.0, de = 0.0, dpd = 0.0, ded = 0.0;
+   for (int i = 0; i < NUT_LS_N; i++) {
+      const signed char *m = terse_alternate_nut_ls_mult[i];
+      double arg = terse_alternate_nut00a_ls_arg(i, fa);
+      double argdot = (double)m[0] * fadot[0] + (double)m[1] * fadot[1] + (double)m[2] * fadot[2]
+          + (double)m[3] * fadot[3] + (double)m[4] * fadot[4];
+      double sarg = sin(arg);
+      double carg = cos(arg);
+      double sp = (double)terse_alternate_nut_ls_sp[i] + (double)terse_alternate_nut_ls_spt[i] * t;
+      double ce = (double)terse_alternate_nut_ls_ce[i] + (double)terse_alternate_nut_ls_cet[i] * t;
+      dp += sp * sarg + (double)terse_alternate_nut_ls_cp[i] * carg;
+      de += ce * carg + (double)terse_alternate_nut_ls_se[i] * sarg;
+      dpd += argdot * (sp * carg - (double)terse_alternate_nut_ls_cp[i] * sarg) + (double)terse_alternate_nut_ls_spt[i] * sarg;
+      ded += argdot * ((double)terse_alternate_nut_ls_se[i] * carg - ce * sarg) + (double)terse_alternate_nut_ls_cet[i] * carg;
+   }
+   double dpsils = dp * U2R, depsls = de * U2R;
+   double dpsilsd = dpd * U2R, depslsd = ded * U2R;
+
+   //Planetary nutation.
+   terse_alternate_nut00a_pl_args(t, fa);
+   nut00a_pl_arg_rates(t, fadot);
+   dp = de = dpd = ded = 0.0;
+   for (int i = 0; i < NUT_PL_N; i++) {
+      const signed char *m = terse_alternate_nut_pl_mult[i];
+      double arg = terse_alternate_nut00a_pl_arg(i, fa);
+      double argdot = 0.0;
+      for (int j = 0; j < 13; j++) argdot += (double)m[j] * fadot[j];
+      double sarg = sin(arg);
+      double carg = cos(arg);
+      dp += (double)terse_alternate_nut_pl_sp[i] * sarg + (double)terse_alternate_nut_pl_cp[i] * carg;
+      de += (double)terse_alternate_nut_pl_se[i] * sarg + (double)terse_alternate_nut_pl_ce[i] * carg;
+      dpd += argdot * ((double)terse_alternate_nut_pl_sp[i] * carg - (double)terse_alternate_nut_pl_cp[i] * sarg);
+      ded += argdot * ((double)terse_alternate_nut_pl_se[i] * carg - (double)terse_alternate_nut_pl_ce[i] * sarg);
+   }
+   double dpsipl = dp * U2R, depspl = de * U2R;
+
+   *dpsi = dpsils + dpsipl;
+   *deps = depsls + depspl;
+   *dpsidot = (dpsilsd + dpd * U2R) / DJC;
+   *depsdot = (depslsd + ded * U2R) / DJC;
+}
+
+/*
+ The rate (radians per day) of the CIO locator s of iauS06, at the TT date1+date2, given the CIP X,Y and
+ their rates (radians, radians per day).
+*/
+static double s06_rate(double date1, double date2, double x, double y, double xdot, double ydot) {
+   //s + XY/2 is iauS06 with X = Y = 0: a few mas in all, with periods of 13.66 days at the shortest, so its
+   //central difference over 0.1 day is good to about 1e-15 radians per day (h^2 w^3 A / 6, for the 2 uas
+   //fortnightly terms)
+   const double h = 0.1;
+   double series_rate = (iauS06(date1, date2 + h, 0.0, 0.0) - iauS06(date1, date2 - h, 0.0, 0.0)) / (2.0 * h);
+   return -0.5 * (xdot * y + x * ydot) + series_rate;
+}
+
+/*
+ Apply the rotation theta about the axis (0 x, 1 y, 2 z), with the rate thetadot, to the matrix r and its
+ rate rdot, as iauRx, iauRy or iauRz do: rdot becomes R(theta) rdot + thetadot W R(theta) r.
+*/
+static void rotate_rate(int axis, double theta, double thetadot, double r[3][3], double rdot[3][3]) {
+   //dR/dtheta = W R, where W moves row j of R to row i, and minus row i to row j
+   static const int I[3] = {1, 2, 0}, J[3] = {2, 0, 1};
+   void (*rotate)(double, double[3][3]) = (axis == 0) ? iauRx : (axis == 1) ? iauRy : iauRz;
+   rotate(theta, r);
+   rotate(theta, rdot);
+   int i = I[axis], j = J[axis];
+   for (int k = 0; k < 3; k++) {
+      rdot[i][k] += thetadot * r[j][k];
+      rdot[j][k] -= thetadot * r[i][k];
+   }
+}
+
+/*
+ iauC2ixys with rates: the celestial-to-intermediate matrix rc2i of iauC2ixys(x, y, s), and its rate rc2idot,
+ given the rates xdot, ydot, sdot (radians per day).
+*/
+void terse_alternate_iauC2ixysDot(double x, double y, double s, double xdot, double ydot, double sdot,
+    double rc2i[3][3], double rc2idot[3][3]) {
+   iauC2ixys(x, y, s, rc2i);
+
+   //rc2i = R3(-s) N, with N in closed form (free of the singularity of E at the pole), a = 1 / (1 + Z)
+   double r2 = x * x + y * y, r2dot = 2.0 * (x * xdot + y * ydot);
+   double z = sqrt(1.0 - r2);
+   double a = 1.0 / (1.0 + z);
+   double adot = a * a * r2dot / (2.0 * z);
+   double ndot[3][3] = {
+      { -adot * x * x - 2.0 * a * x * xdot, -adot * x * y - a * (xdot * y + x * ydot), -xdot },
+      { -adot * x * y - a * (xdot * y + x * ydot), -adot * y * y - 2.0 * a * y * ydot, -ydot },
+      { xdot, ydot, -adot * r2 - a * r2dot }
+   };
+   iauRz(-s, ndot);
+   for (int k = 0; k < 3; k++) {
+      rc2idot[0][k] = ndot[0][k] - sdot * rc2i[1][k];
+      rc2idot[1][k] = ndot[1][k] + sdot * rc2i[0][k];
+      rc2idot[2][k] = ndot[2][k];
+   }
+}
+
+/*
+ The bias-precession-nutation matrix rbpn, identical to that of iauPnm06a, and its rate rbpndot (per day),
+ at the TT date1+date2: the Fukushima-Williams angles of iauPfw06 and the nutation of iauNut06a, with their
+ rates, through the rotations of iauFw2m.
+*/
+void terse_alternate_iauPnm06aDot(double date1, double date2, double rbpn[3][3], double rbpndot[3][3]) {
+   double gamb, phib, psib, epsa, dp, de, dpdot, dedot;
+   double t = ((date1 - DJ00) + date2) / DJC;
+   iauPfw06(date1, date2, &gamb, &phib, &psib, &epsa);
+   double gambdot = (10.556378 + (2.0 * 0.4932044 + (3.0 * -0.00031238 + (4.0 * -0.000002788
+       + (5.0 * 0.0000000260) * t) * t) * t) * t) * DAS2R / DJC;
+   double phibdot = (-46.811016 + (2.0 * 0.0511268 + (3.0 * 0.00053289 + (4.0 * -0.000000440
+       + (5.0 * -0.0000000176) * t) * t) * t) * t) * DAS2R / DJC;
+   double psibdot = (5038.481484 + (2.0 * 1.5584175 + (3.0 * -0.00018522 + (4.0 * -0.000026452
+       + (5.0 * -0.0000000148) * t) * t) * t) * t) * DAS2R / DJC;
+   double epsadot = (-46.836769 + (2.0 * -0.0001831 + (3.0 * 0.00200340 + (4.0 * -0.000000576
+       + (5.0 * -0.0000000434) * t) * t) * t) * t) * DAS2R / DJC;
+
+   //iauNut06a: the IAU 2000A nutation, adjusted for the IAU 2006 precession
+   double dpsi, deps;
+   terse_alternate_iauNut00aDot(date1, date2, &dpsi, &deps, &dpdot, &dedot);
+   double fj2 = -2.7774e-6 * t, fj2dot = -2.7774e-6 / DJC;
+   dp = dpsi + dpsi * (0.4697e-6 + fj2);
+   de = deps + deps * fj2;
+   dpdot = dpdot * (1.0 + 0.4697e-6 + fj2) + dpsi * fj2dot;
+   dedot = dedot * (1.0 + fj2) + deps * fj2dot;
+
+   //iauFw2m(gamb, phib, psib + dp, epsa + de)
+   iauIr(rbpn);
+   iauZr(rbpndot);
+   rotate_rate(2, gamb, gambdot, rbpn, rbpndot);
+   rotate_rate(0, phib, phibdot, rbpn, rbpndot);
+   rotate_rate(2, -(psib + dp), -(psibdot + dpdot), rbpn, rbpndot);
+   rotate_rate(0, -(epsa + de), -(epsadot + dedot), rbpn, rbpndot);
+}
+
+/*
+ The celestial-to-intermediate matrix rc2i, identical to that of iauC2i06a, and its rate rc2idot (per day),
+ at the TT date1+date2.
+*/
+void terse_alternate_iauC2i06aDot(double date1, double date2, double rc2i[3][3], double rc2idot[3][3]) {
+   double rbpn[3][3], rbpndot[3][3], x, y;
+   terse_alternate_iauPnm06aDot(date1, date2, rbpn, rbpndot);
+   iauBpn2xy(rbpn, &x, &y);
+   double xdot = rbpndot[2][0], ydot = rbpndot[2][1];
+   terse_alternate_iauC2ixysDot(x, y, iauS06(date1, date2, x, y), xdot, ydot, s06_rate(date1, date2, x, y, xdot, ydot),
+       rc2i, rc2idot);
+}
+
+/*
+ iauPom00 with rates: the polar-motion matrix rpom of iauPom00(xp, yp, sp), and its rate rpomdot, given the
+ rates xpdot, ypdot, spdot (radians per day).
+*/
+void terse_alternate_iauPom00Dot(double xp, double yp, double sp, double xpdot, double ypdot, double spdot,
+    double rpom[3][3], double rpomdot[3][3]) {
+   iauIr(rpom);
+   iauZr(rpomdot);
+   rotate_rate(2, sp, spdot, rpom, rpomdot);
+   rotate_rate(1, -xp, -xpdot, rpom, rpomdot);
+   rotate_rate(0, -yp, -ypdot, rpom, rpomdot);
+}
+
+/*
+ iauC2tcio with rates: the celestial-to-terrestrial matrix rc2t = rpom * R3(era) * rc2i of iauC2tcio, and its
+ rate rc2tdot, from the factors and their rates (per day).
+*/
+void terse_alternate_iauC2tcioDot(double rc2i[3][3], double rc2idot[3][3], double era, double eradot,
+    double rpom[3][3], double rpomdot[3][3], double rc2t[3][3], double rc2tdot[3][3]) {
+   double r[3][3], rdot[3][3], w1[3][3], w2[3][3];
+   iauCr(rc2i, r);
+   iauCr(rc2idot, rdot);
+   rotate_rate(2, era, eradot, r, rdot);
+   iauRxr(rpom, r, rc2t);
+   iauRxr(rpomdot, r, w1);
+   iauRxr(rpom, rdot, w2);
+   for (int i = 0; i < 3; i++) {
+      for (int k = 0; k < 3; k++) rc2tdot[i][k] = w1[i][k] + w2[i][k];
+   }
+}
+
+/*
+ The celestial-to-terrestrial matrix rc2t, identical to that of iauC2t06a, and its rate rc2tdot (per day), in
+ a single pass. Given tta+ttb (TT) and uta+utb (UT1) as for iauC2t06a, the polar motion xp, yp
+ (radians) and its rates xpdot, ypdot (radians per day; 0 if not known).
+*/
+void terse_alternate_iauC2t06aDot(double tta, double ttb, double uta, double utb, double xp, double yp,
+    double xpdot, double ypdot, double rc2t[3][3], double rc2tdot[3][3]) {
+   double rc2i[3][3], rc2idot[3][3], rpom[3][3], rpomdot[3][3];
+   terse_alternate_iauC2i06aDot(tta, ttb, rc2i, rc2idot);
+   //s' = -47 microarcsec per century
+   terse_alternate_iauPom00Dot(xp, yp, iauSp00(tta, ttb), xpdot, ypdot, -47e-6 * DAS2R / DJC, rpom, rpomdot);
+   terse_alternate_iauC2tcioDot(rc2i, rc2idot, iauEra00(uta, utb), ERA_RATE, rpom, rpomdot, rc2t, rc2tdot);
+}
+
+/*
+ terse_alternate_iauC2t06aDot over the epochs of tt (TT) and ut1 (UT1), which have the same count, with the same polar
+ motion and its rates: rc2t[i] and rc2tdot[i] at epoch i, as terse_alternate_iauC2t06av does the matrices alone.
+ In the reproducible mode, as for terse_alternate_iauC2t06av, the Earth rotation angle is computed by iauEra00 at every
+ epoch, and the results are identical to those of terse_alternate_iauC2t06aDot.
+*/
+void terse_alternate_iauC2t06aDotv(const terse_alternate_iauEPOCHS *tt, const terse_alternate_iauEPOCHS *ut1, double xp, double yp, double xpdot, double ypdot,
+    double rc2t[][3][3], double rc2tdot[][3][3]) {
+   //the whole days of i*step drop out of the Earth rotation angle, as in terse_alternate_iauC2t06av
+   double era0 = iauEra00(ut1->date1, ut1->date2);
+   double step_fraction = fmod(ut1->step, 1.0);
+   double spdot = -47e-6 * DAS2R / DJC;
+   int reproducible = terse_alternate_iauIsReproducible();
+
+   for (int i = 0; i < tt->n; ++i) {
+      double d1, d2, u1, u2, era, rc2i[3][3], rc2idot[3][3], rpom[3][3], rpomdot[3][3];
+      terse_alternate_iauEpochAt(tt, i, &d1, &d2);
+      terse_alternate_iauC2i06aDot(d1, d2, rc2i, rc2idot);
+      if (reproducible) {
+         terse_alternate_iauEpochAt(ut1, i, &u1, &u2);
+         era = iauEra00(u1, u2);
+      } else {
+         double turns = fmod(i * step_fraction, 1.0) + fmod(i * ut1->step * 0.00273781191135448, 1.0);
+         era = iauAnp(era0 + D2PI * turns);
+      }
+      terse_alternate_iauPom00Dot(xp, yp, iauSp00(d1, d2), xpdot, ypdot, spdot, rpom, rpomdot);
+      terse_alternate_iauC2tcioDot(rc2i, rc2idot, era, ERA_RATE, rpom, rpomdot, rc2t[i], rc2tdot[i]);
+   }
+}
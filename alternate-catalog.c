@@ -0,0 +1,341 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ A columnar, memory-mapped star catalog, laid out for the batch functions, implemented in C99.
+
+ Catalog jobs usually start by parsing text into arrays for iauStarpm, iauAtciq and the like.
+ Instead, the text is imported once into a binary file of columns, and readers map the file into memory:
+ the columns are then arrays, in place in the mapping, that the batch functions read with no copying.
+ As with the almanac, processes start instantly, and all of them on one host share the same pages.
+
+ Import a catalog with:
+   ./run_tests.exe catalog <text file> <catalog file> [<stars per block>]
+ The text has a star per line: ra, dec (radians), pmr, pmd (radians/year), px (arcsec), rv (km/s), the units
+ of iauStarpm; blank lines and lines starting with '#' are skipped. The tool sorts the stars by position.
+
+ The file is:
+   - a 128-byte header: magic "SOFACAT", format version, flags, count, block size, number of blocks,
+     the offset of each column, and a checksum.
+   - the columns, each starting on a 64-byte boundary (a cache line, and the widest SIMD load):
+       ra, dec, pmr, pmd, px, rv     doubles, in the units of iauStarpm
+       ux, uy, uz                    doubles, the unit vector of (ra, dec) from iauS2c (optional)
+       index                         64-bit integers, the row of each star in the imported data
+       bounds                        4 doubles per block: min and max RA (0-2pi), min and max Dec
+   The numbers are in the byte order of the host that wrote the file; a reader on a host with a different
+   byte order rejects the file. The checksum is the 64-bit FNV-1a hash of the whole file, with the checksum
+   in the header as zero.
+
+ The bounds of each block let a search by sky region skip whole blocks, without touching their pages.
+ That works best when neighbouring stars are neighbours in the file, so the writer can sort the stars:
+ by zones of Dec, and by RA within each zone.
+*/
+
+static const char CATALOG_MAGIC[8] = {'S', 'O', 'F', 'A', 'C', 'A', 'T', '\0'};
+static const int CATALOG_VERSION = 2;
+static const size_t COLUMN_ALIGNMENT = 64;
+
+/* The height of the zones of Dec that sorted catalogs are ordered by (radians). */
+static const double ZONE_HEIGHT = 0.25 * DD2R;
+
+enum { C_RA, C_DEC, C_PMR, C_PMD, C_PX, C_RV, C_UX, C_UY, C_UZ, C_INDEX, C_BOUNDS, NUM_COLUMNS };
+
+typedef struct {
+  char magic[8];
+  int version;
+  int flags;
+  int count;
+  int block_size;
+  int num_blocks;
+  int reserved;
+  long long offsets[NUM_COLUMNS];   //from the start of the file; 0 for a column that isn't there
+  unsigned long long checksum;
+} catalog_header;
+
+static size_t align_up(size_t size) {
+  return (size + COLUMN_ALIGNMENT - 1) / COLUMN_ALIGNMENT * COLUMN_ALIGNMENT;
+}
+
+/* Write size bytes, then zeros up to the next column boundary. Returns 0, or -1 for an I/O error. */
+static int write_column(FILE *file, const void *data, size_t size, unsigned long long *hash) {
+  static const unsigned char zeros[64] = {0};
+  size_t padding = align_up(size) - size;
+  if (size > 0 && fwrite(data, size, 1, file) != 1) return -1;
+  if (padding > 0 && fwrite(zeros, padding, 1, file) != 1) return -1;
+  //FNV-1a is sequential, so the hash of the whole can be built up a piece at a time
+  const unsigned char *bytes = data;
+  for (size_t i = 0; i < size; ++i) {
+    *hash ^= bytes[i];
+    *hash *= 1099511628211ULL;
+  }
+  for (size_t i = 0; i < padding; ++i) {
+    *hash *= 1099511628211ULL; //xor with a zero byte changes nothing
+  }
+  return 0;
+}
+
+typedef struct {
+  long long zone;
+  double ra;
+  long long row;
+} sort_key;
+
+static int compare_keys(const void *a, const void *b) {
+  const sort_key *ka = a, *kb = b;
+  if (ka->zone != kb->zone) return (ka->zone < kb->zone) ? -1 : 1;
+  if (ka->ra != kb->ra) return (ka->ra < kb->ra) ? -1 : 1;
+  return (ka->row < kb->row) ? -1 : (ka->row > kb->row);
+}
+
+/*
+ Write a catalog of the stars, in blocks of block_size (0 for 4096).
+ The flags are IAU_CATALOG_UNIT_VECTORS, to store the unit vectors, and IAU_CATALOG_SORT, to sort the stars
+ by position (the index column keeps their rows in the given arrays).
+ Returns 0 for success, -1 for bad arguments, -2 for an I/O error (or lack of memory).
+*/
+int terse_alternate_iauCatalogWrite(const char *path, const terse_alternate_iauCSTARS *stars, int block_size, int flags) {
+  int n = stars->n;
+  if (n < 1 || block_size < 0) return -1;
+  if (block_size == 0) block_size = 4096;
+  int num_blocks = (n + block_size - 1) / block_size;
+
+  //the order of the rows, and the columns in that order
+  long long *index = malloc((size_t)n * sizeof(long long));
+  double *columns = malloc((size_t)n * 9 * sizeof(double));
+  double (*bounds)[4] = malloc((size_t)num_blocks * sizeof *bounds);
+  sort_key *keys = (flags & IAU_CATALOG_SORT) ? malloc((size_t)n * sizeof(sort_key)) : NULL;
+  if (index == NULL || columns == NULL || bounds == NULL || ((flags & IAU_CATALOG_SORT) && keys == NULL)) {
+    free(index); free(columns); free(bounds); free(keys);
+    return -2;
+  }
+  for (int i = 0; i < n; ++i) index[i] = i;
+  if (keys != NULL) {
+    for (int i = 0; i < n; ++i) {
+      keys[i].zone = (long long)floor((stars->dec[i] + DPI / 2.0) / ZONE_HEIGHT);
+      keys[i].ra = iauAnp(stars->ra[i]);
+      keys[i].row = i;
+    }
+    qsort(keys, (size_t)n, sizeof(sort_key), compare_keys);
+    for (int i = 0; i < n; ++i) index[i] = keys[i].row;
+    free(keys);
+  }
+  const double *source[6] = {stars->ra, stars->dec, stars->pmr, stars->pmd, stars->px, stars->rv};
+  for (int i = 0; i < n; ++i) {
+    long long row = index[i];
+    double u[3];
+    for (int c = 0; c < 6; ++c) columns[(size_t)c * n + i] = source[c][row];
+    iauS2c(stars->ra[row], stars->dec[row], u);
+    for (int c = 0; c < 3; ++c) columns[(size_t)(C_UX + c) * n + i] = u[c];
+  }
+  for (int b = 0; b < num_blocks; ++b) {
+    bounds[b][0] = bounds[b][2] = HUGE_VAL;
+    bounds[b][1] = bounds[b][3] = -HUGE_VAL;
+    for (int i = b * block_size; i < n && i < (b + 1) * block_size; ++i) {
+      double ra = iauAnp(columns[(size_t)C_RA * n + i]), dec = columns[(size_t)C_DEC * n + i];
+      bounds[b][0] = fmin(bounds[b][0], ra);
+      bounds[b][1] = fmax(bounds[b][1], ra);
+      bounds[b][2] = fmin(bounds[b][2], dec);
+      bounds[b][3] = fmax(bounds[b][3], dec);
+    }
+  }
+
+  catalog_header header;
+  memset(&header, 0, sizeof header);
+  memcpy(header.magic, CATALOG_MAGIC, sizeof header.magic);
+  header.version = CATALOG_VERSION;
+  header.flags = flags & IAU_CATALOG_UNIT_VECTORS;
+  header.count = n;
+  header.block_size = block_size;
+  header.num_blocks = num_blocks;
+  size_t offset = align_up(sizeof header);
+  for (int c = 0; c < NUM_COLUMNS; ++c) {
+    size_t size = (c == C_BOUNDS) ? (size_t)num_blocks * sizeof *bounds : (size_t)n * sizeof(double);
+    if (c >= C_UX && c <= C_UZ && !(flags & IAU_CATALOG_UNIT_VECTORS)) continue;
+    header.offsets[c] = (long long)offset;
+    offset += align_up(size);
+  }
+
+  //the checksum goes in the header, so the header is written last; it is hashed first, with the checksum as zero
+  int status = 0;
+  static const unsigned char zeros[128] = {0};
+  size_t header_space = align_up(sizeof header);
+  unsigned long long hash = terse_alternate_fnv1a64_more(terse_alternate_fnv1a64(&header, sizeof header), zeros, header_space - sizeof header);
+  FILE *file = fopen(path, "wb");
+  if (file == NULL) {
+    status = -2;
+  } else {
+    if (fwrite(zeros, header_space, 1, file) != 1) status = -2;
+    for (int c = 0; c < NUM_COLUMNS && status == 0; ++c) {
+      if (header.offsets[c] == 0) continue;
+      const void *data = (c == C_INDEX) ? (const void *)index : (c == C_BOUNDS) ? (const void *)bounds
+          : (const void *)&columns[(size_t)c * n];
+      size_t size = (c == C_BOUNDS) ? (size_t)num_blocks * sizeof *bounds : (size_t)n * sizeof(double);
+      if (write_column(file, data, size, &hash) != 0) status = -2;
+    }
+    header.checksum = hash;
+    if (status == 0 && (fseek(file, 0, SEEK_SET) != 0 || fwrite(&header, sizeof header, 1, file) != 1)) status = -2;
+    if (fclose(file) != 0) status = -2;
+  }
+  free(index);
+  free(columns);
+  free(bounds);
+  return status;
+}
+
+/*
+ Map a catalog into memory. If verify is non-zero, the checksum is checked (which reads every page).
+ Returns 0 for success, -1 if the file can't be mapped, -2 if it isn't a catalog of this version
+ (or was written on a host with a different byte order), -3 for a bad checksum.
+*/
+int terse_alternate_iauCatalogOpen(const char *path, int verify, terse_alternate_iauCATALOG *catalog) {
+  if (terse_alternate_map_file(path, &catalog->mapping) != 0) return -1;
+  const catalog_header *header = catalog->mapping.base;
+  const char *base = catalog->mapping.base;
+  size_t size = catalog->mapping.size;
+  int ok = size >= align_up(sizeof *header) && memcmp(header->magic, CATALOG_MAGIC, sizeof header->magic) == 0 &&
+      header->version == CATALOG_VERSION && header->count > 0 && header->block_size > 0 &&
+      header->num_blocks == (header->count + header->block_size - 1) / header->block_size;
+  for (int c = 0; ok && c < NUM_COLUMNS; ++c) {
+    size_t column_size = (c == C_BOUNDS) ? (size_t)header->num_blocks * 4 * sizeof(double)
+        : (size_t)header->count * sizeof(double);
+    long long offset = header->offsets[c];
+    int optional = (c >= C_UX && c <= C_UZ && !(header->flags & IAU_CATALOG_UNIT_VECTORS));
+    if (optional) {
+      ok = (offset == 0);
+    } else {
+      ok = offset > 0 && offset % (long long)COLUMN_ALIGNMENT == 0 && (size_t)offset + column_size <= size;
+    }
+  }
+  if (!ok) {
+    terse_alternate_unmap_file(&catalog->mapping);
+    return -2;
+  }
+  catalog->n = header->count;
+  catalog->block_size = header->block_size;
+  catalog->num_blocks = header->num_blocks;
+  catalog->ra = (const double *)(base + header->offsets[C_RA]);
+  catalog->dec = (const double *)(base + header->offsets[C_DEC]);
+  catalog->pmr = (const double *)(base + header->offsets[C_PMR]);
+  catalog->pmd = (const double *)(base + header->offsets[C_PMD]);
+  catalog->px = (const double *)(base + header->offsets[C_PX]);
+  catalog->rv = (const double *)(base + header->offsets[C_RV]);
+  for (int c = 0; c < 3; ++c) {
+    catalog->u[c] = header->offsets[C_UX + c] ? (const double *)(base + header->offsets[C_UX + c]) : NULL;
+  }
+  catalog->index = (const long long *)(base + header->offsets[C_INDEX]);
+  catalog->bounds = (const double (*)[4])(base + header->offsets[C_BOUNDS]);
+  catalog_header unsummed = *header;
+  unsummed.checksum = 0;
+  unsigned long long hash = terse_alternate_fnv1a64_more(terse_alternate_fnv1a64(&unsummed, sizeof unsummed), base + sizeof *header, size - sizeof *header);
+  if (verify && hash != header->checksum) {
+    terse_alternate_iauCatalogClose(catalog);
+    return -3;
+  }
+  return 0;
+}
+
+void terse_alternate_iauCatalogClose(terse_alternate_iauCATALOG *catalog) {
+  terse_alternate_unmap_file(&catalog->mapping);
+  catalog->n = 0;
+  catalog->num_blocks = 0;
+}
+
+/* Whether the RA interval [lo, hi] (radians, any range, hi - lo < 2pi) overlaps [a, b] within 0-2pi. */
+static int ra_overlaps(double lo, double hi, double a, double b) {
+  double shift = lo - iauAnp(lo);
+  lo -= shift;
+  hi -= shift;
+  return (lo <= b && hi >= a) || (lo - D2PI <= b && hi - D2PI >= a);
+}
+
+/*
+ The blocks that may hold stars within radius (radians) of (ra, dec): their numbers go into blocks[]
+ (which has room for catalog->num_blocks), in order. The blocks that aren't listed hold no such stars.
+ The stars of a block are those from block*block_size, up to block_size of them. Returns the number of blocks.
+*/
+int terse_alternate_iauCatalogCone(const terse_alternate_iauCATALOG *catalog, double ra, double dec, double radius, int blocks[]) {
+  radius += 1e-12; //for rounding, at the edge of the cone
+  double dec_lo = dec - radius, dec_hi = dec + radius;
+  //the half-width of the cone in RA, unless it includes a pole
+  int all_ra = dec_hi >= DPI / 2.0 || dec_lo <= -DPI / 2.0 || radius >= DPI / 2.0;
+  double half_width = all_ra ? DPI : asin(sin(radius) / cos(dec));
+  int count = 0;
+  for (int b = 0; b < catalog->num_blocks; ++b) {
+    const double *box = catalog->bounds[b];
+    if (box[3] < dec_lo || box[2] > dec_hi) continue;
+    if (!all_ra && !ra_overlaps(ra - half_width, ra + half_width, box[0], box[1])) continue;
+    blocks[count++] = b;
+  }
+  return count;
+}
+
+/* The stars from begin up to end, as a terse_alternate_iauCSTARS for the batch functions; the arrays are in place in the mapping. */
+void terse_alternate_iauCatalogStars(const terse_alternate_iauCATALOG *catalog, int begin, int end, terse_alternate_iauCSTARS *stars) {
+  stars->n = end - begin;
+  stars->ra = catalog->ra + begin;
+  stars->dec = catalog->dec + begin;
+  stars->pmr = catalog->pmr + begin;
+  stars->pmd = catalog->pmd + begin;
+  stars->px = catalog->px + begin;
+  stars->rv = catalog->rv + begin;
+}
+
+/*
+ Import a text catalog: a star per line, ra dec pmr pmd px rv, in the units of iauStarpm; blank lines and
+ lines starting with '#' are skipped. The flags and block size are as for terse_alternate_iauCatalogWrite.
+ Returns the number of stars, or -1 if the text can't be read, -2 for an I/O error, or -(line number + 2)
+ for a line that isn't a star.
+*/
+int terse_alternate_iauCatalogImport(const char *text_path, const char *path, int block_size, int flags) {
+  FILE *text = fopen(text_path, "r");
+  if (text == NULL) return -1;
+  int n = 0, capacity = 0, status = 0, line_number = 0;
+  double *columns[6] = {NULL};
+  char line[512];
+  while (status == 0 && fgets(line, sizeof line, text) != NULL) {
+    ++line_number;
+    char *p = line;
+    while (*p == ' ' || *p == '\t') ++p;
+    if (*p == '#' || *p == '\n' || *p == '\r' || *p == '\0') continue;
+    if (n == capacity) {
+      capacity = (capacity == 0) ? 1024 : 2 * capacity;
+      for (int c = 0; c < 6; ++c) {
+        double *grown = realloc(columns[c], (size_t)capacity * sizeof(double));
+        if (grown == NULL) status = -2;
+        else columns[c] = grown;
+      }
+      if (status != 0) break;
+    }
+    for (int c = 0; c < 6; ++c) {
+      char *end;
+      columns[c][n] = strtod(p, &end);
+      if (end == p) status = -(line_number + 2);
+      p = end;
+    }
+    ++n;
+  }
+  fclose(text);
+  if (status == 0 && n == 0) status = -1;
+  if (status == 0) {
+    terse_alternate_iauCSTARS stars = {n, columns[0], columns[1], columns[2], columns[3], columns[4], columns[5]};
+    status = terse_alternate_iauCatalogWrite(path, &stars, block_size, flags);
+  }
+  for (int c = 0; c < 6; ++c) free(columns[c]);
+  return (status == 0) ? n : status;
+}
+
+/* The command-line tool: catalog <text file> <catalog file> [<stars per block>]. */
+int terse_alternate_run_catalog_tool(int argc, char *argv[]) {
+  if (argc < 4) {
+    printf("Usage: catalog <text file> <catalog file> [<stars per block>]\n");
+    return 1;
+  }
+  int block_size = (argc > 4) ? atoi(argv[4]) : 0;
+  int status = terse_alternate_iauCatalogImport(argv[2], argv[3], block_size, IAU_CATALOG_UNIT_VECTORS | IAU_CATALOG_SORT);
+  printf("%s: %d stars. Status %d.\n", argv[3], status > 0 ? status : 0, status > 0 ? 0 : status);
+  return status > 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#include <cmath>
+#include <cstdio>
+#include "sofa.h"
+#include "alternate-constexpr.hpp"
+
+extern "C" int terse_alternate_iauCal2jd(int iy, int im, int id, double *djm0, double *djm);
+
+/*
+ Tests for alternate-constexpr.hpp: the constexpr functions must agree with the C functions.
+ See alternate-constexpr.hpp for how to build and run them.
+*/
+
+static int num_errors = 0;
+static int num_successful = 0;
+
+static const char *SUCCESS = "OK";
+static const char *FAILURE = " X";
+
+/* These are evaluated by the compiler; the build fails if they can't be. */
+constexpr auto SITE = terse_alternate_cx::gd2gc(1, -0.527800806, -1.2345856, 2738.0);
+static_assert(SITE.status == 0, "gd2gc at compile time");
+static_assert(terse_alternate_cx::cal2jd(2003, 6, 1).djm == 52791.0, "cal2jd at compile time");
+static_assert(terse_alternate_cx::alternate_cal2jd(-10000, 3, 1).djm0 < 0.0, "alternate_cal2jd at compile time");
+static_assert(terse_alternate_cx::eform(9).status == -1, "eform at compile time");
+constexpr double OBLIQUITY_J2000 = terse_alternate_cx::obl06(2451545.0, 0.0);
+static_assert(OBLIQUITY_J2000 > 0.409 && OBLIQUITY_J2000 < 0.41, "obl06 at compile time");
+
+static void check_near(const char *label, double expected, double result, double tolerance){
+    bool ok = std::fabs(expected - result) <= tolerance;
+    !ok ? ++num_errors : ++num_successful;
+    printf("%s %s Expected: %.15g Result: %.15g\n", label, ok ? SUCCESS : FAILURE, expected, result);
+}
+
+/* The largest difference between the constexpr fundamental arguments and SOFA's, over a range of dates. */
+static void test_fundamental_arguments(){
+    double worst = 0.0;
+    for (double t = -20.0; t <= 20.0; t += 0.0137){
+        double a[14] = {iauFal03(t), iauFalp03(t), iauFaf03(t), iauFad03(t), iauFaom03(t), iauFame03(t), iauFave03(t),
+            iauFae03(t), iauFama03(t), iauFaju03(t), iauFasa03(t), iauFaur03(t), iauFane03(t), iauFapa03(t)};
+        double b[14] = {terse_alternate_cx::fal03(t), terse_alternate_cx::falp03(t), terse_alternate_cx::faf03(t), terse_alternate_cx::fad03(t), terse_alternate_cx::faom03(t),
+            terse_alternate_cx::fame03(t), terse_alternate_cx::fave03(t), terse_alternate_cx::fae03(t), terse_alternate_cx::fama03(t), terse_alternate_cx::faju03(t),
+            terse_alternate_cx::fasa03(t), terse_alternate_cx::faur03(t), terse_alternate_cx::fane03(t), terse_alternate_cx::fapa03(t)};
+        for (int k = 0; k < 14; ++k){
+            worst = std::fmax(worst, std::fabs(a[k] - b[k]));
+        }
+        worst = std::fmax(worst, std::fabs(iauObl06(2451545.0, t * 36525.0) - terse_alternate_cx::obl06(2451545.0, t * 36525.0)));
+    }
+    check_near("FA*03, OBL06 identical", 0.0, worst, 0.0);
+}
+
+static void test_ellipsoids_and_sites(){
+    for (int n = 0; n <= 4; ++n){
+        double a, f;
+        int status = iauEform(n, &a, &f);
+        terse_alternate_cx::ellipsoid e = terse_alternate_cx::eform(n);
+        check_near("EFORM status", status, e.status, 0.0);
+        check_near("EFORM a", a, e.a, 0.0);
+        check_near("EFORM f", f, e.f, 0.0);
+    }
+    double worst = 0.0;
+    for (double phi = -1.5707963267948966; phi <= 1.5707963267948966; phi += 0.0123){
+        for (double elong = -3.14159; elong <= 3.14159; elong += 0.0731){
+            double xyz[3];
+            iauGd2gc(1, elong, phi, 2738.0, xyz);
+            terse_alternate_cx::geocentric g = terse_alternate_cx::gd2gc(1, elong, phi, 2738.0);
+            for (int k = 0; k < 3; ++k){
+                worst = std::fmax(worst, std::fabs(xyz[k] - g.xyz[k]));
+            }
+        }
+    }
+    check_near("GD2GC max diff (m)", 0.0, worst, 1e-8);
+}
+
+/* Every day of every month, for a range of years, including bad days and months. */
+static void test_calendars(){
+    int num_different = 0;
+    for (int y = -6000; y <= 3000; ++y){
+        for (int m = 0; m <= 13; ++m){
+            for (int d = 0; d <= 32; d += (m == 2 ? 1 : 7)){
+                double djm0, djm, alt_djm0, alt_djm;
+                int status = iauCal2jd(y, m, d, &djm0, &djm);
+                terse_alternate_cx::julian_date jd = terse_alternate_cx::cal2jd(y, m, d);
+                if (status != jd.status || ((status == 0 || status == -3) && (djm0 != jd.djm0 || djm != jd.djm))) ++num_different;
+                int alt_status = terse_alternate_iauCal2jd(y, m, d, &alt_djm0, &alt_djm);
+                terse_alternate_cx::julian_date alt = terse_alternate_cx::alternate_cal2jd(y, m, d);
+                if (alt_status != alt.status || (alt_status != -2 && (alt_djm0 != alt.djm0 || alt_djm != alt.djm))) ++num_different;
+            }
+        }
+    }
+    check_near("CAL2JD, alternate CAL2JD differences", 0, num_different, 0.0);
+}
+
+int main(){
+    test_fundamental_arguments();
+    test_ellipsoids_and_sites();
+    test_calendars();
+    printf("Num successful tests: %d\n", num_successful);
+    printf("Num failed tests: %d\n", num_errors);
+    return num_errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,271 @@
+#ifndef ALTERNATE_CONSTEXPR_HPP
+#define ALTERNATE_CONSTEXPR_HPP
+
+/*
+ Compile-time (constexpr) equivalents of some deterministic SOFA routines, implemented in C++14.
+
+ Embedded mount controllers have a fixed site, and many fixed epochs. With these, the site's geocentric
+ vector, the ellipsoid, reference epochs as Julian dates, and the fundamental arguments and obliquity at
+ those epochs can be folded into the binary by the compiler, instead of being computed at startup:
+
+   constexpr auto site = terse_alternate_cx::gd2gc(1, -0.527800806, -1.2345856, 2738.0); //WGS84
+   static_assert(site.status == 0, "bad site");
+   constexpr auto epoch = terse_alternate_cx::cal2jd(2025, 1, 1);
+
+ The functions follow the SOFA originals term by term, in the same order.
+ Functions with several outputs return a struct, instead of writing through pointers.
+ The C library's sqrt, sin, cos and fmod can't be used in constant expressions, so the header has its own:
+   - fmod is exact, as in the C library, so the fundamental arguments are bit-identical to SOFA's;
+   - sqrt, sin and cos are within an ulp or so of the C library, so the results of terse_alternate_cx::gd2gce agree
+     with those of iauGd2gce to a few nanometres (see alternate-constexpr-tests.cpp).
+
+ Build and run the tests with:
+   gcc -std=c99 -c eform.c gd2gc.c gd2gce.c zp.c obl06.c fa*.c cal2jd.c alternate-cal2jd.c
+   g++ -std=c++14 -Wall alternate-constexpr-tests.cpp *.o -lm -o constexpr-tests
+   ./constexpr-tests
+*/
+
+namespace terse_alternate_cx {
+
+/* Constants, with the same values as in sofam.h. */
+constexpr double DPI = 3.141592653589793238462643;
+constexpr double D2PI = 6.283185307179586476925287;
+constexpr double DAS2R = 4.848136811095359935899141e-6;
+constexpr double TURNAS = 1296000.0;
+constexpr double DJ00 = 2451545.0;
+constexpr double DJC = 36525.0;
+constexpr double DJM0 = 2400000.5;
+
+namespace detail {
+
+constexpr double fabs(double x) {
+  return x < 0.0 ? -x : x;
+}
+
+/*
+ The remainder of x/y, with the sign of x, for y > 0. Exact, like the C library's fmod.
+ Each subtraction is of a multiple y*2^k that's between half of the remainder and the remainder itself,
+ so it's exact (Sterbenz's lemma).
+*/
+constexpr double fmod(double x, double y) {
+  double r = fabs(x);
+  while (r >= y) {
+    double m = y;
+    while (m * 2.0 <= r) m *= 2.0;
+    r -= m;
+  }
+  return x < 0.0 ? -r : r;
+}
+
+/* Square root, by Newton's method on x scaled by powers of 4 into the range 1..4. */
+constexpr double sqrt(double x) {
+  if (x <= 0.0) return 0.0;
+  double scale = 1.0;
+  while (x >= 4.0) { x *= 0.25; scale *= 2.0; }
+  while (x < 1.0) { x *= 4.0; scale *= 0.5; }
+  double y = 1.5;
+  for (int i = 0; i < 8; ++i) y = 0.5 * (y + x / y);
+  return y * scale;
+}
+
+/* sin and cos for |r| <= pi/4, with the polynomials of fdlibm's __kernel_sin and __kernel_cos. */
+constexpr double kernel_sin(double r) {
+  double z = r * r;
+  double v = z * r;
+  return r + v * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03 +
+      z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 +
+      z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+}
+
+constexpr double kernel_cos(double r) {
+  double z = r * r;
+  double p = z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 +
+      z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 +
+      z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+  double hz = 0.5 * z;
+  double w = 1.0 - hz;
+  return w + (((1.0 - w) - hz) + z * p);
+}
+
+/*
+ Reduce x to r = x - k*pi/2, |r| <= pi/4, returning k mod 4 (Cody-Waite, with pi/2 in three parts).
+ Accurate for |x| up to about 1e9, far beyond the angles used here.
+*/
+constexpr int reduce(double x, double &r) {
+  double kd = x * 6.36619772367581382433e-01;
+  long long k = (long long)(kd < 0.0 ? kd - 0.5 : kd + 0.5);
+  double kf = (double)k;
+  r = ((x - kf * 1.57079632673412561417e+00) - kf * 6.07710050630396597660e-11) - kf * 2.02226624871116645580e-21;
+  return (int)(((k % 4) + 4) % 4);
+}
+
+constexpr double sin(double x) {
+  double r = 0.0;
+  switch (reduce(x, r)) {
+    case 0: return kernel_sin(r);
+    case 1: return kernel_cos(r);
+    case 2: return -kernel_sin(r);
+    default: return -kernel_cos(r);
+  }
+}
+
+constexpr double cos(double x) {
+  double r = 0.0;
+  switch (reduce(x, r)) {
+    case 0: return kernel_cos(r);
+    case 1: return -kernel_sin(r);
+    case 2: return -kernel_cos(r);
+    default: return kernel_sin(r);
+  }
+}
+
+} // namespace detail
+
+/* The equatorial radius (m) and flattening of a reference ellipsoid; status 0 for OK, -1 for an unknown ellipsoid. */
+struct ellipsoid {
+  double a;
+  double f;
+  int status;
+};
+
+/* A geocentric position vector (m); status 0 for OK, -1 for an unknown ellipsoid, -2 for an illegal case. */
+struct geocentric {
+  double xyz[3];
+  int status;
+};
+
+/* A two-part Julian date; status as for iauCal2jd. */
+struct julian_date {
+  double djm0;
+  double djm;
+  int status;
+};
+
+/* Like iauEform: n = 1 for WGS84, 2 for GRS80, 3 for WGS72. */
+constexpr ellipsoid eform(int n) {
+  switch (n) {
+    case 1: return ellipsoid{6378137.0, 1.0 / 298.257223563, 0};
+    case 2: return ellipsoid{6378137.0, 1.0 / 298.257222101, 0};
+    case 3: return ellipsoid{6378135.0, 1.0 / 298.26, 0};
+    default: return ellipsoid{0.0, 0.0, -1};
+  }
+}
+
+/* Like iauGd2gce. */
+constexpr geocentric gd2gce(double a, double f, double elong, double phi, double height) {
+  geocentric result{{0.0, 0.0, 0.0}, 0};
+  double sp = detail::sin(phi);
+  double cp = detail::cos(phi);
+  double w = 1.0 - f;
+  w = w * w;
+  double d = cp*cp + w*sp*sp;
+  if (d <= 0.0) {
+    result.status = -1;
+    return result;
+  }
+  double ac = a / detail::sqrt(d);
+  double as = w * ac;
+  double r = (ac + height) * cp;
+  result.xyz[0] = r * detail::cos(elong);
+  result.xyz[1] = r * detail::sin(elong);
+  result.xyz[2] = (as + height) * sp;
+  return result;
+}
+
+/* Like iauGd2gc. */
+constexpr geocentric gd2gc(int n, double elong, double phi, double height) {
+  ellipsoid e = eform(n);
+  if (e.status != 0) return geocentric{{-1e9, -1e9, -1e9}, -1};
+  geocentric result = gd2gce(e.a, e.f, elong, phi, height);
+  if (result.status != 0) {
+    result.xyz[0] = result.xyz[1] = result.xyz[2] = -1e9;
+    result.status = -2;
+  }
+  return result;
+}
+
+/* Like iauObl06. */
+constexpr double obl06(double date1, double date2) {
+  double t = ((date1 - DJ00) + date2) / DJC;
+  return (84381.406     +
+         (-46.836769    +
+         ( -0.0001831   +
+         (  0.00200340  +
+         ( -0.000000576 +
+         ( -0.0000000434) * t) * t) * t) * t) * t) * DAS2R;
+}
+
+/* Like iauFal03, and so on: the fundamental arguments (IERS Conventions 2003). t is TDB in Julian centuries since J2000.0. */
+constexpr double fal03(double t) {
+  return detail::fmod(485868.249036 + t * (1717915923.2178 + t * (31.8792 + t * (0.051635 + t * (-0.00024470)))), TURNAS) * DAS2R;
+}
+
+constexpr double falp03(double t) {
+  return detail::fmod(1287104.793048 + t * (129596581.0481 + t * (-0.5532 + t * (0.000136 + t * (-0.00001149)))), TURNAS) * DAS2R;
+}
+
+constexpr double faf03(double t) {
+  return detail::fmod(335779.526232 + t * (1739527262.8478 + t * (-12.7512 + t * (-0.001037 + t * (0.00000417)))), TURNAS) * DAS2R;
+}
+
+constexpr double fad03(double t) {
+  return detail::fmod(1072260.703692 + t * (1602961601.2090 + t * (-6.3706 + t * (0.006593 + t * (-0.00003169)))), TURNAS) * DAS2R;
+}
+
+constexpr double faom03(double t) {
+  return detail::fmod(450160.398036 + t * (-6962890.5431 + t * (7.4722 + t * (0.007702 + t * (-0.00005939)))), TURNAS) * DAS2R;
+}
+
+constexpr double fame03(double t) { return detail::fmod(4.402608842 + 2608.7903141574 * t, D2PI); }
+constexpr double fave03(double t) { return detail::fmod(3.176146697 + 1021.3285546211 * t, D2PI); }
+constexpr double fae03(double t) { return detail::fmod(1.753470314 + 628.3075849991 * t, D2PI); }
+constexpr double fama03(double t) { return detail::fmod(6.203480913 + 334.0612426700 * t, D2PI); }
+constexpr double faju03(double t) { return detail::fmod(0.599546497 + 52.9690962641 * t, D2PI); }
+constexpr double fasa03(double t) { return detail::fmod(0.874016757 + 21.3299104960 * t, D2PI); }
+constexpr double faur03(double t) { return detail::fmod(5.481293872 + 7.4781598567 * t, D2PI); }
+constexpr double fane03(double t) { return detail::fmod(5.311886287 + 3.8133035638 * t, D2PI); }
+constexpr double fapa03(double t) { return (0.024381750 + 0.00000538691 * t) * t; }
+
+/* Like iauCal2jd, with the same restriction to dates from -4799 January 1. */
+constexpr julian_date cal2jd(int iy, int im, int id) {
+  const int mtab[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (iy < -4799) return julian_date{0.0, 0.0, -1};
+  if (im < 1 || im > 12) return julian_date{0.0, 0.0, -2};
+  int ly = ((im == 2) && !(iy%4) && (iy%100 || !(iy%400)));
+  int j = ((id < 1) || (id > (mtab[im-1] + ly))) ? -3 : 0;
+  int my = (im - 14) / 12;
+  long iypmy = (long)(iy + my);
+  double djm = (double)((1461L * (iypmy + 4800L)) / 4L
+                 + (367L * (long)(im - 2 - 12 * my)) / 12L
+                 - (3L * ((iypmy + 4900L) / 100L)) / 4L
+                 + (long)id - 2432076L);
+  return julian_date{DJM0, djm, j};
+}
+
+/* Like terse_alternate_iauCal2jd (in alternate-cal2jd.c): no restriction on the date, and the whole JD in djm0. */
+constexpr julian_date alternate_cal2jd(int iy, int im, int id) {
+  const int month_len[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  const int days_in_preceding_months[] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+  if (im < 1 || im > 12) return julian_date{0.0, 0.0, -2};
+  int ly = ((im == 2) && !(iy%4) && (iy%100 || !(iy%400)));
+  int j = ((id < 1) || (id > (month_len[im-1] + ly))) ? -3 : 0;
+
+  //completed years, then months, then the day, counted from January 0.0 of year 0
+  int y_p = (iy >= 0) ? (iy - 1) : iy;
+  int num_366yrs = (y_p/4) - (y_p/100) + (y_p/400);
+  if (iy > 0) {
+    num_366yrs += 1;
+  }
+  int num_365yrs = iy - num_366yrs;
+  double res = num_365yrs * 365 + num_366yrs * 366;
+  res += days_in_preceding_months[im-1];
+  int is_leap = (iy % 100 == 0) ? (iy % 400 == 0) : (iy % 4 == 0);
+  res += (is_leap && (im - 1) >= 2 ? 1 : 0);
+  res += id;
+  res += 1721058.5;
+  return julian_date{res, 0.0, j};
+}
+
+} // namespace terse_alternate_cx
+
+#endif
@@ -0,0 +1,251 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+#if defined(__SSE2__) || defined(_M_X64)
+#include <xmmintrin.h>
+#include <pmmintrin.h>
+#endif
+
+/*
+ Deterministic-time variants of iauAtioq, iauAtoiq and iauAtco13, implemented in C99.
+
+ For hard-real-time pointing the tail latency matters, not the mean.
+ The SOFA functions have no loops that depend on the data, but their cost still varies with the input:
+   - sin/cos/atan2 take a slow path in libm for huge arguments (Payne-Hanek range reduction).
+   - near the zenith or the pole, the horizontal or equatorial components become subnormal, and
+     arithmetic on subnormals costs tens to hundreds of cycles on many CPUs.
+ (There are no refraction iterations: iauAtoiq uses the closed-form A*tan(z) + B*tan^3(z) model.)
+
+ These variants avoid both slow paths:
+   - angles are reduced into -pi..+pi with iauAnpm before any trig call.
+   - vector components smaller than DT_TINY are flushed to zero explicitly, so atan2 and the
+     products that follow never see subnormals.
+ terse_alternate_iauFtz sets the CPU's own flush-to-zero and denormals-are-zero modes, where the hardware has them.
+
+ Accuracy, measured against the SOFA functions (see alternate-run-tests.c):
+   - for ordinary inputs, the results agree with iauAtco13 to better than 1e-12 radians.
+   - an input angle of any size gives the same result as the same angle reduced into -pi..+pi.
+   - a component below DT_TINY (1e-100) is treated as an exact zero. At the exact zenith and
+     the exact pole, the azimuth or hour angle is then 0.0, which is also what SOFA returns there.
+*/
+
+/* Components smaller than this are flushed to zero. An angle of 1e-100 radians has no physical meaning. */
+static const double DT_TINY = 1e-100;
+
+/* Minimum cos(alt) and sin(alt) for refraction purposes (the same values as iauAtioq and iauAtoiq). */
+static const double CELMIN = 1e-6;
+static const double SELMIN = 0.05;
+
+static double flush(double x) {
+  return fabs(x) < DT_TINY ? 0.0 : x;
+}
+
+/* Like iauC2s, but with subnormal inputs to atan2 flushed to zero. */
+static void c2s_flushed(double p[3], double *theta, double *phi) {
+  double x = flush(p[0]);
+  double y = flush(p[1]);
+  double z = flush(p[2]);
+  double d2 = x*x + y*y;
+  *theta = (d2 == 0.0) ? 0.0 : atan2(y, x);
+  *phi = (z == 0.0) ? 0.0 : atan2(z, sqrt(d2));
+}
+
+/*
+ Like iauAtioq, but with a deterministic execution time.
+ Same arguments as iauAtioq.
+*/
+void terse_alternate_iauAtioqd(double ri, double di, iauASTROM *astrom,
+               double *aob, double *zob,
+               double *hob, double *dob, double *rob)
+{
+   double v[3];
+
+/* CIRS RA,Dec to Cartesian -HA,Dec, with the angle reduced before the trig calls. */
+   iauS2c(iauAnpm(ri - astrom->eral), iauAnpm(di), v);
+   double x = flush(v[0]);
+   double y = flush(v[1]);
+   double z = flush(v[2]);
+
+/* Polar motion. */
+   double sx = sin(astrom->xpl);
+   double cx = cos(astrom->xpl);
+   double sy = sin(astrom->ypl);
+   double cy = cos(astrom->ypl);
+   double xhd = cx*x + sx*z;
+   double yhd = sx*sy*x + cy*y - cx*sy*z;
+   double zhd = -sx*cy*x + sy*y + cx*cy*z;
+
+/* Diurnal aberration. */
+   double f = ( 1.0 - astrom->diurab*yhd );
+   double xhdt = f * xhd;
+   double yhdt = f * ( yhd + astrom->diurab );
+   double zhdt = f * zhd;
+
+/* Cartesian -HA,Dec to Cartesian Az,El (S=0,E=90). */
+   double xaet = flush(astrom->sphi*xhdt - astrom->cphi*zhdt);
+   double yaet = flush(yhdt);
+   double zaet = flush(astrom->cphi*xhdt + astrom->sphi*zhdt);
+
+/* Azimuth (N=0,E=90). */
+   double azobs = ( xaet != 0.0 || yaet != 0.0 ) ? atan2(yaet,-xaet) : 0.0;
+
+/* Refraction: the A*tan(z)+B*tan^3(z) model, with Newton-Raphson correction (no iteration). */
+   double r = sqrt(xaet*xaet + yaet*yaet);
+   r = r > CELMIN ? r : CELMIN;
+   z = zaet > SELMIN ? zaet : SELMIN;
+   double tz = r/z;
+   double w = astrom->refb*tz*tz;
+   double del = ( astrom->refa + w ) * tz /
+         ( 1.0 + ( astrom->refa + 3.0*w ) / ( z*z ) );
+
+/* Apply the change, giving observed vector. */
+   double cosdel = 1.0 - del*del/2.0;
+   f = cosdel - del*z/r;
+   double xaeo = flush(xaet*f);
+   double yaeo = flush(yaet*f);
+   double zaeo = flush(cosdel*zaet + del*r);
+
+/* Observed ZD. */
+   double zdobs = atan2(sqrt(xaeo*xaeo+yaeo*yaeo), zaeo);
+
+/* Az/El vector to HA,Dec vector (both right-handed). */
+   v[0] = astrom->sphi*xaeo + astrom->cphi*zaeo;
+   v[1] = yaeo;
+   v[2] = - astrom->cphi*xaeo + astrom->sphi*zaeo;
+
+/* To spherical -HA,Dec. */
+   double hmobs, dcobs;
+   c2s_flushed(v, &hmobs, &dcobs);
+
+/* Right ascension (with respect to CIO). */
+   double raobs = astrom->eral + hmobs;
+
+/* Return the results. */
+   *aob = iauAnp(azobs);
+   *zob = zdobs;
+   *hob = -hmobs;
+   *dob = dcobs;
+   *rob = iauAnp(raobs);
+}
+
+/*
+ Like iauAtoiq, but with a deterministic execution time.
+ Same arguments as iauAtoiq.
+*/
+void terse_alternate_iauAtoiqd(const char *type,
+               double ob1, double ob2, iauASTROM *astrom,
+               double *ri, double *di)
+{
+   double v[3], xaeo, yaeo, zaeo;
+
+/* Coordinate type, and coordinates reduced before the trig calls. */
+   int c = (int) type[0];
+   double c1 = iauAnpm(ob1);
+   double c2 = iauAnpm(ob2);
+   double sphi = astrom->sphi;
+   double cphi = astrom->cphi;
+
+/* If Az,ZD, convert to Cartesian (S=0,E=90). */
+   if ( c != 'r' && c != 'R' && c != 'h' && c != 'H' ) {
+      double ce = sin(c2);
+      xaeo = flush(- cos(c1) * ce);
+      yaeo = flush(sin(c1) * ce);
+      zaeo = flush(cos(c2));
+   } else {
+   /* If RA,Dec, convert to HA,Dec. */
+      if ( c == 'r' || c == 'R' ) c1 = iauAnpm(astrom->eral - c1);
+
+   /* To Cartesian -HA,Dec, then to Cartesian Az,El (S=0,E=90). */
+      iauS2c ( -c1, c2, v );
+      xaeo = flush(sphi*v[0] - cphi*v[2]);
+      yaeo = flush(v[1]);
+      zaeo = flush(cphi*v[0] + sphi*v[2]);
+   }
+
+/* Azimuth (S=0,E=90), sine of observed ZD, and observed ZD. */
+   double az = ( xaeo != 0.0 || yaeo != 0.0 ) ? atan2(yaeo,xaeo) : 0.0;
+   double sz = sqrt ( xaeo*xaeo + yaeo*yaeo );
+   double zdo = atan2 ( sz, zaeo );
+
+/* Refraction: the fast two-constant model (no iteration). */
+   double tz = sz / ( zaeo > SELMIN ? zaeo : SELMIN );
+   double dref = ( astrom->refa + astrom->refb*tz*tz ) * tz;
+   double zdt = zdo + dref;
+
+/* To Cartesian Az,ZD. */
+   double ce = sin(zdt);
+   double xaet = cos(az) * ce;
+   double yaet = sin(az) * ce;
+   double zaet = cos(zdt);
+
+/* Cartesian Az,ZD to Cartesian -HA,Dec. */
+   double xmhda = flush(sphi*xaet + cphi*zaet);
+   double ymhda = flush(yaet);
+   double zmhda = flush(- cphi*xaet + sphi*zaet);
+
+/* Diurnal aberration. */
+   double f = ( 1.0 + astrom->diurab*ymhda );
+   double xhd = f * xmhda;
+   double yhd = f * ( ymhda - astrom->diurab );
+   double zhd = f * zmhda;
+
+/* Polar motion. */
+   double sx = sin(astrom->xpl);
+   double cx = cos(astrom->xpl);
+   double sy = sin(astrom->ypl);
+   double cy = cos(astrom->ypl);
+   v[0] = cx*xhd + sx*sy*yhd - sx*cy*zhd;
+   v[1] = cy*yhd + sy*zhd;
+   v[2] = sx*xhd - cx*sy*yhd + cx*cy*zhd;
+
+/* To spherical -HA,Dec, and right ascension. */
+   double hma;
+   c2s_flushed(v, &hma, di);
+   *ri = iauAnp(astrom->eral + hma);
+}
+
+/*
+ Like iauAtco13, but with a deterministic execution time for the star-dependent part.
+ Same arguments and status as iauAtco13.
+
+ The star-independent part (iauApco13) has no data-dependent branches, apart from the short
+ search of the leap second table in iauDat.
+*/
+int terse_alternate_iauAtco13d(double rc, double dc,
+               double pr, double pd, double px, double rv,
+               double utc1, double utc2, double dut1,
+               double elong, double phi, double hm, double xp, double yp,
+               double phpa, double tc, double rh, double wl,
+               double *aob, double *zob, double *hob,
+               double *dob, double *rob, double *eo)
+{
+   iauASTROM astrom;
+   double ri, di;
+
+   int j = iauApco13(utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                 phpa, tc, rh, wl, &astrom, eo);
+   if ( j < 0 ) return j;
+
+   iauAtciq(iauAnpm(rc), iauAnpm(dc), pr, pd, px, rv, &astrom, &ri, &di);
+   terse_alternate_iauAtioqd(ri, di, &astrom, aob, zob, hob, dob, rob);
+   return j;
+}
+
+/*
+ Turn the CPU's flush-to-zero and denormals-are-zero modes on (1) or off (0), for the calling thread.
+ Returns the previous state (0 or 1), or -1 if this CPU/compiler has no such modes (in which
+ case nothing is changed).
+
+ This affects all floating point code in the thread, not just SOFA. Subnormal results become zero.
+*/
+int terse_alternate_iauFtz(int on) {
+#if defined(__SSE2__) || defined(_M_X64)
+  int previous = (_MM_GET_FLUSH_ZERO_MODE() == _MM_FLUSH_ZERO_ON) ? 1 : 0;
+  _MM_SET_FLUSH_ZERO_MODE(on ? _MM_FLUSH_ZERO_ON : _MM_FLUSH_ZERO_OFF);
+  _MM_SET_DENORMALS_ZERO_MODE(on ? _MM_DENORMALS_ZERO_ON : _MM_DENORMALS_ZERO_OFF);
+  return previous;
+#else
+  (void)on;
+  return -1;
+#endif
+}
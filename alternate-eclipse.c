@@ -0,0 +1,325 @@
+#include <stdlib.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ A search for solar and lunar eclipses over long spans of time (tens of thousands of years), implemented in C99.
+
+ The syzygies are taken one lunation at a time, from the mean lunation of Meeus (Astronomical Algorithms,
+ ch. 49 and 54):
+
+   - a cheap bound prunes most of them: at the mean syzygy, the Moon's argument of latitude F must be near a
+     node, |sin F| < 0.40 (Meeus's limit is 0.36).
+   - for the rest, the greatest eclipse is found by minimizing the distance of the shadow axis from the
+     Earth's centre (solar) or of the Moon's centre from the axis of the Earth's shadow (lunar), by golden
+     section search then Newton's method. The Moon is from iauMoon98, and the Sun from iauEpv00 within 1000
+     years of J2000, or else from the long-term series of Meeus ch. 25; both are apparent (corrected for
+     light time and aberration). The Earth is a sphere, of the equatorial radius, and its shadow is enlarged
+     by 2% (Chauvenet's rule), as usual for eclipse canons.
+   - the contact times are found by the Illinois method (regula falsi), either side of the greatest eclipse.
+
+ The lunations are shared among threads, a few thousand at a time. All times are TT; for dates far from
+ the present, the uncertainty in Delta T (hours, ten thousand years ago) and in the models of the Moon and
+ Sun is much larger than that of the search. The calendar dates are Gregorian (proleptic), from
+ terse_alternate_iauJd2cal, which has no limit on the year.
+
+ Over 2017-2023, the times of greatest eclipse agree with the NASA canon to within a few seconds, and the
+ kinds all agree. The long-term series for the Sun is good to about 0.01 degree, which moves the times by up
+ to half a minute.
+*/
+
+/* Lunations per batch shared among threads. */
+enum { LUNATIONS_PER_BATCH = 4096 };
+
+/* The mean lunation (days), and the mean new moon of lunation 0 (days from J2000, TT). */
+static const double SYNODIC_MONTH = 29.530588861;
+static const double NEW_MOON_0 = 2451550.09766 - DJ00;
+
+/* No eclipse if |sin F| exceeds this at the mean syzygy. */
+static const double SIN_F_LIMIT = 0.40;
+
+/* Within this many years of J2000, the Sun is from iauEpv00. */
+static const double EPV00_YEARS = 1000.0;
+
+/* Radii (km): the Earth's equatorial radius, the Sun, and the Moon for penumbral and umbral contacts. */
+static const double EARTH_RADIUS = 6378.137;
+static const double SUN_RADIUS = 696000.0;
+static const double MOON_RADIUS = 0.2725076 * 6378.137;
+static const double MOON_RADIUS_UMBRA = 0.2722810 * 6378.137;
+
+/* The enlargement of the Earth's shadow by its atmosphere. */
+static const double SHADOW_ENLARGEMENT = 1.02;
+
+/* The bracket for the greatest eclipse around the mean syzygy, and for the contacts around the greatest (days). */
+static const double SYZYGY_BRACKET = 2.0;
+static const double CONTACT_BRACKET = 0.3;
+
+/*
+ The Sun is interpolated over this many days either side of the mean syzygy, from the positions at these
+ fractions of it; the error is about a km.
+*/
+static const double SUN_SPAN = 2.3;
+static const double SUN_NODES[4] = {-1.0, -1.0 / 3.0, 1.0 / 3.0, 1.0};
+
+/* The Sun's apparent geocentric position (km, GCRS), from the long-term series of Meeus ch. 25, at t days from J2000. */
+static void sun_longterm(double t, double s[3]) {
+  double T = t / DJC;
+  double l0 = 280.46646 + T * (36000.76983 + T * 0.0003032);
+  double m = (357.52911 + T * (35999.05029 - T * 0.0001537)) * DD2R;
+  double e = 0.016708634 - T * (0.000042037 + T * 0.0000001267);
+  double c = (1.914602 - T * (0.004817 + T * 0.000014)) * sin(m) + (0.019993 - T * 0.000101) * sin(2.0 * m)
+      + 0.000289 * sin(3.0 * m);
+  double r = 1.000001018 * (1.0 - e * e) / (1.0 + e * cos(m + c * DD2R));
+  //the mean ecliptic and equinox of date, less the aberration
+  double lon = (l0 + c) * DD2R - 20.4898 * DAS2R / r;
+  double v[3] = {r * cos(lon) * DAU / 1000.0, r * sin(lon) * DAU / 1000.0, 0.0}, rm[3][3];
+  iauEcm06(DJ00, t, rm);
+  iauTrxp(rm, v, s);
+}
+
+/* The Sun around a syzygy: its apparent geocentric position (km, GCRS) at four times, for cubic interpolation. */
+typedef struct {
+  double t0;        /* the middle (days from J2000, TT) */
+  double s[4][3];   /* at t0 + SUN_SPAN * SUN_NODES[i] */
+} sun_track;
+
+/* The Sun over SYZYGY_BRACKET + CONTACT_BRACKET days either side of t, from iauEpv00 or the long-term series. */
+static void sun_track_init(double t, sun_track *track) {
+  int longterm = fabs(t) > EPV00_YEARS * DJY;
+  track->t0 = t;
+  for (int i = 0; i < 4; ++i) {
+    double ti = t + SUN_SPAN * SUN_NODES[i], pvh[2][3], pvb[2][3];
+    if (longterm) {
+      sun_longterm(ti, track->s[i]);
+      continue;
+    }
+    iauEpv00(DJ00, ti, pvh, pvb);
+    double tau = iauPm(pvh[0]) * AULT / DAYSEC;
+    for (int j = 0; j < 3; ++j) track->s[i][j] = -(pvh[0][j] - pvh[1][j] * tau) * DAU / 1000.0;
+  }
+}
+
+/* The apparent geocentric Sun s and Moon m (km, GCRS) at t days from J2000 (TT). */
+static void sun_moon(const sun_track *track, double t, double s[3], double m[3]) {
+  double pv[2][3], x = (t - track->t0) / SUN_SPAN;
+  iauMoon98(DJ00, t, pv);
+  double tau = iauPm(pv[0]) * AULT / DAYSEC;
+  for (int i = 0; i < 3; ++i) m[i] = (pv[0][i] - pv[1][i] * tau) * DAU / 1000.0;
+  //Lagrange interpolation
+  iauZp(s);
+  for (int i = 0; i < 4; ++i) {
+    double w = 1.0;
+    for (int j = 0; j < 4; ++j) {
+      if (j != i) w *= (x - SUN_NODES[j]) / (SUN_NODES[i] - SUN_NODES[j]);
+    }
+    for (int j = 0; j < 3; ++j) s[j] += w * track->s[i][j];
+  }
+}
+
+/*
+ The circumstances at t days from J2000 (TT): v[0] is the distance to minimize, and v[1..3] its values at
+ the contacts, outermost first.
+   solar: the shadow axis's distance from the Earth's centre (km); the Earth's radius plus the penumbra's
+          radius in the fundamental plane; the Earth's radius. v[4] is the umbra's radius in the
+          fundamental plane, and v[5] at the Earth's surface on the axis (-ve umbra, +ve antumbra).
+   lunar: the Moon's angular distance from the shadow's axis; the radii of the penumbra and the umbra plus
+          the Moon's semidiameter; the umbra's radius less it (radians). v[4] is the Moon's semidiameter,
+          and v[5] the Moon's distance from the Earth's centre (km).
+*/
+static void circumstances(int type, const sun_track *track, double t, double v[6]) {
+  double s[3], m[3];
+  sun_moon(track, t, s, m);
+  if (type == IAU_ECLIPSE_SOLAR) {
+    double d[3], dist, q[3];
+    iauPmp(m, s, d);
+    iauPn(d, &dist, d);
+    double behind = -iauPdp(m, d);    //the fundamental plane, from the Moon along the axis
+    for (int i = 0; i < 3; ++i) q[i] = m[i] + behind * d[i];
+    double f1 = asin((SUN_RADIUS + MOON_RADIUS) / dist), f2 = asin((SUN_RADIUS - MOON_RADIUS_UMBRA) / dist);
+    v[0] = iauPm(q);
+    double l1 = behind * tan(f1) + MOON_RADIUS / cos(f1);
+    v[1] = EARTH_RADIUS + l1;
+    v[2] = EARTH_RADIUS;
+    v[3] = 0.0;
+    v[4] = behind * tan(f2) - MOON_RADIUS_UMBRA / cos(f2);
+    double z = (v[0] < EARTH_RADIUS) ? sqrt(EARTH_RADIUS * EARTH_RADIUS - v[0] * v[0]) : 0.0;
+    v[5] = v[4] - z * tan(f2);
+  } else {
+    double anti[3], dm = iauPm(m), ds = iauPm(s);
+    iauSxp(-1.0, s, anti);
+    double pi_m = asin(EARTH_RADIUS / dm), pi_s = asin(EARTH_RADIUS / ds), s_s = asin(SUN_RADIUS / ds);
+    double s_m = asin(MOON_RADIUS / dm);
+    v[0] = iauSepp(m, anti);
+    v[1] = SHADOW_ENLARGEMENT * (pi_m + pi_s + s_s) + s_m;
+    v[2] = SHADOW_ENLARGEMENT * (pi_m + pi_s - s_s) + s_m;
+    v[3] = v[2] - 2.0 * s_m;
+    v[4] = s_m;
+    v[5] = dm;
+  }
+}
+
+static double distance_squared(int type, const sun_track *track, double t) {
+  double v[6];
+  circumstances(type, track, t, v);
+  return v[0] * v[0];
+}
+
+/* The time of the least distance within SYZYGY_BRACKET of t: golden section search, then Newton's method. */
+static double greatest(int type, const sun_track *track, double t) {
+  const double r = 0.6180339887498949, h = 1e-3;
+  double a = t - SYZYGY_BRACKET, b = t + SYZYGY_BRACKET;
+  double c = b - r * (b - a), d = a + r * (b - a);
+  double fc = distance_squared(type, track, c), fd = distance_squared(type, track, d);
+  while (b - a > 0.05) {
+    if (fc < fd) {
+      b = d; d = c; fd = fc;
+      c = b - r * (b - a);
+      fc = distance_squared(type, track, c);
+    } else {
+      a = c; c = d; fc = fd;
+      d = a + r * (b - a);
+      fd = distance_squared(type, track, d);
+    }
+  }
+  t = (a + b) / 2.0;
+  for (int i = 0; i < 4; ++i) {
+    double fm = distance_squared(type, track, t - h), f0 = distance_squared(type, track, t);
+    double fp = distance_squared(type, track, t + h);
+    double curvature = fp - 2.0 * f0 + fm;
+    if (!(curvature > 0.0)) break;
+    double step = h * (fp - fm) / (2.0 * curvature);
+    if (fabs(step) > 0.05) break;
+    t -= step;
+  }
+  return t;
+}
+
+/* The time between a and b at which v[0] = v[j], by the Illinois method; the sign changes between them. */
+static double contact(int type, const sun_track *track, int j, double a, double b) {
+  double v[6];
+  circumstances(type, track, a, v);
+  double fa = v[0] - v[j];
+  circumstances(type, track, b, v);
+  double fb = v[0] - v[j];
+  int side = 0;
+  for (int i = 0; i < 60 && fabs(b - a) > 1e-8; ++i) {
+    double c = (a * fb - b * fa) / (fb - fa);
+    circumstances(type, track, c, v);
+    double fc = v[0] - v[j];
+    if ((fc > 0.0) == (fb > 0.0)) {
+      b = c; fb = fc;
+      if (side == -1) fa /= 2.0;
+      side = -1;
+    } else {
+      a = c; fa = fc;
+      if (side == +1) fb /= 2.0;
+      side = +1;
+    }
+  }
+  return (a + b) / 2.0;
+}
+
+/*
+ The eclipse of the given type at the syzygy of (fractional) lunation k, if any, into *e. Returns 1 if
+ there's an eclipse, 0 if not.
+*/
+static int eclipse_at(int type, double k, terse_alternate_iauECLIPSE *e) {
+  //the mean syzygy, and the bound
+  double T = k / 1236.85;
+  double t = NEW_MOON_0 + SYNODIC_MONTH * k + T * T * (0.00015437 + T * (-0.000000150 + T * 0.00000000073));
+  double f = (160.7108 + 390.67050284 * k + T * T * (-0.0016118 + T * (-0.00000227 + T * 0.000000011))) * DD2R;
+  if (fabs(sin(f)) > SIN_F_LIMIT) return 0;
+  sun_track track;
+  sun_track_init(t, &track);
+
+  double tg = greatest(type, &track, t), v[6];
+  circumstances(type, &track, tg, v);
+  if (v[0] >= v[1]) return 0;
+
+  e->type = type;
+  e->tt1 = DJ00 + floor(tg);
+  e->tt2 = tg - floor(tg);
+  for (int i = 0; i < 6; ++i) e->contacts[i] = 0.0;
+  int inner = (v[0] < v[2]), innermost = (type == IAU_ECLIPSE_LUNAR && v[0] < v[3]);
+  for (int j = 1; j <= 3; ++j) {
+    if (j == 1 || (j == 2 && inner) || (j == 3 && innermost)) {
+      e->contacts[j - 1] = contact(type, &track, j, tg - CONTACT_BRACKET, tg) - tg;
+      e->contacts[6 - j] = contact(type, &track, j, tg, tg + CONTACT_BRACKET) - tg;
+    }
+  }
+  if (type == IAU_ECLIPSE_SOLAR) {
+    double l1 = v[1] - EARTH_RADIUS;
+    e->gamma = v[0] / EARTH_RADIUS;
+    e->penumbral_magnitude = 0.0;
+    if (inner) {
+      //central: the ratio of the apparent diameters, on the axis
+      e->kind = (v[5] > 0.0) ? IAU_ECLIPSE_ANNULAR : (v[4] > 0.0) ? IAU_ECLIPSE_HYBRID : IAU_ECLIPSE_TOTAL;
+      e->magnitude = (l1 - v[5]) / (l1 + v[5]);
+    } else {
+      e->kind = IAU_ECLIPSE_PARTIAL;
+      e->magnitude = (l1 - (v[0] - EARTH_RADIUS)) / (l1 + v[4]);
+    }
+  } else {
+    double s_m = v[4];
+    e->gamma = v[5] * sin(v[0]) / EARTH_RADIUS;
+    e->magnitude = (v[2] - v[0]) / (2.0 * s_m);
+    e->penumbral_magnitude = (v[1] - v[0]) / (2.0 * s_m);
+    e->kind = innermost ? IAU_ECLIPSE_TOTAL : inner ? IAU_ECLIPSE_PARTIAL : IAU_ECLIPSE_PENUMBRAL;
+  }
+  terse_alternate_iauJd2cal(e->tt1, e->tt2, &e->iy, &e->im, &e->id, &e->fd);
+  return 1;
+}
+
+typedef struct {
+  long long k0;
+  int types;
+  terse_alternate_iauECLIPSE *results;   /* two per lunation: the new moon, then the full moon */
+  int *found;
+} search_args;
+
+static void search_block(void *ctx, int begin, int end) {
+  search_args *a = ctx;
+  for (int i = begin; i < end; ++i) {
+    double k = (double)(a->k0 + i);
+    a->found[2 * i] = (a->types & IAU_ECLIPSE_SOLAR) && eclipse_at(IAU_ECLIPSE_SOLAR, k, &a->results[2 * i]);
+    a->found[2 * i + 1] = (a->types & IAU_ECLIPSE_LUNAR) && eclipse_at(IAU_ECLIPSE_LUNAR, k + 0.5, &a->results[2 * i + 1]);
+  }
+}
+
+/*
+ The eclipses of the given types (IAU_ECLIPSE_SOLAR, IAU_ECLIPSE_LUNAR, or both or'ed together) whose
+ greatest eclipse is from the TT tt1+tt2 for the given number of days, in order of time, using up to
+ nthreads threads (0 for one per CPU). At most max are stored in eclipses[]. Returns the number found
+ (which may be more than max), -1 for bad arguments, or -2 if there isn't the memory.
+*/
+int terse_alternate_iauEclipseSearch(double tt1, double tt2, double days, int types, int nthreads, int max, terse_alternate_iauECLIPSE eclipses[]) {
+  if (!(days >= 0.0) || (types & (IAU_ECLIPSE_SOLAR | IAU_ECLIPSE_LUNAR)) == 0 || max < 0) return -1;
+  double start = (tt1 - DJ00) + tt2, end = start + days;
+  //a couple of lunations either side, for the difference between the mean and true syzygies
+  long long kmin = (long long)floor((start - NEW_MOON_0) / SYNODIC_MONTH) - 2;
+  long long kmax = (long long)ceil((end - NEW_MOON_0) / SYNODIC_MONTH) + 2;
+  terse_alternate_iauECLIPSE *results = malloc(2 * LUNATIONS_PER_BATCH * sizeof *results);
+  int *found = malloc(2 * LUNATIONS_PER_BATCH * sizeof *found);
+  if (results == NULL || found == NULL) {
+    free(results);
+    free(found);
+    return -2;
+  }
+  int count = 0;
+  for (long long k0 = kmin; k0 <= kmax; k0 += LUNATIONS_PER_BATCH) {
+    int n = (kmax - k0 + 1 < LUNATIONS_PER_BATCH) ? (int)(kmax - k0 + 1) : LUNATIONS_PER_BATCH;
+    search_args args = {k0, types, results, found};
+    terse_alternate_iauParallelFor(n, nthreads, search_block, &args);
+    for (int i = 0; i < 2 * n; ++i) {
+      if (!found[i]) continue;
+      double t = (results[i].tt1 - DJ00) + results[i].tt2;
+      if (t < start || t >= end) continue;
+      if (count < max) eclipses[count] = results[i];
+      ++count;
+    }
+  }
+  free(results);
+  free(found);
+  return count;
+}
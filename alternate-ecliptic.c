@@ -0,0 +1,143 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Batch conversions between ecliptic coordinates (mean equinox and ecliptic of date) and ICRS RA,Dec,
+ implemented in C99.
+
+ iauEceq06, iauEqec06, iauLteceq and iauLteqec build the rotation matrix (iauEcm06 or iauLtecm) on every call,
+ and that costs far more than the rotation itself. Here, the matrix is built once per epoch, and applied to
+ whole arrays of coordinates.
+
+ The -v functions take one epoch for the whole array. The -ev functions take an epoch for each element, and build
+ a new matrix only where the epoch differs from the previous element's; so input sorted (or grouped) by epoch
+ costs one matrix per distinct epoch.
+
+ The coordinates are converted in blocks, one step at a time (spherical to Cartesian, rotation, Cartesian
+ to spherical), in the manner of iauS2c, iauRxp/iauTrxp and iauC2s. The results are the same as from the
+ SOFA functions. The input and output arrays may be the same.
+*/
+
+enum { BLOCK = 256 };
+
+/*
+ Rotate n spherical coordinates (a, b) by the matrix rm, or by its transpose, into (out_a, out_b),
+ with out_a in the range 0-2pi and out_b in the range +/-pi.
+*/
+static void rotate_spherical(double rm[3][3], int transpose, int n, const double a[], const double b[],
+    double out_a[], double out_b[]) {
+  double r[3][3];
+  for (int j = 0; j < 3; ++j) {
+    for (int i = 0; i < 3; ++i) {
+      r[j][i] = transpose ? rm[i][j] : rm[j][i];
+    }
+  }
+  for (int start = 0; start < n; start += BLOCK) {
+    int count = (n - start < BLOCK) ? n - start : BLOCK;
+    double x[BLOCK], y[BLOCK], z[BLOCK];
+
+    //spherical to Cartesian
+    for (int i = 0; i < count; ++i) {
+      double cp = cos(b[start + i]);
+      x[i] = cos(a[start + i]) * cp;
+      y[i] = sin(a[start + i]) * cp;
+      z[i] = sin(b[start + i]);
+    }
+
+    //rotation: no calls, so the compiler can vectorize it
+    for (int i = 0; i < count; ++i) {
+      double u = r[0][0]*x[i] + r[0][1]*y[i] + r[0][2]*z[i];
+      double v = r[1][0]*x[i] + r[1][1]*y[i] + r[1][2]*z[i];
+      double w = r[2][0]*x[i] + r[2][1]*y[i] + r[2][2]*z[i];
+      x[i] = u;
+      y[i] = v;
+      z[i] = w;
+    }
+
+    //Cartesian to spherical, in the conventional ranges
+    for (int i = 0; i < count; ++i) {
+      double d2 = x[i]*x[i] + y[i]*y[i];
+      double theta = (d2 == 0.0) ? 0.0 : atan2(y[i], x[i]);
+      double phi = (z[i] == 0.0) ? 0.0 : atan2(z[i], sqrt(d2));
+      out_a[start + i] = iauAnp(theta);
+      out_b[start + i] = iauAnpm(phi);
+    }
+  }
+}
+
+/* iauEceq06, for n ecliptic coordinates at one TT epoch. */
+void terse_alternate_iauEceq06v(double date1, double date2, int n, const double dl[], const double db[], double dr[], double dd[]) {
+  double rm[3][3];
+  iauEcm06(date1, date2, rm);
+  rotate_spherical(rm, 1, n, dl, db, dr, dd);
+}
+
+/* iauEqec06, for n ICRS coordinates at one TT epoch. */
+void terse_alternate_iauEqec06v(double date1, double date2, int n, const double dr[], const double dd[], double dl[], double db[]) {
+  double rm[3][3];
+  iauEcm06(date1, date2, rm);
+  rotate_spherical(rm, 0, n, dr, dd, dl, db);
+}
+
+/* iauLteceq, for n ecliptic coordinates at one Julian epoch (TT). */
+void terse_alternate_iauLteceqv(double epj, int n, const double dl[], const double db[], double dr[], double dd[]) {
+  double rm[3][3];
+  iauLtecm(epj, rm);
+  rotate_spherical(rm, 1, n, dl, db, dr, dd);
+}
+
+/* iauLteqec, for n ICRS coordinates at one Julian epoch (TT). */
+void terse_alternate_iauLteqecv(double epj, int n, const double dr[], const double dd[], double dl[], double db[]) {
+  double rm[3][3];
+  iauLtecm(epj, rm);
+  rotate_spherical(rm, 0, n, dr, dd, dl, db);
+}
+
+/* The IAU 2006 conversions, for a TT epoch (date1[i], date2[i]) per element. */
+static void ecm06_runs(int transpose, int n, const double date1[], const double date2[],
+    const double a[], const double b[], double out_a[], double out_b[]) {
+  for (int start = 0; start < n; ) {
+    int end = start + 1;
+    while (end < n && date1[end] == date1[start] && date2[end] == date2[start]) ++end;
+    double rm[3][3];
+    iauEcm06(date1[start], date2[start], rm);
+    rotate_spherical(rm, transpose, end - start, a + start, b + start, out_a + start, out_b + start);
+    start = end;
+  }
+}
+
+/* The long-term conversions, for a Julian epoch epj[i] per element. */
+static void ltecm_runs(int transpose, int n, const double epj[],
+    const double a[], const double b[], double out_a[], double out_b[]) {
+  for (int start = 0; start < n; ) {
+    int end = start + 1;
+    while (end < n && epj[end] == epj[start]) ++end;
+    double rm[3][3];
+    iauLtecm(epj[start], rm);
+    rotate_spherical(rm, transpose, end - start, a + start, b + start, out_a + start, out_b + start);
+    start = end;
+  }
+}
+
+/* iauEceq06 for n elements, each with its own TT epoch. */
+void terse_alternate_iauEceq06ev(int n, const double date1[], const double date2[], const double dl[], const double db[],
+    double dr[], double dd[]) {
+  ecm06_runs(1, n, date1, date2, dl, db, dr, dd);
+}
+
+/* iauEqec06 for n elements, each with its own TT epoch. */
+void terse_alternate_iauEqec06ev(int n, const double date1[], const double date2[], const double dr[], const double dd[],
+    double dl[], double db[]) {
+  ecm06_runs(0, n, date1, date2, dr, dd, dl, db);
+}
+
+/* iauLteceq for n elements, each with its own Julian epoch. */
+void terse_alternate_iauLteceqev(int n, const double epj[], const double dl[], const double db[], double dr[], double dd[]) {
+  ltecm_runs(1, n, epj, dl, db, dr, dd);
+}
+
+/* iauLteqec for n elements, each with its own Julian epoch. */
+void terse_alternate_iauLteqecev(int n, const double epj[], const double dr[], const double dd[], double dl[], double db[]) {
+  ltecm_runs(0, n, epj, dr, dd, dl, db);
+}
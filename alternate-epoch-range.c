@@ -0,0 +1,108 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Batch time-series functions that take a range of regularly spaced epochs, implemented in C99.
+
+ A time series is usually a start epoch, a step, and a count.
+ Passing those three things, instead of arrays of (date1, date2) pairs, saves building
+ the arrays and the memory traffic of reading them back.
+
+ The epochs are generated one at a time, as date1 and (date2 + i*step).
+ The step is never accumulated, so there's no drift over long series.
+ As usual for SOFA, it's best to put the whole part of the date in date1, and
+ the small remainder in date2.
+*/
+
+/* The i-th epoch (0-based) of the range, as a two-part Julian date. */
+void terse_alternate_iauEpochAt(const terse_alternate_iauEPOCHS *epochs, int i, double *d1, double *d2) {
+  *d1 = epochs->date1;
+  *d2 = epochs->date2 + i * epochs->step;
+}
+
+typedef struct {
+  const terse_alternate_iauEPOCHS *epochs;
+  double (*rbpn)[3][3];
+  double (*pvh)[2][3], (*pvb)[2][3];
+  int status;        //the worst status of the blocks; only through the __atomic builtins
+} epochs_args;
+
+static void pnm06av_block(void *ctx, int begin, int end) {
+  epochs_args *a = ctx;
+  for (int i = begin; i < end; ++i) {
+    double d1, d2;
+    terse_alternate_iauEpochAt(a->epochs, i, &d1, &d2);
+    iauPnm06a(d1, d2, a->rbpn[i]);
+  }
+}
+
+/* iauPnm06a, for each epoch in a range of TT, using up to nthreads threads (0 for one per CPU). */
+void terse_alternate_iauPnm06av(const terse_alternate_iauEPOCHS *tt, int nthreads, double rbpn[][3][3]) {
+  epochs_args args = { tt, rbpn, NULL, NULL, 0 };
+  terse_alternate_iauParallelFor(tt->n, nthreads, pnm06av_block, &args);
+}
+
+static void epv00v_block(void *ctx, int begin, int end) {
+  epochs_args *a = ctx;
+  int status = 0;
+  for (int i = begin; i < end; ++i) {
+    double d1, d2;
+    terse_alternate_iauEpochAt(a->epochs, i, &d1, &d2);
+    status |= iauEpv00(d1, d2, a->pvh[i], a->pvb[i]);
+  }
+  if (status) __atomic_fetch_or(&a->status, status, __ATOMIC_RELAXED);
+}
+
+/*
+ iauEpv00, for each epoch in a range of TDB, using up to nthreads threads (0 for one per CPU).
+ Returns the worst status from iauEpv00: +1 if any epoch is outside the years 1900-2100, otherwise 0.
+*/
+int terse_alternate_iauEpv00v(const terse_alternate_iauEPOCHS *tdb, int nthreads, double pvh[][2][3], double pvb[][2][3]) {
+  epochs_args args = { tdb, NULL, pvh, pvb, 0 };
+  terse_alternate_iauParallelFor(tdb->n, nthreads, epv00v_block, &args);
+  //terse_alternate_iauParallelFor returns only when every block is done, after the join that orders their stores before this load
+  return __atomic_load_n(&args.status, __ATOMIC_RELAXED);
+}
+
+/*
+ iauC2t06a, for each epoch in a range of TT, together with a range of UT1.
+ The two ranges have the same count; ut1 usually has the same step as tt.
+ The polar motion xp, yp (radians) is taken as constant over the range.
+
+ The fixed spacing is exploited for the Earth rotation angle, which is linear in UT1:
+ it's advanced by a fixed increment, rather than being recomputed from scratch.
+ In the reproducible mode (terse_alternate_iauReproducible), it's computed by iauEra00 at every epoch, and the
+ matrices are identical to those of iauC2t06a.
+*/
+void terse_alternate_iauC2t06av(const terse_alternate_iauEPOCHS *tt, const terse_alternate_iauEPOCHS *ut1, double xp, double yp, double rc2t[][3][3]) {
+  //ERA = 2pi * (0.7790572732640 + 1.00273781191135448 * Du); the whole days of i*step drop out
+  double era0 = iauEra00(ut1->date1, ut1->date2);
+  double step_fraction = fmod(ut1->step, 1.0);
+  int reproducible = terse_alternate_iauIsReproducible();
+
+  for (int i = 0; i < tt->n; ++i) {
+    double d1, d2, u1, u2, rbpn[3][3], x, y, rc2i[3][3], rpom[3][3];
+    terse_alternate_iauEpochAt(tt, i, &d1, &d2);
+
+    //celestial-to-intermediate matrix
+    iauPnm06a(d1, d2, rbpn);
+    iauBpn2xy(rbpn, &x, &y);
+    iauC2ixys(x, y, iauS06(d1, d2, x, y), rc2i);
+
+    //Earth rotation angle
+    double era;
+    if (reproducible) {
+      terse_alternate_iauEpochAt(ut1, i, &u1, &u2);
+      era = iauEra00(u1, u2);
+    } else {
+      double turns = fmod(i * step_fraction, 1.0) + fmod(i * ut1->step * 0.00273781191135448, 1.0);
+      era = iauAnp(era0 + D2PI * turns);
+    }
+
+    //polar motion matrix (TIO locator s' changes with TT)
+    iauPom00(xp, yp, iauSp00(d1, d2), rpom);
+
+    iauC2tcio(rc2i, era, rpom, rc2t[i]);
+  }
+}
@@ -0,0 +1,119 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Batch conversions between ICRS RA,Dec and galactic coordinates, for whole catalogs, implemented in C99.
+
+ iauIcrs2g and iauG2icrs spend almost all of their time in the sin, cos and atan2 of iauS2c and iauC2s.
+ Calls into the math library can't be vectorized, so here sin, cos and atan2 are computed inline, without
+ branches, by fast_sincos and fast_atan2 (alternate-headers.h).
+ Every step of a block of stars is then a plain loop of arithmetic and selects, which the compiler can
+ vectorize with whatever SIMD instructions the target has, and the blocks are shared among threads.
+
+ The results agree with iauIcrs2g and iauG2icrs to under 1e-15 radians on the sky,
+ well within the 1e-14 of their tests in t_sofa_c.c, but they aren't bit-identical. Angles of more than
+ 1e6 radians, infinities and NaNs are passed to the SOFA functions instead. In the reproducible mode
+ (terse_alternate_iauReproducible), every star is passed to them, so the results are bit-identical.
+
+ The input and output arrays may be the same.
+*/
+
+enum { BLOCK = 256 };
+
+/* Beyond this (radians), the reduction by pi/2 loses accuracy. */
+static const double LARGEST_ANGLE = 1e6;
+
+/* ICRS to galactic rotation matrix, as in iauIcrs2g. */
+static const double ICRS_TO_GALACTIC[3][3] = {
+   { -0.054875560416215368492398900454, -0.873437090234885048760383168409, -0.483835015548713226831774175116 },
+   { +0.494109427875583673525222371358, -0.444829629960011178146614061616, +0.746982244497218890527388004556 },
+   { -0.867666149019004701181616534570, -0.198076373431201528180486091412, +0.455983776175066922272100478348 } };
+
+/* Rotate a block of count spherical coordinates by r: iauS2c, iauRxp, iauC2s, iauAnp and iauAnpm. */
+static void rotate_block(const double r[3][3], int count, const double a[], const double b[],
+    double out_a[], double out_b[]) {
+  double x[BLOCK], y[BLOCK], z[BLOCK];
+  for (int i = 0; i < count; ++i) {
+    double sa, ca, sb, cb;
+    fast_sincos(a[i], &sa, &ca);
+    fast_sincos(b[i], &sb, &cb);
+    x[i] = ca * cb;
+    y[i] = sa * cb;
+    z[i] = sb;
+  }
+  for (int i = 0; i < count; ++i) {
+    double u = r[0][0]*x[i] + r[0][1]*y[i] + r[0][2]*z[i];
+    double v = r[1][0]*x[i] + r[1][1]*y[i] + r[1][2]*z[i];
+    double w = r[2][0]*x[i] + r[2][1]*y[i] + r[2][2]*z[i];
+    x[i] = u;
+    y[i] = v;
+    z[i] = w;
+  }
+  for (int i = 0; i < count; ++i) {
+    double d2 = x[i]*x[i] + y[i]*y[i];
+    double theta = (d2 == 0.0) ? 0.0 : fast_atan2(y[i], x[i]);
+    double phi = (z[i] == 0.0) ? 0.0 : fast_atan2(z[i], sqrt(d2));
+    //theta is within +/-pi, and phi within +/-pi/2, so iauAnp and iauAnpm reduce to this
+    out_a[i] = (theta < 0.0) ? theta + D2PI : theta;
+    out_b[i] = phi;
+  }
+}
+
+typedef struct {
+  double r[3][3];
+  void (*scalar)(double a, double b, double *out_a, double *out_b);
+  int reproducible;
+  const double *a, *b;
+  double *out_a, *out_b;
+} galactic_args;
+
+static void galactic_body(void *ctx, int begin, int end) {
+  const galactic_args *g = ctx;
+  if (g->reproducible) {
+    for (int i = begin; i < end; ++i) g->scalar(g->a[i], g->b[i], &g->out_a[i], &g->out_b[i]);
+    return;
+  }
+  for (int start = begin; start < end; start += BLOCK) {
+    int count = (end - start < BLOCK) ? end - start : BLOCK;
+    //the few stars outside the fast range are done afterwards; the inputs may be overwritten, so keep them
+    double a[BLOCK], b[BLOCK];
+    int num_slow = 0;
+    for (int i = 0; i < count; ++i) {
+      a[i] = g->a[start + i];
+      b[i] = g->b[start + i];
+      num_slow += !(fabs(a[i]) <= LARGEST_ANGLE && fabs(b[i]) <= LARGEST_ANGLE);
+    }
+    rotate_block((const double (*)[3])g->r, count, a, b, g->out_a + start, g->out_b + start);
+    for (int i = 0; num_slow > 0 && i < count; ++i) {
+      if (!(fabs(a[i]) <= LARGEST_ANGLE && fabs(b[i]) <= LARGEST_ANGLE)) {
+        g->scalar(a[i], b[i], &g->out_a[start + i], &g->out_b[start + i]);
+        --num_slow;
+      }
+    }
+  }
+}
+
+/*
+ iauIcrs2g for n stars, using up to nthreads threads (0 for one per CPU).
+ Given dr, dd (ICRS RA,Dec, radians); returned dl, db (galactic longitude and latitude, radians).
+*/
+void terse_alternate_iauIcrs2gv(int n, int nthreads, const double dr[], const double dd[], double dl[], double db[]) {
+  galactic_args g = {{{0.0}}, iauIcrs2g, terse_alternate_iauIsReproducible(), dr, dd, dl, db};
+  for (int j = 0; j < 3; ++j) {
+    for (int i = 0; i < 3; ++i) g.r[j][i] = ICRS_TO_GALACTIC[j][i];
+  }
+  terse_alternate_iauParallelFor(n, nthreads, galactic_body, &g);
+}
+
+/*
+ iauG2icrs for n stars, using up to nthreads threads (0 for one per CPU).
+ Given dl, db (galactic longitude and latitude, radians); returned dr, dd (ICRS RA,Dec, radians).
+*/
+void terse_alternate_iauG2icrsv(int n, int nthreads, const double dl[], const double db[], double dr[], double dd[]) {
+  galactic_args g = {{{0.0}}, iauG2icrs, terse_alternate_iauIsReproducible(), dl, db, dr, dd};
+  for (int j = 0; j < 3; ++j) {
+    for (int i = 0; i < 3; ++i) g.r[j][i] = ICRS_TO_GALACTIC[i][j];
+  }
+  terse_alternate_iauParallelFor(n, nthreads, galactic_body, &g);
+}
@@ -1,4 +1,453 @@
+#include "sofa.h"
+#include <math.h>
+#include <stddef.h>
+
 int terse_alternate_iauCal2jd(int iy, int im, int id, double *djm0, double *djm);
 int terse_alternate_iauJd2cal(double dj1, double dj2, int *iy, int *im, int *id, double *fd);
 int the_month_len(int y, int m);
-int iauCal2jdWallace(int iy, int im, int id, double *djm0, double *djm);
\ No newline at end of file
+int iauCal2jdWallace(int iy, int im, int id, double *djm0, double *djm);
+
+/* Deterministic-time variants of the ICRS-observed functions. */
+void terse_alternate_iauAtioqd(double ri, double di, iauASTROM *astrom, double *aob, double *zob, double *hob, double *dob, double *rob);
+void terse_alternate_iauAtoiqd(const char *type, double ob1, double ob2, iauASTROM *astrom, double *ri, double *di);
+int terse_alternate_iauAtco13d(double rc, double dc, double pr, double pd, double px, double rv,
+    double utc1, double utc2, double dut1, double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl,
+    double *aob, double *zob, double *hob, double *dob, double *rob, double *eo);
+int terse_alternate_iauFtz(int on);
+
+/* Latency profiling: the distribution of the time taken by single calls, in nanoseconds. */
+typedef struct {
+   int n;          /* number of calls timed */
+   double p50;     /* median */
+   double p99;     /* 99th percentile */
+   double p9999;   /* 99.99th percentile */
+   double max;     /* the slowest call */
+} terse_alternate_iauLATENCY;
+double terse_alternate_now_ns(void);
+void terse_alternate_latency_profile(void (*func)(void *ctx, int i), void *ctx, int n, double *scratch, terse_alternate_iauLATENCY *result);
+void terse_alternate_run_latency_profiles(void);
+
+/* Output-selective ICRS-observed functions. The mask is a combination of these flags. */
+#define IAU_OBS_AZ    1
+#define IAU_OBS_ZD    2
+#define IAU_OBS_HA    4
+#define IAU_OBS_DEC   8
+#define IAU_OBS_RA   16
+#define IAU_OBS_AZZD  (IAU_OBS_AZ | IAU_OBS_ZD)
+#define IAU_OBS_HADEC (IAU_OBS_HA | IAU_OBS_DEC)
+#define IAU_OBS_ALL   (IAU_OBS_AZZD | IAU_OBS_HADEC | IAU_OBS_RA)
+void terse_alternate_iauAtioqm(int mask, double ri, double di, iauASTROM *astrom,
+    double *aob, double *zob, double *hob, double *dob, double *rob);
+void terse_alternate_iauAtioqmv(int mask, int n, const double ri[], const double di[], iauASTROM *astrom,
+    double aob[], double zob[], double hob[], double dob[], double rob[]);
+int terse_alternate_iauAtco13m(int mask, double rc, double dc, double pr, double pd, double px, double rv,
+    double utc1, double utc2, double dut1, double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl,
+    double *aob, double *zob, double *hob, double *dob, double *rob, double *eo);
+int terse_alternate_iauAtco13mv(int mask, int n, const double rc[], const double dc[],
+    const double pr[], const double pd[], const double px[], const double rv[],
+    double utc1, double utc2, double dut1, double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl,
+    double aob[], double zob[], double hob[], double dob[], double rob[], double *eo);
+
+/* A range of regularly spaced epochs: date1 + (date2 + i*step), for i = 0..n-1. */
+typedef struct {
+   double date1;   /* first epoch, as a two-part Julian date ... */
+   double date2;   /* ... */
+   double step;    /* the spacing between epochs (days) */
+   int n;          /* the number of epochs */
+} terse_alternate_iauEPOCHS;
+void terse_alternate_iauEpochAt(const terse_alternate_iauEPOCHS *epochs, int i, double *d1, double *d2);
+void terse_alternate_iauPnm06av(const terse_alternate_iauEPOCHS *tt, int nthreads, double rbpn[][3][3]);
+int terse_alternate_iauEpv00v(const terse_alternate_iauEPOCHS *tdb, int nthreads, double pvh[][2][3], double pvb[][2][3]);
+void terse_alternate_iauC2t06av(const terse_alternate_iauEPOCHS *tt, const terse_alternate_iauEPOCHS *ut1, double xp, double yp, double rc2t[][3][3]);
+
+/* A read-only memory mapping of a whole file. */
+typedef struct {
+   const void *base;   /* the first byte of the file */
+   size_t size;        /* the size of the file (bytes) */
+   void *handle;       /* the operating system's handle, if it needs one */
+} terse_alternate_iauMAPPING;
+int terse_alternate_map_file(const char *path, terse_alternate_iauMAPPING *mapping);
+void terse_alternate_unmap_file(terse_alternate_iauMAPPING *mapping);
+unsigned long long terse_alternate_fnv1a64(const void *data, size_t size);
+unsigned long long terse_alternate_fnv1a64_more(unsigned long long hash, const void *data, size_t size);
+
+/* A precomputed, memory-mapped astrometry almanac. */
+#define ALMANAC_RECORD_SIZE 18
+typedef struct {
+   terse_alternate_iauMAPPING mapping;
+   const double *records;   /* n records of ALMANAC_RECORD_SIZE doubles, in place in the mapping */
+   int n;                   /* the number of grid nodes */
+   double tt1, tt2;         /* the first node (TT, two-part JD) */
+   double step;             /* the spacing of the nodes (days) */
+} terse_alternate_iauALMANAC;
+/* A source of Earth orientation parameters: UT1-UTC (s) and polar motion (radians), for a UTC. */
+typedef void (*terse_alternate_iauEOPFUNC)(void *ctx, double utc1, double utc2, double *dut1, double *xp, double *yp);
+int terse_alternate_iauAlmanacWrite(const char *path, double tt1, double tt2, double step, int n, terse_alternate_iauEOPFUNC eop, void *eop_ctx);
+int terse_alternate_iauAlmanacOpen(const char *path, int verify, terse_alternate_iauALMANAC *almanac);
+void terse_alternate_iauAlmanacClose(terse_alternate_iauALMANAC *almanac);
+int terse_alternate_iauAlmanacInterp(const terse_alternate_iauALMANAC *almanac, double tt1, double tt2, double record[ALMANAC_RECORD_SIZE]);
+int terse_alternate_iauAlmanacApci(const terse_alternate_iauALMANAC *almanac, double tt1, double tt2, iauASTROM *astrom, double *eo);
+int terse_alternate_iauAlmanacApco(const terse_alternate_iauALMANAC *almanac, double utc1, double utc2, const double eop[3],
+    double elong, double phi, double hm, double phpa, double tc, double rh, double wl,
+    iauASTROM *astrom, double *eo);
+int terse_alternate_run_almanac_tool(int argc, char *argv[]);
+
+/* Packed coefficient tables for the nutation and CIP X,Y series, in the order SOFA sums them. */
+#define NUT_LS_N 678
+#define NUT_PL_N 687
+#define XY_PL_N 656
+#define XY_LS_N 653
+#define XY_AMP_N 4755
+extern const signed char terse_alternate_nut_ls_mult[NUT_LS_N][5];
+extern const int terse_alternate_nut_ls_sp[NUT_LS_N], terse_alternate_nut_ls_spt[NUT_LS_N], terse_alternate_nut_ls_cp[NUT_LS_N];
+extern const int terse_alternate_nut_ls_ce[NUT_LS_N], terse_alternate_nut_ls_cet[NUT_LS_N], terse_alternate_nut_ls_se[NUT_LS_N];
+extern const signed char terse_alternate_nut_pl_mult[NUT_PL_N][13];
+extern const short terse_alternate_nut_pl_sp[NUT_PL_N], terse_alternate_nut_pl_cp[NUT_PL_N], terse_alternate_nut_pl_se[NUT_PL_N], terse_alternate_nut_pl_ce[NUT_PL_N];
+extern const signed char terse_alternate_xy_pl_mult[XY_PL_N][14];
+extern const signed char terse_alternate_xy_ls_mult[XY_LS_N][5];
+extern const unsigned char terse_alternate_xy_count[XY_PL_N + XY_LS_N];
+extern const double terse_alternate_xy_amp[XY_AMP_N];
+void terse_alternate_nut00a_ls_args(double t, double fa[5]);
+void terse_alternate_nut00a_pl_args(double t, double fa[13]);
+double terse_alternate_nut00a_ls_arg(int i, const double fa[5]);
+double terse_alternate_nut00a_pl_arg(int i, const double fa[13]);
+void terse_alternate_iauNut00aPacked(double date1, double date2, double *dpsi, double *deps);
+void terse_alternate_iauXy06Packed(double date1, double date2, double *x, double *y);
+
+/* A nutation stepper: IAU 2000A nutation at regularly spaced epochs, by rotating the sin/cos of each term. */
+typedef struct {
+   double date1, date2;     /* the first epoch (TT, two-part JD) */
+   double step;             /* the spacing of the epochs (days) */
+   int refresh;             /* the number of epochs between recomputations from scratch */
+   int i;                   /* the current epoch is date1 + (date2 + i*step) */
+   double ls_sin[NUT_LS_N], ls_cos[NUT_LS_N];     /* sin/cos of the luni-solar arguments, at the current epoch */
+   double ls_rsin[NUT_LS_N], ls_rcos[NUT_LS_N];   /* sin/cos of their increments per step */
+   double pl_sin[NUT_PL_N], pl_cos[NUT_PL_N];     /* the same, for the planetary terms */
+   double pl_rsin[NUT_PL_N], pl_rcos[NUT_PL_N];
+} terse_alternate_iauNUTSTEP;
+void terse_alternate_iauNutStepInit(terse_alternate_iauNUTSTEP *ns, double date1, double date2, double step, int refresh);
+void terse_alternate_iauNutStep(terse_alternate_iauNUTSTEP *ns, double *dpsi, double *deps);
+
+/* The bitwise-reproducible mode. */
+int terse_alternate_iauReproducible(int on);
+int terse_alternate_iauIsReproducible(void);
+
+/* Threaded batch functions. */
+int terse_alternate_iauNumCpus(void);
+/*
+ An application's executor: run(executor, ntasks, task, arg) must call task(arg, i) once for each i in
+ 0..ntasks-1, in any order and on any threads, and return when all are done. concurrency is the number of
+ threads it runs tasks on (0 if unknown). From C++17, a run can be std::for_each(policy, ...) over the
+ task numbers, with std::execution::par or another policy.
+*/
+typedef struct {
+   void (*run)(void *executor, int ntasks, void (*task)(void *arg, int i), void *arg);
+   void *executor;
+   int concurrency;
+} terse_alternate_iauEXECUTOR;
+void terse_alternate_iauSetExecutor(const terse_alternate_iauEXECUTOR *executor);
+void terse_alternate_iauPoolStop(void);
+void terse_alternate_iauParallelFor(int n, int nthreads, void (*body)(void *ctx, int begin, int end), void *ctx);
+void terse_alternate_iauNut00av(const terse_alternate_iauEPOCHS *tt, int nthreads, double dpsi[], double deps[]);
+void terse_alternate_iauAtciqv(int n, int nthreads, const double rc[], const double dc[],
+    const double pr[], const double pd[], const double px[], const double rv[],
+    iauASTROM *astrom, double ri[], double di[]);
+
+/* Direct conversions between POSIX time (ns) or GNSS week/seconds, and TAI/TT two-part JDs. */
+#define IAU_GNSS_GPS 0
+#define IAU_GNSS_GALILEO 1
+#define IAU_GNSS_BEIDOU 2
+int terse_alternate_iauUnixToTai(long long unix_ns, double *tai1, double *tai2);
+int terse_alternate_iauUnixToTt(long long unix_ns, double *tt1, double *tt2);
+int terse_alternate_iauTaiToUnix(double tai1, double tai2, long long *unix_ns);
+int terse_alternate_iauTtToUnix(double tt1, double tt2, long long *unix_ns);
+int terse_alternate_iauGnssToTai(int system, int week, double sow, double *tai1, double *tai2);
+int terse_alternate_iauGnssToTt(int system, int week, double sow, double *tt1, double *tt2);
+int terse_alternate_iauTaiToGnss(int system, double tai1, double tai2, int *week, double *sow);
+int terse_alternate_iauUnixToTaiv(int n, const long long unix_ns[], double tai1[], double tai2[]);
+int terse_alternate_iauUnixToTtv(int n, const long long unix_ns[], double tt1[], double tt2[]);
+int terse_alternate_iauTaiToUnixv(int n, const double tai1[], const double tai2[], long long unix_ns[]);
+int terse_alternate_iauGnssToTtv(int system, int n, const int week[], const double sow[], double tt1[], double tt2[]);
+int terse_alternate_iauUtcDiffv(int n, const double a1[], const double a2[], const double b1[], const double b2[], double dt[]);
+int terse_alternate_iauUtcAddv(int n, const double utc1[], const double utc2[], const double dt[], double out1[], double out2[]);
+void terse_alternate_ns_to_jd(long long ns, double *d1, double *d2);
+int terse_alternate_leap_table_dat(long long unix_s, int *tai_utc, long long *from, long long *until);
+
+/* The current epoch, from the system clock. One clock per thread. */
+typedef struct {
+   terse_alternate_iauEOPFUNC eop;          /* the source of UT1-UTC, or NULL for zero */
+   void *eop_ctx;
+   int use_tai_clock;       /* 1 if the system's TAI clock is used, instead of the realtime clock and the leap-second table */
+   long long day_start;     /* the UTC day of the cached values, as POSIX times (s): start ... */
+   long long day_end;       /* ... and end */
+   int tai_utc;             /* TAI-UTC for the day (s) */
+   int status;              /* the status of the leap-second lookup for the day */
+   long long ut1_tai_ns;    /* UT1-TAI at the start of the day (ns) ... */
+   double ut1_tai_rate;     /* ... and its rate of change, across the day */
+} terse_alternate_iauCLOCK;
+void terse_alternate_iauClockInit(terse_alternate_iauCLOCK *clock, terse_alternate_iauEOPFUNC eop, void *eop_ctx);
+int terse_alternate_iauNow(terse_alternate_iauCLOCK *clock, double *tai1, double *tai2, double *tt1, double *tt2, double *ut11, double *ut12);
+
+/* Catalog epoch propagation with covariances. A batch of stars, as a structure of arrays, in the units of iauStarpm. */
+typedef struct {
+   int n;                      /* the number of stars */
+   double *ra, *dec;           /* radians */
+   double *pmr, *pmd;          /* dRA/dt, dDec/dt (radians/year) */
+   double *px;                 /* parallax (arcsec) */
+   double *rv;                 /* radial velocity (km/s) */
+} terse_alternate_iauSTARS;
+/* The same, read-only: as input, and for stars in place in a read-only mapping. */
+typedef struct {
+   int n;
+   const double *ra, *dec, *pmr, *pmd, *px, *rv;
+} terse_alternate_iauCSTARS;
+int terse_alternate_iauStarpmJac(double ra1, double dec1, double pmr1, double pmd1, double px1, double rv1,
+    double ep1a, double ep1b, double ep2a, double ep2b,
+    double *ra2, double *dec2, double *pmr2, double *pmd2, double *px2, double *rv2, double jac[6][6]);
+int terse_alternate_iauPmsafeJac(double ra1, double dec1, double pmr1, double pmd1, double px1, double rv1,
+    double ep1a, double ep1b, double ep2a, double ep2b,
+    double *ra2, double *dec2, double *pmr2, double *pmd2, double *px2, double *rv2, double jac[6][6]);
+void terse_alternate_iauCovProp(double jac[6][6], double cov1[6][6], double cov2[6][6]);
+int terse_alternate_iauStarpmCovv(const terse_alternate_iauCSTARS *in, double ep1a, double ep1b, double ep2a, double ep2b,
+    double cov1[][6][6], terse_alternate_iauSTARS *out, double cov2[][6][6], int status[], int nthreads);
+
+/* A columnar, memory-mapped star catalog. */
+#define IAU_CATALOG_UNIT_VECTORS 1   /* store the unit vectors of the stars */
+#define IAU_CATALOG_SORT 2           /* sort the stars by position, when writing */
+typedef struct {
+   terse_alternate_iauMAPPING mapping;
+   int n;                               /* the number of stars */
+   int block_size;                      /* the number of stars per block (the last may have fewer) */
+   int num_blocks;
+   const double *ra, *dec, *pmr, *pmd, *px, *rv;   /* the columns, in place in the mapping */
+   const double *u[3];                  /* the unit vectors' x, y, z columns, or NULL */
+   const long long *index;              /* the row of each star in the imported data */
+   const double (*bounds)[4];           /* per block: min and max RA (0-2pi), min and max Dec */
+} terse_alternate_iauCATALOG;
+int terse_alternate_iauCatalogWrite(const char *path, const terse_alternate_iauCSTARS *stars, int block_size, int flags);
+int terse_alternate_iauCatalogImport(const char *text_path, const char *path, int block_size, int flags);
+int terse_alternate_iauCatalogOpen(const char *path, int verify, terse_alternate_iauCATALOG *catalog);
+void terse_alternate_iauCatalogClose(terse_alternate_iauCATALOG *catalog);
+int terse_alternate_iauCatalogCone(const terse_alternate_iauCATALOG *catalog, double ra, double dec, double radius, int blocks[]);
+void terse_alternate_iauCatalogStars(const terse_alternate_iauCATALOG *catalog, int begin, int end, terse_alternate_iauCSTARS *stars);
+int terse_alternate_run_catalog_tool(int argc, char *argv[]);
+
+/* A tracker for one target, interpolating the observed place between nodes computed on a background thread. */
+typedef struct {
+   double rc, dc, pr, pd, px, rv;          /* the target, as for iauAtco13 */
+   double dut1, elong, phi, hm, xp, yp;    /* Earth orientation and the site, as for iauAtco13 */
+   double phpa, tc, rh, wl;                /* the refraction parameters, as for iauAtco13 */
+} terse_alternate_iauTRACKTARGET;
+typedef struct terse_alternate_iauTRACKER terse_alternate_iauTRACKER;
+int terse_alternate_iauTrackerStart(const terse_alternate_iauTRACKTARGET *target, double utc1, double utc2, double step, terse_alternate_iauTRACKER **tracker);
+int terse_alternate_iauTrackerGet(terse_alternate_iauTRACKER *tracker, double utc1, double utc2, double *az, double *zd, double *pa, double *err);
+void terse_alternate_iauTrackerStop(terse_alternate_iauTRACKER *tracker);
+
+/* Batch ecliptic <-> ICRS conversions, with one rotation matrix per epoch. */
+void terse_alternate_iauEceq06v(double date1, double date2, int n, const double dl[], const double db[], double dr[], double dd[]);
+void terse_alternate_iauEqec06v(double date1, double date2, int n, const double dr[], const double dd[], double dl[], double db[]);
+void terse_alternate_iauLteceqv(double epj, int n, const double dl[], const double db[], double dr[], double dd[]);
+void terse_alternate_iauLteqecv(double epj, int n, const double dr[], const double dd[], double dl[], double db[]);
+void terse_alternate_iauEceq06ev(int n, const double date1[], const double date2[], const double dl[], const double db[],
+    double dr[], double dd[]);
+void terse_alternate_iauEqec06ev(int n, const double date1[], const double date2[], const double dr[], const double dd[],
+    double dl[], double db[]);
+void terse_alternate_iauLteceqev(int n, const double epj[], const double dl[], const double db[], double dr[], double dd[]);
+void terse_alternate_iauLteqecev(int n, const double epj[], const double dr[], const double dd[], double dl[], double db[]);
+
+/*
+ Inline, branch-free sin, cos and atan2 for batch loops, which the compiler can vectorize (calls into the
+ math library can't be): the polynomials of fdlibm (the basis of most C math libraries), with Cody-Waite
+ reduction by pi/2 and minimax polynomials for sin and cos on +/-pi/4, and reduction by tan(pi/8) for atan.
+ They agree with the C library to within an ulp or so.
+*/
+/* sin and cos of x, for |x| <= 1e6 (beyond that, the reduction by pi/2 loses accuracy). */
+static inline void fast_sincos(double x, double *s, double *c) {
+  //pi/2 in three parts, the first two with trailing zero bits (fdlibm's pio2_1, pio2_2 and pio2_3)
+  const double PIO2_1 = 1.57079632673412561417e+00;
+  const double PIO2_2 = 6.07710050630396597660e-11;
+  const double PIO2_3 = 2.02226624871116645580e-21;
+  const double INV_PIO2 = 6.36619772367581382433e-01;
+  //adding and subtracting this rounds to the nearest integer (for magnitudes under 2^51)
+  const double ROUNDER = 6755399441055744.0;
+  double n = (x * INV_PIO2 + ROUNDER) - ROUNDER;
+  double r = ((x - n * PIO2_1) - n * PIO2_2) - n * PIO2_3;
+  int quadrant = (int)(long long)n & 3;
+
+  //fdlibm's __kernel_sin and __kernel_cos, on +/-pi/4
+  double z = r * r;
+  double sp = 8.33333333332248946124e-03 + z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06
+      + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)));
+  double sr = r + z * r * (-1.66666666666666324348e-01 + z * sp);
+  double cp = z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 + z * (2.48015872894767294178e-05
+      + z * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+  double hz = 0.5 * z;
+  double w = 1.0 - hz;
+  double cr = w + (((1.0 - w) - hz) + z * cp);
+
+  *s = (quadrant == 0) ? sr : (quadrant == 1) ? cr : (quadrant == 2) ? -sr : -cr;
+  *c = (quadrant == 0) ? cr : (quadrant == 1) ? -sr : (quadrant == 2) ? -cr : sr;
+}
+
+/* atan2(y, x), for finite x and y, with the same signs and ranges as the C library's. */
+static inline double fast_atan2(double y, double x) {
+  double ax = fabs(x), ay = fabs(y);
+  int swap = ay > ax;
+  double num = swap ? ax : ay, den = swap ? ay : ax;
+  //num is 0 whenever den is; the divisions are unconditional, so that loops of them can be vectorized
+  double a = num / ((den == 0.0) ? 1.0 : den);
+
+  //reduce to |t| <= tan(pi/8), using atan(a) = pi/4 + atan((a-1)/(a+1))
+  int big = a > 0.41421356237309503;
+  double reduced = (a - 1.0) / (a + 1.0);
+  double t = big ? reduced : a;
+
+  //fdlibm's atan polynomial, for |t| < 7/16
+  double z = t * t, w = z * z;
+  double s1 = z * (3.33333333333329318027e-01 + w * (1.42857142725034663711e-01 + w * (9.09088713343650656196e-02
+      + w * (6.66107313738753120669e-02 + w * (4.97687799461593236017e-02 + w * 1.62858201153657823623e-02)))));
+  double s2 = w * (-1.99999999998764832476e-01 + w * (-1.11111104054623557880e-01 + w * (-7.69187620504482999495e-02
+      + w * (-5.83357013379057348645e-02 + w * -3.65315727442169155270e-02))));
+  double r = t - t * (s1 + s2);
+  r = big ? 7.85398163397448278999e-01 + (3.06161699786838301793e-17 + r) : r;
+
+  //back to the octant, the half-plane and the sign of y
+  r = swap ? 1.57079632679489655800e+00 - (r - 6.12323399573676603587e-17) : r;
+  r = (x < 0.0) ? 3.14159265358979311600e+00 - (r - 1.22464679914735317720e-16) : r;
+  return copysign(r, y);
+}
+
+/* Batch, threaded ICRS <-> galactic conversions, with inline vectorizable trigonometry. */
+void terse_alternate_iauIcrs2gv(int n, int nthreads, const double dr[], const double dd[], double dl[], double db[]);
+void terse_alternate_iauG2icrsv(int n, int nthreads, const double dl[], const double db[], double dr[], double dd[]);
+
+/* Batch sexagesimal formatting and parsing, between fixed-stride text records and radians or days. */
+int terse_alternate_iauA2tfv(int ndp, char sep, int n, const double angle[], char *text, size_t stride, int *width);
+int terse_alternate_iauA2afv(int ndp, char sep, int n, const double angle[], char *text, size_t stride, int *width);
+int terse_alternate_iauD2tfv(int ndp, char sep, int n, const double days[], char *text, size_t stride, int *width);
+int terse_alternate_iauTf2av(int n, const char *text, size_t stride, double rad[], int status[]);
+int terse_alternate_iauAf2av(int n, const char *text, size_t stride, double rad[], int status[]);
+int terse_alternate_iauTf2dv(int n, const char *text, size_t stride, double days[], int status[]);
+
+/* Accuracy profiles: the high-level functions, routed to the cheapest models that meet a target accuracy. */
+#define IAU_ACCURACY_FULL     0   /* the full IAU 2006/2000A models */
+#define IAU_ACCURACY_MAS      1   /* 1 milliarcsecond */
+#define IAU_ACCURACY_ARCSEC   2   /* 1 arcsecond */
+#define IAU_ACCURACY_ARCMIN   3   /* 1 arcminute */
+#define IAU_ACCURACY_PROFILES 4
+typedef struct {
+   const char *name;
+   double sky_error;    /* the largest error on the sky, against the full models, 1995-2050 (radians) */
+   double gst_error;    /* the largest error in sidereal time and the equation of the origins (radians) */
+   double apco13_time;  /* the time of terse_alternate_iauApco13p, relative to iauApco13 */
+   double gst_time;     /* the time of terse_alternate_iauGstp, relative to iauGst06a */
+   const char *models;
+} terse_alternate_iauACCURACYPROFILE;
+extern const terse_alternate_iauACCURACYPROFILE terse_alternate_iauAccuracyProfiles[IAU_ACCURACY_PROFILES];
+typedef struct {
+   double target;       /* the accuracy asked for (radians) */
+   int profile;         /* the profile for places on the sky: one of the IAU_ACCURACY_* */
+   int gst_profile;     /* the profile for sidereal time */
+} terse_alternate_iauACCURACY;
+void terse_alternate_iauAccuracyInit(double target, terse_alternate_iauACCURACY *acc);
+int terse_alternate_iauApco13p(const terse_alternate_iauACCURACY *acc, double utc1, double utc2, double dut1,
+    double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl, iauASTROM *astrom, double *eo);
+void terse_alternate_iauApci13p(const terse_alternate_iauACCURACY *acc, double date1, double date2, iauASTROM *astrom, double *eo);
+int terse_alternate_iauAtco13p(const terse_alternate_iauACCURACY *acc, double rc, double dc, double pr, double pd, double px, double rv,
+    double utc1, double utc2, double dut1, double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl,
+    double *aob, double *zob, double *hob, double *dob, double *rob, double *eo);
+double terse_alternate_iauGstp(const terse_alternate_iauACCURACY *acc, double uta, double utb, double tta, double ttb);
+
+/* Refraction at many wavelengths and field positions: the constants of iauRefco, and iauAtioq's refraction. */
+void terse_alternate_iauRefcov(double phpa, double tc, double rh, int n, const double wl[], double refa[], double refb[]);
+void terse_alternate_iauRefzv(int nwl, const double refa[], const double refb[], int iref, int n, const double zt[], double dz[]);
+
+/* The ICRS <-> observed transformations with their Jacobians (jac[output][input], inputs then time in s). */
+void terse_alternate_iauAtciqJ(double rc, double dc, double pr, double pd, double px, double rv, iauASTROM *astrom,
+    double *ri, double *di, double jac[2][2]);
+void terse_alternate_iauAticqJ(double ri, double di, iauASTROM *astrom, double *rc, double *dc, double jac[2][2]);
+void terse_alternate_iauAtioqJ(double ri, double di, iauASTROM *astrom,
+    double *aob, double *zob, double *hob, double *dob, double *rob, double jac[5][3]);
+void terse_alternate_iauAtoiqJ(const char *type, double ob1, double ob2, iauASTROM *astrom, double *ri, double *di,
+    double jac[2][3]);
+int terse_alternate_iauAtco13J(double rc, double dc, double pr, double pd, double px, double rv,
+    double utc1, double utc2, double dut1, double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl,
+    double *aob, double *zob, double *hob, double *dob, double *rob, double *eo, double jac[5][3]);
+int terse_alternate_iauAtoc13J(const char *type, double ob1, double ob2,
+    double utc1, double utc2, double dut1, double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl, double *rc, double *dc, double jac[2][3]);
+
+/* The celestial-to-terrestrial matrix with its time derivative (per day), in a single pass. */
+void terse_alternate_iauNut00aDot(double date1, double date2, double *dpsi, double *deps, double *dpsidot, double *depsdot);
+void terse_alternate_iauPnm06aDot(double date1, double date2, double rbpn[3][3], double rbpndot[3][3]);
+void terse_alternate_iauC2ixysDot(double x, double y, double s, double xdot, double ydot, double sdot,
+    double rc2i[3][3], double rc2idot[3][3]);
+void terse_alternate_iauC2i06aDot(double date1, double date2, double rc2i[3][3], double rc2idot[3][3]);
+void terse_alternate_iauPom00Dot(double xp, double yp, double sp, double xpdot, double ypdot, double spdot,
+    double rpom[3][3], double rpomdot[3][3]);
+void terse_alternate_iauC2tcioDot(double rc2i[3][3], double rc2idot[3][3], double era, double eradot,
+    double rpom[3][3], double rpomdot[3][3], double rc2t[3][3], double rc2tdot[3][3]);
+void terse_alternate_iauC2t06aDot(double tta, double ttb, double uta, double utb, double xp, double yp,
+    double xpdot, double ypdot, double rc2t[3][3], double rc2tdot[3][3]);
+void terse_alternate_iauC2t06aDotv(const terse_alternate_iauEPOCHS *tt, const terse_alternate_iauEPOCHS *ut1, double xp, double yp, double xpdot, double ypdot,
+    double rc2t[][3][3], double rc2tdot[][3][3]);
+
+/* Batch topocentric azimuth, elevation and range of ITRS positions from many stations. */
+typedef struct {
+   double pos[3];      /* geocentric position, ITRS (m) */
+   double enu[3][3];   /* east, north and up unit vectors, ITRS */
+   double refa, refb;  /* refraction constants (radians), as from iauRefco; 0 for none */
+} terse_alternate_iauTOPOSTATION;
+int terse_alternate_iauTopoStation(int ellipsoid, double elong, double phi, double height, double refa, double refb,
+    terse_alternate_iauTOPOSTATION *station);
+void terse_alternate_iauItrs2aev(int nsta, const terse_alternate_iauTOPOSTATION station[], int n, const double x[], const double y[],
+    const double z[], int nthreads, double az[], double el[], double range[]);
+
+/* A cache of astrometry contexts shared by threads, keyed by the time (rounded) and the site. */
+typedef struct terse_alternate_iauASTROMCACHE terse_alternate_iauASTROMCACHE;
+typedef struct {
+   long long hits;        /* contexts found in the cache (including after waiting) */
+   long long misses;      /* contexts built */
+   long long waits;       /* waits for another thread to build a context */
+   long long evictions;   /* contexts replaced */
+} terse_alternate_iauASTROMCACHESTATS;
+int terse_alternate_iauAstromCacheNew(int capacity, double quantum, terse_alternate_iauASTROMCACHE **cache);
+void terse_alternate_iauAstromCacheFree(terse_alternate_iauASTROMCACHE *cache);
+void terse_alternate_iauAstromCacheApci13(terse_alternate_iauASTROMCACHE *cache, double date1, double date2, iauASTROM *astrom, double *eo);
+int terse_alternate_iauAstromCacheApco13(terse_alternate_iauASTROMCACHE *cache, double utc1, double utc2, double dut1,
+    double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl, iauASTROM *astrom, double *eo);
+void terse_alternate_iauAstromCacheStats(const terse_alternate_iauASTROMCACHE *cache, terse_alternate_iauASTROMCACHESTATS *stats);
+
+/* A search for solar and lunar eclipses over long spans of time. */
+#define IAU_ECLIPSE_SOLAR 1
+#define IAU_ECLIPSE_LUNAR 2
+#define IAU_ECLIPSE_PARTIAL 1
+#define IAU_ECLIPSE_ANNULAR 2
+#define IAU_ECLIPSE_TOTAL 3
+#define IAU_ECLIPSE_HYBRID 4
+#define IAU_ECLIPSE_PENUMBRAL 5
+typedef struct {
+   int type;                    /* IAU_ECLIPSE_SOLAR or IAU_ECLIPSE_LUNAR */
+   int kind;                    /* IAU_ECLIPSE_PARTIAL, ANNULAR, TOTAL or HYBRID (solar); PENUMBRAL, PARTIAL or TOTAL (lunar) */
+   double tt1, tt2;             /* the greatest eclipse (TT two-part JD) */
+   int iy, im, id;              /* its Gregorian date, and fraction of the day (TT) */
+   double fd;
+   double gamma;                /* the least distance of the shadow axis from the Earth's centre (solar), or of the
+                                   Moon's centre from the axis of the Earth's shadow (lunar), in Earth radii */
+   double magnitude;            /* the greatest magnitude (solar), or the umbral magnitude (lunar) */
+   double penumbral_magnitude;  /* lunar only */
+   double contacts[6];          /* days from the greatest eclipse, 0 for none: P1, U1, U2, U3, U4, P4 (lunar);
+                                   the penumbra first touches the Earth, the central phase starts, -, -, it ends,
+                                   the penumbra last leaves the Earth (solar) */
+} terse_alternate_iauECLIPSE;
+int terse_alternate_iauEclipseSearch(double tt1, double tt2, double days, int types, int nthreads, int max, terse_alternate_iauECLIPSE eclipses[]);
+
+/* Benchmarks: ./run_tests.exe bench */
+void terse_alternate_run_benchmarks(void);
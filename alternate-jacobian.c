@@ -0,0 +1,465 @@
+#include <string.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ The ICRS <-> observed transformations with their Jacobians, for pointing-model and astrometric fitting,
+ implemented in C99.
+
+ Finite-differencing iauAtco13 or iauAtciq/iauAtioq for the partial derivatives takes 3-5 calls per point.
+ Here, each function makes a single pass through the same steps as the SOFA function, in forward-mode
+ automatic differentiation: every intermediate quantity carries its partial derivatives with respect to the
+ two input coordinates and time, propagated by the chain rule through each operation. So the derivatives are
+ those of the algorithm itself (the refraction model, the iterations of iauAticq, the limiter in iauLdsun),
+ exact to rounding, and the transformed coordinates are the same as from the SOFA functions.
+
+ The derivatives with respect to time are for time in seconds (of UT1, or of UTC), and are those of the
+ diurnal motion: the rate of the Earth rotation angle, with the other astrometry parameters held fixed.
+ The slow changes of those (precession, aberration, proper motion) are below 1e-10 of the diurnal rate.
+
+ The Jacobians are jac[i][k]: output i, input k, with the inputs in the order of the function's arguments,
+ then time. Angles are in radians, whatever the ranges of the outputs (so azimuth wrapping through 2pi
+ doesn't show in the derivatives).
+*/
+
+/* The number of partial derivatives carried: the two input coordinates and time. */
+enum { NV = 3 };
+
+/* The rate of the Earth rotation angle (radians per second of UT1), as in iauEra00. */
+static const double ERA_RATE = D2PI * 1.00273781191135448 / DAYSEC;
+
+/* Minimum cos(alt) and sin(alt) for refraction purposes (the same values as iauAtioq and iauAtoiq). */
+static const double CELMIN = 1e-6;
+static const double SELMIN = 0.05;
+
+/* A value and its partial derivatives. */
+typedef struct {
+  double v;
+  double d[NV];
+} jet;
+
+static inline jet constant(double v) {
+  jet r = {v, {0.0}};
+  return r;
+}
+
+static inline jet variable(double v, int k) {
+  jet r = {v, {0.0}};
+  r.d[k] = 1.0;
+  return r;
+}
+
+static inline jet add(jet a, jet b) {
+  jet r;
+  r.v = a.v + b.v;
+  for (int k = 0; k < NV; ++k) r.d[k] = a.d[k] + b.d[k];
+  return r;
+}
+
+static inline jet sub(jet a, jet b) {
+  jet r;
+  r.v = a.v - b.v;
+  for (int k = 0; k < NV; ++k) r.d[k] = a.d[k] - b.d[k];
+  return r;
+}
+
+static inline jet mul(jet a, jet b) {
+  jet r;
+  r.v = a.v * b.v;
+  for (int k = 0; k < NV; ++k) r.d[k] = a.d[k] * b.v + a.v * b.d[k];
+  return r;
+}
+
+static inline jet scale(jet a, double s) {
+  jet r;
+  r.v = a.v * s;
+  for (int k = 0; k < NV; ++k) r.d[k] = a.d[k] * s;
+  return r;
+}
+
+static inline jet divide(jet a, jet b) {
+  jet r;
+  r.v = a.v / b.v;
+  for (int k = 0; k < NV; ++k) r.d[k] = (a.d[k] - r.v * b.d[k]) / b.v;
+  return r;
+}
+
+static inline jet square_root(jet a) {
+  jet r;
+  r.v = sqrt(a.v);
+  for (int k = 0; k < NV; ++k) r.d[k] = (r.v > 0.0) ? a.d[k] / (2.0 * r.v) : 0.0;
+  return r;
+}
+
+static inline jet sine(jet a) {
+  jet r;
+  double c = cos(a.v);
+  r.v = sin(a.v);
+  for (int k = 0; k < NV; ++k) r.d[k] = c * a.d[k];
+  return r;
+}
+
+static inline jet cosine(jet a) {
+  jet r;
+  double s = sin(a.v);
+  r.v = cos(a.v);
+  for (int k = 0; k < NV; ++k) r.d[k] = -s * a.d[k];
+  return r;
+}
+
+static inline jet arctan2(jet y, jet x) {
+  jet r;
+  double q = x.v * x.v + y.v * y.v;
+  r.v = atan2(y.v, x.v);
+  for (int k = 0; k < NV; ++k) r.d[k] = (q > 0.0) ? (x.v * y.d[k] - y.v * x.d[k]) / q : 0.0;
+  return r;
+}
+
+static inline jet dot(const jet a[3], const jet b[3]) {
+  return add(add(mul(a[0], b[0]), mul(a[1], b[1])), mul(a[2], b[2]));
+}
+
+static inline jet dot_constant(const jet a[3], const double b[3]) {
+  return add(add(scale(a[0], b[0]), scale(a[1], b[1])), scale(a[2], b[2]));
+}
+
+/* The matrix r times the vector p (iauRxp), or its transpose times p (iauTrxp). */
+static void rotate(const double r[3][3], int transpose, const jet p[3], jet out[3]) {
+  jet w[3];
+  for (int j = 0; j < 3; ++j) {
+    w[j] = constant(0.0);
+    for (int i = 0; i < 3; ++i) w[j] = add(w[j], scale(p[i], transpose ? r[i][j] : r[j][i]));
+  }
+  memcpy(out, w, sizeof w);
+}
+
+/* p / |p| (for nonzero p), as iauAb and iauAticq. */
+static void normalize(jet p[3]) {
+  jet m = square_root(dot(p, p));
+  for (int i = 0; i < 3; ++i) p[i] = divide(p[i], m);
+}
+
+/* p times 1/|p| (for nonzero p), as iauPn. */
+static void unit_vector(jet p[3]) {
+  jet m = divide(constant(1.0), square_root(dot(p, p)));
+  for (int i = 0; i < 3; ++i) p[i] = mul(p[i], m);
+}
+
+/* iauS2c. */
+static void spherical_to_cartesian(jet theta, jet phi, jet p[3]) {
+  jet cp = cosine(phi);
+  p[0] = mul(cosine(theta), cp);
+  p[1] = mul(sine(theta), cp);
+  p[2] = sine(phi);
+}
+
+/* iauC2s. */
+static void cartesian_to_spherical(const jet p[3], jet *theta, jet *phi) {
+  jet d2 = add(mul(p[0], p[0]), mul(p[1], p[1]));
+  *theta = (d2.v == 0.0) ? constant(0.0) : arctan2(p[1], p[0]);
+  *phi = (p[2].v == 0.0) ? constant(0.0) : arctan2(p[2], square_root(d2));
+}
+
+/* iauLdsun: light deflection by the Sun, of the direction p. */
+static void deflect(const jet p[3], const iauASTROM *astrom, jet p1[3]) {
+  double em2 = astrom->em * astrom->em;
+  if (em2 < 1.0) em2 = 1.0;
+  double dlim = 1e-6 / (em2 > 1.0 ? em2 : 1.0);
+  //iauLd, with bm = 1 and q = p
+  jet qpe[3], e[3], eq[3], peq[3];
+  for (int i = 0; i < 3; ++i) {
+    qpe[i] = add(p[i], constant(astrom->eh[i]));
+    e[i] = constant(astrom->eh[i]);
+  }
+  jet qdqpe = dot(p, qpe);
+  jet w = (qdqpe.v > dlim) ? divide(constant(SRS / astrom->em), qdqpe) : constant(SRS / astrom->em / dlim);
+  eq[0] = sub(mul(e[1], p[2]), mul(e[2], p[1]));
+  eq[1] = sub(mul(e[2], p[0]), mul(e[0], p[2]));
+  eq[2] = sub(mul(e[0], p[1]), mul(e[1], p[0]));
+  peq[0] = sub(mul(p[1], eq[2]), mul(p[2], eq[1]));
+  peq[1] = sub(mul(p[2], eq[0]), mul(p[0], eq[2]));
+  peq[2] = sub(mul(p[0], eq[1]), mul(p[1], eq[0]));
+  for (int i = 0; i < 3; ++i) p1[i] = add(p[i], mul(w, peq[i]));
+}
+
+/* iauAb: aberration of the natural direction pnat. */
+static void aberrate(const jet pnat[3], const iauASTROM *astrom, jet ppr[3]) {
+  jet pdv = dot_constant(pnat, astrom->v);
+  jet w1 = add(constant(1.0), divide(pdv, constant(1.0 + astrom->bm1)));
+  double w2 = SRS / astrom->em;
+  for (int i = 0; i < 3; ++i) {
+    jet w = add(add(scale(pnat[i], astrom->bm1), scale(w1, astrom->v[i])),
+        scale(sub(constant(astrom->v[i]), mul(pdv, pnat[i])), w2));
+    ppr[i] = w;
+  }
+  normalize(ppr);
+}
+
+/* iauAtciq, on jets. */
+static void atciq_jet(jet rc, jet dc, double pr, double pd, double px, double rv, const iauASTROM *astrom,
+    jet *ri, jet *di) {
+  //iauPmpx
+  const double VF = DAYSEC * DJM / DAU;
+  const double AULTY = AULT / DAYSEC / DJY;
+  jet sr = sine(rc), cr = cosine(rc), sd = sine(dc), cd = cosine(dc);
+  jet p[3] = {mul(cr, cd), mul(sr, cd), sd};
+  jet x = p[0], y = p[1], z = p[2];
+  jet dt = add(constant(astrom->pmt), scale(dot_constant(p, astrom->eb), AULTY));
+  double pxr = px * DAS2R;
+  double w = VF * rv * pxr;
+  jet pdz = scale(z, pd);
+  jet pm[3];
+  pm[0] = add(sub(scale(y, -pr), mul(pdz, cr)), scale(x, w));
+  pm[1] = add(sub(scale(x, pr), mul(pdz, sr)), scale(y, w));
+  pm[2] = add(scale(cd, pd), scale(z, w));
+  for (int i = 0; i < 3; ++i) p[i] = add(p[i], sub(mul(dt, pm[i]), constant(pxr * astrom->eb[i])));
+  unit_vector(p);
+
+  jet pnat[3], ppr[3], pi[3];
+  deflect(p, astrom, pnat);
+  aberrate(pnat, astrom, ppr);
+  rotate((const double (*)[3])astrom->bpn, 0, ppr, pi);
+  cartesian_to_spherical(pi, ri, di);
+  ri->v = iauAnp(ri->v);
+}
+
+/* iauAticq, on jets. */
+static void aticq_jet(jet ri, jet di, const iauASTROM *astrom, jet *rc, jet *dc) {
+  jet pi[3], ppr[3], pnat[3], pco[3], d[3], before[3], after[3];
+  spherical_to_cartesian(ri, di, pi);
+  rotate((const double (*)[3])astrom->bpn, 1, pi, ppr);
+
+  //aberration, by iteration as in iauAticq
+  for (int i = 0; i < 3; ++i) d[i] = constant(0.0);
+  for (int j = 0; j < 2; ++j) {
+    for (int i = 0; i < 3; ++i) before[i] = sub(ppr[i], d[i]);
+    normalize(before);
+    aberrate(before, astrom, after);
+    for (int i = 0; i < 3; ++i) {
+      d[i] = sub(after[i], before[i]);
+      pnat[i] = sub(ppr[i], d[i]);
+    }
+    normalize(pnat);
+  }
+
+  //light deflection, likewise
+  for (int i = 0; i < 3; ++i) d[i] = constant(0.0);
+  for (int j = 0; j < 5; ++j) {
+    for (int i = 0; i < 3; ++i) before[i] = sub(pnat[i], d[i]);
+    normalize(before);
+    deflect(before, astrom, after);
+    for (int i = 0; i < 3; ++i) {
+      d[i] = sub(after[i], before[i]);
+      pco[i] = sub(pnat[i], d[i]);
+    }
+    normalize(pco);
+  }
+  cartesian_to_spherical(pco, rc, dc);
+  rc->v = iauAnp(rc->v);
+}
+
+/* iauAtioq, on jets, with the Earth rotation angle eral (whose derivative carries time). */
+static void atioq_jet(jet ri, jet di, jet eral, const iauASTROM *astrom, jet out[5]) {
+  jet v[3];
+  spherical_to_cartesian(sub(ri, eral), di, v);
+  jet x = v[0], y = v[1], z = v[2];
+
+  //polar motion
+  double sx = sin(astrom->xpl), cx = cos(astrom->xpl), sy = sin(astrom->ypl), cy = cos(astrom->ypl);
+  jet xhd = add(scale(x, cx), scale(z, sx));
+  jet yhd = sub(add(scale(x, sx * sy), scale(y, cy)), scale(z, cx * sy));
+  jet zhd = add(add(scale(x, -sx * cy), scale(y, sy)), scale(z, cx * cy));
+
+  //diurnal aberration
+  jet f = sub(constant(1.0), scale(yhd, astrom->diurab));
+  jet xhdt = mul(f, xhd);
+  jet yhdt = mul(f, add(yhd, constant(astrom->diurab)));
+  jet zhdt = mul(f, zhd);
+
+  //to Cartesian Az,El (S=0,E=90)
+  jet xaet = sub(scale(xhdt, astrom->sphi), scale(zhdt, astrom->cphi));
+  jet yaet = yhdt;
+  jet zaet = add(scale(xhdt, astrom->cphi), scale(zhdt, astrom->sphi));
+  jet azobs = (xaet.v != 0.0 || yaet.v != 0.0) ? arctan2(yaet, scale(xaet, -1.0)) : constant(0.0);
+
+  //refraction
+  jet r = square_root(add(mul(xaet, xaet), mul(yaet, yaet)));
+  if (!(r.v > CELMIN)) r = constant(CELMIN);
+  jet zc = (zaet.v > SELMIN) ? zaet : constant(SELMIN);
+  jet tz = divide(r, zc);
+  jet w = mul(mul(constant(astrom->refb), tz), tz);
+  jet del = divide(mul(add(constant(astrom->refa), w), tz),
+      add(constant(1.0), divide(add(constant(astrom->refa), scale(w, 3.0)), mul(zc, zc))));
+  jet cosdel = sub(constant(1.0), scale(mul(del, del), 0.5));
+  f = sub(cosdel, divide(mul(del, zc), r));
+  jet xaeo = mul(xaet, f);
+  jet yaeo = mul(yaet, f);
+  jet zaeo = add(mul(cosdel, zaet), mul(del, r));
+  jet zdobs = arctan2(square_root(add(mul(xaeo, xaeo), mul(yaeo, yaeo))), zaeo);
+
+  //back to HA,Dec
+  v[0] = add(scale(xaeo, astrom->sphi), scale(zaeo, astrom->cphi));
+  v[1] = yaeo;
+  v[2] = sub(scale(zaeo, astrom->sphi), scale(xaeo, astrom->cphi));
+  jet hmobs, dcobs;
+  cartesian_to_spherical(v, &hmobs, &dcobs);
+
+  out[0] = azobs;
+  out[0].v = iauAnp(azobs.v);
+  out[1] = zdobs;
+  out[2] = scale(hmobs, -1.0);
+  out[3] = dcobs;
+  out[4] = add(eral, hmobs);
+  out[4].v = iauAnp(out[4].v);
+}
+
+/* iauAtoiq, on jets, with the Earth rotation angle eral (whose derivative carries time). */
+static void atoiq_jet(const char *type, jet c1, jet c2, jet eral, const iauASTROM *astrom, jet *ri, jet *di) {
+  int c = (int)type[0];
+  double sphi = astrom->sphi, cphi = astrom->cphi;
+  c = (c == 'r' || c == 'R') ? 'R' : (c == 'h' || c == 'H') ? 'H' : 'A';
+  jet xaeo, yaeo, zaeo, v[3];
+  if (c == 'A') {
+    jet ce = sine(c2);
+    xaeo = scale(mul(cosine(c1), ce), -1.0);
+    yaeo = mul(sine(c1), ce);
+    zaeo = cosine(c2);
+  } else {
+    if (c == 'R') c1 = sub(eral, c1);
+    spherical_to_cartesian(scale(c1, -1.0), c2, v);
+    xaeo = sub(scale(v[0], sphi), scale(v[2], cphi));
+    yaeo = v[1];
+    zaeo = add(scale(v[0], cphi), scale(v[2], sphi));
+  }
+  jet az = (xaeo.v != 0.0 || yaeo.v != 0.0) ? arctan2(yaeo, xaeo) : constant(0.0);
+  jet sz = square_root(add(mul(xaeo, xaeo), mul(yaeo, yaeo)));
+  jet zdo = arctan2(sz, zaeo);
+
+  //refraction, by the two-constant model
+  jet tz = divide(sz, (zaeo.v > SELMIN) ? zaeo : constant(SELMIN));
+  jet dref = mul(add(constant(astrom->refa), mul(mul(constant(astrom->refb), tz), tz)), tz);
+  jet zdt = add(zdo, dref);
+  jet ce = sine(zdt);
+  jet xaet = mul(cosine(az), ce);
+  jet yaet = mul(sine(az), ce);
+  jet zaet = cosine(zdt);
+
+  //to -HA,Dec, diurnal aberration and polar motion
+  jet xmhda = add(scale(xaet, sphi), scale(zaet, cphi));
+  jet ymhda = yaet;
+  jet zmhda = add(scale(xaet, -cphi), scale(zaet, sphi));
+  jet f = add(constant(1.0), scale(ymhda, astrom->diurab));
+  jet xhd = mul(f, xmhda);
+  jet yhd = mul(f, sub(ymhda, constant(astrom->diurab)));
+  jet zhd = mul(f, zmhda);
+  double sx = sin(astrom->xpl), cx = cos(astrom->xpl), sy = sin(astrom->ypl), cy = cos(astrom->ypl);
+  v[0] = add(add(scale(xhd, cx), scale(yhd, sx * sy)), scale(zhd, -sx * cy));
+  v[1] = add(scale(yhd, cy), scale(zhd, sy));
+  v[2] = add(add(scale(xhd, sx), scale(yhd, -cx * sy)), scale(zhd, cx * cy));
+  jet hma;
+  cartesian_to_spherical(v, &hma, di);
+  *ri = add(eral, hma);
+  ri->v = iauAnp(ri->v);
+}
+
+/* The Earth rotation angle of astrom, as a jet carrying time (s). */
+static jet era_jet(const iauASTROM *astrom) {
+  jet eral = constant(astrom->eral);
+  eral.d[2] = ERA_RATE;
+  return eral;
+}
+
+static void jacobian(const jet out[], int n, int ncols, double *jac) {
+  for (int i = 0; i < n; ++i) {
+    for (int k = 0; k < ncols; ++k) jac[i * ncols + k] = out[i].d[k];
+  }
+}
+
+/*
+ iauAtciq, with the Jacobian jac[i][k] of (ri, di) with respect to (rc, dc).
+ (Quick ICRS to CIRS: no time dependence, for given astrom.)
+*/
+void terse_alternate_iauAtciqJ(double rc, double dc, double pr, double pd, double px, double rv, iauASTROM *astrom,
+    double *ri, double *di, double jac[2][2]) {
+  jet out[2];
+  atciq_jet(variable(rc, 0), variable(dc, 1), pr, pd, px, rv, astrom, &out[0], &out[1]);
+  *ri = out[0].v;
+  *di = out[1].v;
+  jacobian(out, 2, 2, &jac[0][0]);
+}
+
+/* iauAticq, with the Jacobian jac[i][k] of (rc, dc) with respect to (ri, di). */
+void terse_alternate_iauAticqJ(double ri, double di, iauASTROM *astrom, double *rc, double *dc, double jac[2][2]) {
+  jet out[2];
+  aticq_jet(variable(ri, 0), variable(di, 1), astrom, &out[0], &out[1]);
+  *rc = out[0].v;
+  *dc = out[1].v;
+  jacobian(out, 2, 2, &jac[0][0]);
+}
+
+/* iauAtioq, with the Jacobian jac[i][k] of (aob, zob, hob, dob, rob) with respect to (ri, di, time in s). */
+void terse_alternate_iauAtioqJ(double ri, double di, iauASTROM *astrom,
+    double *aob, double *zob, double *hob, double *dob, double *rob, double jac[5][3]) {
+  jet out[5];
+  atioq_jet(variable(ri, 0), variable(di, 1), era_jet(astrom), astrom, out);
+  *aob = out[0].v;
+  *zob = out[1].v;
+  *hob = out[2].v;
+  *dob = out[3].v;
+  *rob = out[4].v;
+  jacobian(out, 5, 3, &jac[0][0]);
+}
+
+/* iauAtoiq, with the Jacobian jac[i][k] of (ri, di) with respect to (ob1, ob2, time in s). */
+void terse_alternate_iauAtoiqJ(const char *type, double ob1, double ob2, iauASTROM *astrom, double *ri, double *di,
+    double jac[2][3]) {
+  jet out[2];
+  atoiq_jet(type, variable(ob1, 0), variable(ob2, 1), era_jet(astrom), astrom, &out[0], &out[1]);
+  *ri = out[0].v;
+  *di = out[1].v;
+  jacobian(out, 2, 3, &jac[0][0]);
+}
+
+/*
+ iauAtco13, with the Jacobian jac[i][k] of (aob, zob, hob, dob, rob) with respect to (rc, dc, time in s).
+ Returns the status of iauAtco13.
+*/
+int terse_alternate_iauAtco13J(double rc, double dc, double pr, double pd, double px, double rv,
+    double utc1, double utc2, double dut1, double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl,
+    double *aob, double *zob, double *hob, double *dob, double *rob, double *eo, double jac[5][3]) {
+  iauASTROM astrom;
+  int j = iauApco13(utc1, utc2, dut1, elong, phi, hm, xp, yp, phpa, tc, rh, wl, &astrom, eo);
+  if (j < 0) return j;
+  jet ri, di, out[5];
+  atciq_jet(variable(rc, 0), variable(dc, 1), pr, pd, px, rv, &astrom, &ri, &di);
+  atioq_jet(ri, di, era_jet(&astrom), &astrom, out);
+  *aob = out[0].v;
+  *zob = out[1].v;
+  *hob = out[2].v;
+  *dob = out[3].v;
+  *rob = out[4].v;
+  jacobian(out, 5, 3, &jac[0][0]);
+  return j;
+}
+
+/*
+ iauAtoc13, with the Jacobian jac[i][k] of (rc, dc) with respect to (ob1, ob2, time in s).
+ Returns the status of iauAtoc13.
+*/
+int terse_alternate_iauAtoc13J(const char *type, double ob1, double ob2,
+    double utc1, double utc2, double dut1, double elong, double phi, double hm, double xp, double yp,
+    double phpa, double tc, double rh, double wl, double *rc, double *dc, double jac[2][3]) {
+  iauASTROM astrom;
+  double eo;
+  int j = iauApco13(utc1, utc2, dut1, elong, phi, hm, xp, yp, phpa, tc, rh, wl, &astrom, &eo);
+  if (j < 0) return j;
+  jet ri, di, out[2];
+  atoiq_jet(type, variable(ob1, 0), variable(ob2, 1), era_jet(&astrom), &astrom, &ri, &di);
+  aticq_jet(ri, di, &astrom, &out[0], &out[1]);
+  *rc = out[0].v;
+  *dc = out[1].v;
+  jacobian(out, 2, 3, &jac[0][0]);
+  return j;
+}
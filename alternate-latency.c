@@ -0,0 +1,212 @@
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Latency profiling harness, implemented in C99.
+
+ For hard-real-time use the tail of the latency distribution matters, not the mean.
+ Each function is timed call-by-call over sets of adversarial inputs, and the
+ p50, p99, p99.99 and max latencies are reported.
+
+ Run it with:
+   ./run_tests.exe latency
+
+ The adversarial input sets are built from observed places, using iauAtoc13, so that
+ they land exactly where the slow paths are: at the zenith, at the pole, near the horizon,
+ with subnormal offsets, and with huge (unreduced) angles.
+*/
+
+/* The number of timed calls per function per input set; p99.99 needs at least 10^4. */
+static const int NUM_SAMPLES = 20000;
+
+/* A site, date, and weather shared by all of the profiles (those used in SOFA's t_atco13). */
+static const double UTC1 = 2456384.5, UTC2 = 0.969254051, DUT1 = 0.1550675;
+static const double ELONG = -0.527800806, PHI = -1.2345856, HM = 2738.0;
+static const double XP = 2.47230737e-7, YP = 1.82640464e-6;
+static const double PHPA = 731.0, TC = 12.8, RH = 0.59, WL = 0.55;
+
+/* The current time in nanoseconds, from a monotonic clock if there is one. */
+double terse_alternate_now_ns(void) {
+#if defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return 1e9 * ts.tv_sec + ts.tv_nsec;
+#else
+  return 1e9 * clock() / CLOCKS_PER_SEC;
+#endif
+}
+
+static int compare_doubles(const void *a, const void *b) {
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/* The value at the given quantile (0..1) of an array that's already sorted. */
+static double quantile(const double *sorted, int n, double q) {
+  int idx = (int)ceil(q * n) - 1;
+  if (idx < 0) idx = 0;
+  if (idx > n - 1) idx = n - 1;
+  return sorted[idx];
+}
+
+/*
+ Time n calls of func(ctx, i), for i = 0..n-1, one call at a time.
+ The first call is made once beforehand, untimed, to warm the caches.
+ The latency of each call is placed in the given scratch array, which is returned sorted.
+*/
+void terse_alternate_latency_profile(void (*func)(void *ctx, int i), void *ctx, int n, double *scratch, terse_alternate_iauLATENCY *result) {
+  func(ctx, 0);
+  for (int i = 0; i < n; ++i) {
+    double start = terse_alternate_now_ns();
+    func(ctx, i);
+    scratch[i] = terse_alternate_now_ns() - start;
+  }
+  qsort(scratch, n, sizeof(double), compare_doubles);
+  result->n = n;
+  result->p50 = quantile(scratch, n, 0.50);
+  result->p99 = quantile(scratch, n, 0.99);
+  result->p9999 = quantile(scratch, n, 0.9999);
+  result->max = scratch[n - 1];
+}
+
+/* Targets for a profile: ICRS RA,Dec, or CIRS RA,Dec, or observed Az,ZD, depending on the function. */
+typedef struct {
+  const double *a;
+  const double *b;
+  int num;
+  iauASTROM astrom;
+  double sink; //keeps the compiler from discarding the results
+} targets;
+
+static void call_atco13(void *ctx, int i) {
+  targets *t = ctx;
+  double aob, zob, hob, dob, rob, eo;
+  iauAtco13(t->a[i % t->num], t->b[i % t->num], 0.0, 0.0, 0.0, 0.0, UTC1, UTC2, DUT1,
+      ELONG, PHI, HM, XP, YP, PHPA, TC, RH, WL, &aob, &zob, &hob, &dob, &rob, &eo);
+  t->sink += aob;
+}
+
+static void call_atco13d(void *ctx, int i) {
+  targets *t = ctx;
+  double aob, zob, hob, dob, rob, eo;
+  terse_alternate_iauAtco13d(t->a[i % t->num], t->b[i % t->num], 0.0, 0.0, 0.0, 0.0, UTC1, UTC2, DUT1,
+      ELONG, PHI, HM, XP, YP, PHPA, TC, RH, WL, &aob, &zob, &hob, &dob, &rob, &eo);
+  t->sink += aob;
+}
+
+static void call_atioq(void *ctx, int i) {
+  targets *t = ctx;
+  double aob, zob, hob, dob, rob;
+  iauAtioq(t->a[i % t->num], t->b[i % t->num], &t->astrom, &aob, &zob, &hob, &dob, &rob);
+  t->sink += aob;
+}
+
+static void call_atioqd(void *ctx, int i) {
+  targets *t = ctx;
+  double aob, zob, hob, dob, rob;
+  terse_alternate_iauAtioqd(t->a[i % t->num], t->b[i % t->num], &t->astrom, &aob, &zob, &hob, &dob, &rob);
+  t->sink += aob;
+}
+
+static void call_atoiq(void *ctx, int i) {
+  targets *t = ctx;
+  double ri, di;
+  iauAtoiq("A", t->a[i % t->num], t->b[i % t->num], &t->astrom, &ri, &di);
+  t->sink += ri;
+}
+
+static void call_atoiqd(void *ctx, int i) {
+  targets *t = ctx;
+  double ri, di;
+  terse_alternate_iauAtoiqd("A", t->a[i % t->num], t->b[i % t->num], &t->astrom, &ri, &di);
+  t->sink += ri;
+}
+
+/* The adversarial observed places, Az,ZD. */
+#define NUM_ADVERSARIAL 8
+static const double ADV_AZ[NUM_ADVERSARIAL] = {0.0, 1.0, 0.0, 3.0, 2.0, 1e-310, 0.5, 1e6};
+static const double ADV_ZD[NUM_ADVERSARIAL] = {0.0, 1e-200, 1e-310, 1.5707, 1.6, 1e-12, 1.0, 1e6};
+
+static void report(const char *set, const char *func, const terse_alternate_iauLATENCY *r) {
+  printf("%-12s %-11s p50 %9.0f ns   p99 %9.0f ns   p99.99 %9.0f ns   max %9.0f ns\n",
+      set, func, r->p50, r->p99, r->p9999, r->max);
+}
+
+static void profile_set(const char *set, const double *icrs_a, const double *icrs_b, const double *cirs_a,
+    const double *cirs_b, const double *obs_a, const double *obs_b, int num, iauASTROM *astrom, double *scratch) {
+  terse_alternate_iauLATENCY r;
+  targets icrs = {icrs_a, icrs_b, num, *astrom, 0.0};
+  targets cirs = {cirs_a, cirs_b, num, *astrom, 0.0};
+  targets obs = {obs_a, obs_b, num, *astrom, 0.0};
+  terse_alternate_latency_profile(call_atco13, &icrs, NUM_SAMPLES, scratch, &r);  report(set, "iauAtco13", &r);
+  terse_alternate_latency_profile(call_atco13d, &icrs, NUM_SAMPLES, scratch, &r); report(set, "terse_alternate_iauAtco13d", &r);
+  terse_alternate_latency_profile(call_atioq, &cirs, NUM_SAMPLES, scratch, &r);   report(set, "iauAtioq", &r);
+  terse_alternate_latency_profile(call_atioqd, &cirs, NUM_SAMPLES, scratch, &r);  report(set, "terse_alternate_iauAtioqd", &r);
+  terse_alternate_latency_profile(call_atoiq, &obs, NUM_SAMPLES, scratch, &r);    report(set, "iauAtoiq", &r);
+  terse_alternate_latency_profile(call_atoiqd, &obs, NUM_SAMPLES, scratch, &r);   report(set, "terse_alternate_iauAtoiqd", &r);
+}
+
+/* Profile the ICRS-observed functions over random and adversarial inputs. */
+void terse_alternate_run_latency_profiles(void) {
+  iauASTROM astrom;
+  double eo;
+  iauApco13(UTC1, UTC2, DUT1, ELONG, PHI, HM, XP, YP, PHPA, TC, RH, WL, &astrom, &eo);
+
+  double *scratch = malloc(NUM_SAMPLES * sizeof(double));
+  double ra[NUM_ADVERSARIAL], dec[NUM_ADVERSARIAL], ri[NUM_ADVERSARIAL], di[NUM_ADVERSARIAL];
+
+  printf("Latency profiles: %d timed calls per function per input set.\n\n", NUM_SAMPLES);
+
+  //random places on the sky
+  enum { NUM_RANDOM = 1024 };
+  static double rra[NUM_RANDOM], rdec[NUM_RANDOM], rri[NUM_RANDOM], rdi[NUM_RANDOM], raz[NUM_RANDOM], rzd[NUM_RANDOM];
+  srand(76);
+  for (int i = 0; i < NUM_RANDOM; ++i) {
+    rra[i] = D2PI * rand() / RAND_MAX;
+    rdec[i] = asin(2.0 * rand() / RAND_MAX - 1.0);
+    raz[i] = D2PI * rand() / RAND_MAX;
+    rzd[i] = DPI * rand() / RAND_MAX;
+    iauAtciq(rra[i], rdec[i], 0.0, 0.0, 0.0, 0.0, &astrom, &rri[i], &rdi[i]);
+  }
+  profile_set("random", rra, rdec, rri, rdi, raz, rzd, NUM_RANDOM, &astrom, scratch);
+  printf("\n");
+
+  //the adversarial places: zenith, subnormal offsets from it, the horizon, below it, and huge angles
+  for (int i = 0; i < NUM_ADVERSARIAL; ++i) {
+    iauAtoiq("A", ADV_AZ[i], ADV_ZD[i], &astrom, &ri[i], &di[i]);
+    double ra_icrs, dec_icrs;
+    iauAtoc13("A", ADV_AZ[i], ADV_ZD[i], UTC1, UTC2, DUT1, ELONG, PHI, HM, XP, YP, PHPA, TC, RH, WL, &ra_icrs, &dec_icrs);
+    ra[i] = ra_icrs;
+    dec[i] = dec_icrs;
+  }
+  ri[NUM_ADVERSARIAL - 1] += 1e6; //huge, unreduced angles
+  ra[NUM_ADVERSARIAL - 1] += 1e6;
+  profile_set("adversarial", ra, dec, ri, di, ADV_AZ, ADV_ZD, NUM_ADVERSARIAL, &astrom, scratch);
+  printf("\n");
+
+  //the same again, with the CPU's flush-to-zero mode on
+  int previous_ftz = terse_alternate_iauFtz(1);
+  if (previous_ftz >= 0) {
+    profile_set("adv+ftz", ra, dec, ri, di, ADV_AZ, ADV_ZD, NUM_ADVERSARIAL, &astrom, scratch);
+    terse_alternate_iauFtz(previous_ftz);
+    printf("\n");
+  }
+
+  //the celestial pole, and a subnormal offset from it
+  double pole_ra[2] = {0.0, 1e-310}, pole_dec[2] = {DPI/2.0, DPI/2.0 - 1e-17};
+  double pole_ri[2], pole_di[2], pole_az[2], pole_zd[2];
+  for (int i = 0; i < 2; ++i) {
+    double hob, dob, rob;
+    iauAtciq(pole_ra[i], pole_dec[i], 0.0, 0.0, 0.0, 0.0, &astrom, &pole_ri[i], &pole_di[i]);
+    iauAtioq(pole_ri[i], pole_di[i], &astrom, &pole_az[i], &pole_zd[i], &hob, &dob, &rob);
+  }
+  profile_set("pole", pole_ra, pole_dec, pole_ri, pole_di, pole_az, pole_zd, 2, &astrom, scratch);
+
+  free(scratch);
+}
@@ -0,0 +1,83 @@
+#define _POSIX_C_SOURCE 200112L
+#include <stddef.h>
+#include "alternate-headers.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+ Read-only memory mapping of a whole file, implemented in C99, for POSIX and Windows.
+
+ Mapped files are shared between processes by the operating system: many processes
+ reading the same file share the same physical pages, and nothing is read from disk
+ until a page is first touched.
+*/
+
+/* Map the file read-only. Returns 0 for success, -1 for failure. */
+int terse_alternate_map_file(const char *path, terse_alternate_iauMAPPING *mapping) {
+  mapping->base = NULL;
+  mapping->size = 0;
+  mapping->handle = NULL;
+#ifdef _WIN32
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) return -1;
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) { CloseHandle(file); return -1; }
+  HANDLE view = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(file); //the mapping keeps the file open
+  if (view == NULL) return -1;
+  void *base = MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0);
+  if (base == NULL) { CloseHandle(view); return -1; }
+  mapping->base = base;
+  mapping->size = (size_t)size.QuadPart;
+  mapping->handle = view;
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return -1;
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) { close(fd); return -1; }
+  void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd); //the mapping keeps the file open
+  if (base == MAP_FAILED) return -1;
+  mapping->base = base;
+  mapping->size = (size_t)st.st_size;
+#endif
+  return 0;
+}
+
+/* Release a mapping made by terse_alternate_map_file. */
+void terse_alternate_unmap_file(terse_alternate_iauMAPPING *mapping) {
+  if (mapping->base == NULL) return;
+#ifdef _WIN32
+  UnmapViewOfFile(mapping->base);
+  CloseHandle((HANDLE)mapping->handle);
+#else
+  munmap((void *)mapping->base, mapping->size);
+#endif
+  mapping->base = NULL;
+  mapping->size = 0;
+  mapping->handle = NULL;
+}
+
+/*
+ Continue a 64-bit FNV-1a hash with a block of bytes. FNV-1a is sequential, so the hash of a whole file can
+ be built up a piece at a time.
+*/
+unsigned long long terse_alternate_fnv1a64_more(unsigned long long hash, const void *data, size_t size) {
+  const unsigned char *bytes = data;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+/* 64-bit FNV-1a hash of a block of bytes, used as a checksum for binary files. */
+unsigned long long terse_alternate_fnv1a64(const void *data, size_t size) {
+  return terse_alternate_fnv1a64_more(14695981039346656037ULL, data, size);
+}
@@ -0,0 +1,118 @@
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ The current epoch as TAI, TT and UT1 two-part JDs, straight from the system clock, implemented in C99.
+
+ The usual route (clock_gettime, calendar fields, iauDtf2d, iauUtctai, iauTaitt) costs far more than reading
+ the clock. Here, the clock is read in nanoseconds, and TAI-UTC and UT1-TAI are cached for the current UTC day.
+ The cache is refreshed only when the clock passes into another day. So a call is a clock read, a comparison,
+ and a few integer and floating-point operations.
+
+ The clock is CLOCK_REALTIME, with TAI-UTC from the leap-second table of alternate-timestamps.c.
+ Where the system has CLOCK_TAI (Linux), and its offset from CLOCK_REALTIME is set to the right TAI-UTC
+ (by chrony or ntpd), CLOCK_TAI is used instead; it counts through a leap second correctly.
+
+ UT1-TAI is taken from the EOP function at the start of the day and at the start of the next day, and
+ interpolated linearly across the day. (UT1-TAI has no jumps at leap seconds, unlike UT1-UTC.)
+ Without an EOP function, UT1-UTC is taken as zero.
+
+ A terse_alternate_iauCLOCK is changed by terse_alternate_iauNow, so each thread needs its own.
+ Status: as for terse_alternate_iauUnixToTai, for the current day.
+*/
+
+#if defined(__linux__) && !defined(CLOCK_TAI)
+#define CLOCK_TAI 11
+#endif
+
+static const long long NS_PER_SEC = 1000000000LL;
+static const long long SEC_PER_DAY = 86400LL;
+static const long long TT_MINUS_TAI_NS = 32184000000LL;
+
+/* Read a clock, in nanoseconds since its epoch. */
+static long long read_clock(clockid_t id) {
+  struct timespec ts;
+  clock_gettime(id, &ts);
+  return (long long)ts.tv_sec * NS_PER_SEC + ts.tv_nsec;
+}
+
+/* UT1-TAI (s) at the start of the UTC day that starts at the POSIX time day (s). */
+static double ut1_minus_tai(const terse_alternate_iauCLOCK *clock, long long day, int tai_utc) {
+  double dut1 = 0.0, xp, yp;
+  if (clock->eop != NULL) {
+    clock->eop(clock->eop_ctx, 2440587.5 + (double)(day / SEC_PER_DAY), 0.0, &dut1, &xp, &yp);
+  }
+  return dut1 - tai_utc;
+}
+
+/* Fill the cache for the UTC day that contains the POSIX time (s). */
+static void refresh(terse_alternate_iauCLOCK *clock, long long unix_s) {
+  long long from, until, next_from, next_until;
+  int next_tai_utc;
+  long long day = unix_s - (((unix_s % SEC_PER_DAY) + SEC_PER_DAY) % SEC_PER_DAY);
+  clock->day_start = day;
+  clock->day_end = day + SEC_PER_DAY;
+  clock->status = terse_alternate_leap_table_dat(unix_s, &clock->tai_utc, &from, &until);
+  if (clock->status < 0) {
+    clock->tai_utc = 0;
+    next_tai_utc = 0;
+  } else if (terse_alternate_leap_table_dat(clock->day_end, &next_tai_utc, &next_from, &next_until) < 0) {
+    next_tai_utc = clock->tai_utc;
+  }
+  double start = ut1_minus_tai(clock, clock->day_start, clock->tai_utc);
+  double end = ut1_minus_tai(clock, clock->day_end, next_tai_utc);
+  clock->ut1_tai_ns = llround(start * NS_PER_SEC);
+  //the TAI day is longer than 86400 s by any leap second at its end
+  clock->ut1_tai_rate = (end - start) / (double)((SEC_PER_DAY + next_tai_utc - clock->tai_utc) * NS_PER_SEC);
+}
+
+/* Start a clock, with the source of UT1-UTC (NULL for zero). */
+void terse_alternate_iauClockInit(terse_alternate_iauCLOCK *clock, terse_alternate_iauEOPFUNC eop, void *eop_ctx) {
+  clock->eop = eop;
+  clock->eop_ctx = eop_ctx;
+  clock->use_tai_clock = 0;
+  long long realtime = read_clock(CLOCK_REALTIME);
+  refresh(clock, realtime / NS_PER_SEC);
+#ifdef CLOCK_TAI
+  struct timespec ts;
+  if (clock_gettime(CLOCK_TAI, &ts) == 0) {
+    long long offset = ((long long)ts.tv_sec * NS_PER_SEC + ts.tv_nsec - realtime + NS_PER_SEC / 2) / NS_PER_SEC;
+    clock->use_tai_clock = (clock->status >= 0 && offset == clock->tai_utc);
+  }
+#endif
+}
+
+/*
+ The current epoch, as TAI, TT and UT1 two-part JDs. Any of the pairs of pointers may be NULL.
+ Returns the status of the leap-second lookup: 0 for OK, +1 if the date is after the iauDat table, -1 before 1972.
+*/
+int terse_alternate_iauNow(terse_alternate_iauCLOCK *clock, double *tai1, double *tai2, double *tt1, double *tt2, double *ut11, double *ut12) {
+  long long tai_ns;
+#ifdef CLOCK_TAI
+  if (clock->use_tai_clock) {
+    tai_ns = read_clock(CLOCK_TAI);
+    if (tai_ns < (clock->day_start + clock->tai_utc) * NS_PER_SEC ||
+        tai_ns >= (clock->day_end + clock->tai_utc) * NS_PER_SEC) {
+      //during a leap second, this refreshes on every call, for that one second
+      refresh(clock, (tai_ns - (long long)clock->tai_utc * NS_PER_SEC) / NS_PER_SEC);
+    }
+  } else
+#endif
+  {
+    long long unix_ns = read_clock(CLOCK_REALTIME);
+    if (unix_ns < clock->day_start * NS_PER_SEC || unix_ns >= clock->day_end * NS_PER_SEC) {
+      refresh(clock, unix_ns / NS_PER_SEC);
+    }
+    tai_ns = unix_ns + clock->tai_utc * NS_PER_SEC;
+  }
+  if (tai1 != NULL) terse_alternate_ns_to_jd(tai_ns, tai1, tai2);
+  if (tt1 != NULL) terse_alternate_ns_to_jd(tai_ns + TT_MINUS_TAI_NS, tt1, tt2);
+  if (ut11 != NULL) {
+    long long elapsed = tai_ns - (clock->day_start + clock->tai_utc) * NS_PER_SEC;
+    terse_alternate_ns_to_jd(tai_ns + clock->ut1_tai_ns + llround(clock->ut1_tai_rate * (double)elapsed), ut11, ut12);
+  }
+  return clock->status;
+}
@@ -0,0 +1,133 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ A nutation stepper, for IAU 2000A nutation at densely sampled, regularly spaced epochs, implemented in C99.
+
+ Between two epochs a few seconds or minutes apart, the argument of every term of the series changes
+ by a tiny increment, which is almost the same from one step to the next.
+ So instead of computing sin and cos of every argument afresh (1365 of each, per epoch), the stepper keeps
+ them as state, and advances them to the next epoch by a rotation (the angle-addition formulas):
+   sin(a + d) = sin(a) cos(d) + cos(a) sin(d)
+   cos(a + d) = cos(a) cos(d) - sin(a) sin(d)
+ That's 4 multiplications per term, instead of a sin and a cos.
+
+ Every 'refresh' epochs, the state is recomputed from scratch. That bounds the two sources of drift:
+   - rounding, which accumulates in the rotated sin/cos (and in their norm) at the level of 1e-16 per step;
+   - the increments are those of the first step after a refresh, while the true increments change slowly,
+     because the fundamental arguments aren't exactly linear in time.
+ The amplitudes that depend on time are evaluated at each epoch.
+
+ Accuracy versus iauNut00a, over 1000 epochs with the default refresh every 256 epochs (see the tests):
+   1 second and 1 minute steps: about 1e-17 radians
+   1 hour steps: about 1e-16 radians
+   1 day steps: about 1e-13 radians (30 nanoarcseconds)
+ iauNut00a itself is only good to about 1e-9 radians (0.2 mas), so all of these are negligible.
+*/
+
+/* The default number of epochs between refreshes. */
+static const int NUTSTEP_REFRESH = 256;
+
+/* The difference between two angles, in the range -pi..+pi. */
+static double angle_step(double from, double to) {
+  return remainder(to - from, D2PI);
+}
+
+/*
+ Recompute the state from scratch, at epoch i: sin/cos of every argument, and the rotation per step.
+ The fundamental arguments have rounding errors of a few 1e-13 radians, so the increment per step
+ is taken as the average over a baseline of nb steps (up to the next refresh, but no more than a day,
+ which keeps the change in every fundamental argument well below half a turn).
+*/
+static void nutstep_refresh(terse_alternate_iauNUTSTEP *ns) {
+  double fa0[13], fa1[13], dfa[13];
+  int nb = ns->refresh;
+  if (nb * fabs(ns->step) > 1.0) nb = (int)(1.0 / fabs(ns->step));
+  if (nb < 1) nb = 1;
+  double t0 = ((ns->date1 - DJ00) + (ns->date2 + ns->i * ns->step)) / DJC;
+  double t1 = ((ns->date1 - DJ00) + (ns->date2 + (ns->i + nb) * ns->step)) / DJC;
+
+  terse_alternate_nut00a_ls_args(t0, fa0);
+  terse_alternate_nut00a_ls_args(t1, fa1);
+  for (int k = 0; k < 5; k++) dfa[k] = angle_step(fa0[k], fa1[k]) / nb;
+  for (int j = 0; j < NUT_LS_N; j++) {
+    double arg = terse_alternate_nut00a_ls_arg(j, fa0);
+    const signed char *m = terse_alternate_nut_ls_mult[j];
+    double d = m[0] * dfa[0] + m[1] * dfa[1] + m[2] * dfa[2] + m[3] * dfa[3] + m[4] * dfa[4];
+    ns->ls_sin[j] = sin(arg);
+    ns->ls_cos[j] = cos(arg);
+    ns->ls_rsin[j] = sin(d);
+    ns->ls_rcos[j] = cos(d);
+  }
+
+  terse_alternate_nut00a_pl_args(t0, fa0);
+  terse_alternate_nut00a_pl_args(t1, fa1);
+  for (int k = 0; k < 13; k++) dfa[k] = angle_step(fa0[k], fa1[k]) / nb;
+  for (int j = 0; j < NUT_PL_N; j++) {
+    double arg = terse_alternate_nut00a_pl_arg(j, fa0);
+    const signed char *m = terse_alternate_nut_pl_mult[j];
+    double d = 0.0;
+    for (int k = 0; k < 13; k++) d += m[k] * dfa[k];
+    ns->pl_sin[j] = sin(arg);
+    ns->pl_cos[j] = cos(arg);
+    ns->pl_rsin[j] = sin(d);
+    ns->pl_rcos[j] = cos(d);
+  }
+}
+
+/*
+ Start a stepper at the TT epoch date1 + date2, with the given step (days).
+ The state is recomputed from scratch every 'refresh' epochs; 0 means the default (256).
+*/
+void terse_alternate_iauNutStepInit(terse_alternate_iauNUTSTEP *ns, double date1, double date2, double step, int refresh) {
+  ns->date1 = date1;
+  ns->date2 = date2;
+  ns->step = step;
+  ns->refresh = refresh > 0 ? refresh : NUTSTEP_REFRESH;
+  ns->i = 0;
+  nutstep_refresh(ns);
+}
+
+/*
+ The nutation at the current epoch (the same as iauNut00a's dpsi, deps, in radians), and advance
+ to the next epoch. The epochs are date1 + (date2 + i*step); the step is never accumulated.
+*/
+void terse_alternate_iauNutStep(terse_alternate_iauNUTSTEP *ns, double *dpsi, double *deps) {
+  //Units of 0.1 microarcsecond to radians
+  const double U2R = DAS2R / 1e7;
+  double t = ((ns->date1 - DJ00) + (ns->date2 + ns->i * ns->step)) / DJC;
+
+  //Sum the series, and rotate each term on to the next epoch.
+  double dp = 0.0;
+  double de = 0.0;
+  for (int j = 0; j < NUT_LS_N; j++) {
+    double sarg = ns->ls_sin[j];
+    double carg = ns->ls_cos[j];
+    dp += ((double)terse_alternate_nut_ls_sp[j] + (double)terse_alternate_nut_ls_spt[j] * t) * sarg + (double)terse_alternate_nut_ls_cp[j] * carg;
+    de += ((double)terse_alternate_nut_ls_ce[j] + (double)terse_alternate_nut_ls_cet[j] * t) * carg + (double)terse_alternate_nut_ls_se[j] * sarg;
+    ns->ls_sin[j] = sarg * ns->ls_rcos[j] + carg * ns->ls_rsin[j];
+    ns->ls_cos[j] = carg * ns->ls_rcos[j] - sarg * ns->ls_rsin[j];
+  }
+  double dpsils = dp * U2R;
+  double depsls = de * U2R;
+
+  dp = 0.0;
+  de = 0.0;
+  for (int j = 0; j < NUT_PL_N; j++) {
+    double sarg = ns->pl_sin[j];
+    double carg = ns->pl_cos[j];
+    dp += (double)terse_alternate_nut_pl_sp[j] * sarg + (double)terse_alternate_nut_pl_cp[j] * carg;
+    de += (double)terse_alternate_nut_pl_se[j] * sarg + (double)terse_alternate_nut_pl_ce[j] * carg;
+    ns->pl_sin[j] = sarg * ns->pl_rcos[j] + carg * ns->pl_rsin[j];
+    ns->pl_cos[j] = carg * ns->pl_rcos[j] - sarg * ns->pl_rsin[j];
+  }
+
+  *dpsi = dpsils + dp * U2R;
+  *deps = depsls + de * U2R;
+
+  ns->i++;
+  if (ns->i % ns->refresh == 0) {
+    nutstep_refresh(ns);
+  }
+}
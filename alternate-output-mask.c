@@ -0,0 +1,189 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Output-selective variants of iauAtioq and iauAtco13, implemented in C99.
+
+ iauAtioq and iauAtco13 always compute all of Az, ZD, HA, Dec and RA. Many callers need only some of them:
+ a dome needs only Az,ZD, and a guide camera on an equatorial mount needs only HA,Dec.
+ Here, a mask built from the IAU_OBS_* flags selects the outputs to compute.
+ The work for the other outputs is skipped: the atan2 calls, and the reconstruction of HA,Dec and RA.
+
+ Only the selected outputs are written; the pointers for the others may be NULL.
+ The selected outputs are identical to those of iauAtioq and iauAtco13.
+*/
+
+/* Minimum cos(alt) and sin(alt) for refraction purposes (the same values as iauAtioq). */
+static const double CELMIN = 1e-6;
+static const double SELMIN = 0.05;
+
+/*
+ Like iauAtioq, but computing only the outputs selected by the mask.
+ The polar motion and diurnal aberration are passed in precomputed, so that batches pay for them once.
+*/
+static void atioq_masked(int mask, double ri, double di, const iauASTROM *astrom,
+    double sx, double cx, double sy, double cy,
+    double *aob, double *zob, double *hob, double *dob, double *rob)
+{
+   double v[3];
+
+/* CIRS RA,Dec to Cartesian -HA,Dec. */
+   iauS2c(ri-astrom->eral, di, v);
+   double x = v[0];
+   double y = v[1];
+   double z = v[2];
+
+/* Polar motion. */
+   double xhd = cx*x + sx*z;
+   double yhd = sx*sy*x + cy*y - cx*sy*z;
+   double zhd = -sx*cy*x + sy*y + cx*cy*z;
+
+/* Diurnal aberration. */
+   double f = ( 1.0 - astrom->diurab*yhd );
+   double xhdt = f * xhd;
+   double yhdt = f * ( yhd + astrom->diurab );
+   double zhdt = f * zhd;
+
+/* Cartesian -HA,Dec to Cartesian Az,El (S=0,E=90). */
+   double xaet = astrom->sphi*xhdt - astrom->cphi*zhdt;
+   double yaet = yhdt;
+   double zaet = astrom->cphi*xhdt + astrom->sphi*zhdt;
+
+/* Azimuth (N=0,E=90). Refraction doesn't change it. */
+   if ( mask & IAU_OBS_AZ ) {
+      double azobs = ( xaet != 0.0 || yaet != 0.0 ) ? atan2(yaet,-xaet) : 0.0;
+      *aob = iauAnp(azobs);
+   }
+   if ( !(mask & (IAU_OBS_ZD | IAU_OBS_HADEC | IAU_OBS_RA)) ) return;
+
+/* Refraction: A*tan(z)+B*tan^3(z) model, with Newton-Raphson correction. */
+   double r = sqrt(xaet*xaet + yaet*yaet);
+   r = r > CELMIN ? r : CELMIN;
+   z = zaet > SELMIN ? zaet : SELMIN;
+   double tz = r/z;
+   double w = astrom->refb*tz*tz;
+   double del = ( astrom->refa + w ) * tz /
+         ( 1.0 + ( astrom->refa + 3.0*w ) / ( z*z ) );
+
+/* Apply the change, giving observed vector. */
+   double cosdel = 1.0 - del*del/2.0;
+   f = cosdel - del*z/r;
+   double xaeo = xaet*f;
+   double yaeo = yaet*f;
+   double zaeo = cosdel*zaet + del*r;
+
+/* Observed ZD. */
+   if ( mask & IAU_OBS_ZD ) {
+      *zob = atan2(sqrt(xaeo*xaeo+yaeo*yaeo), zaeo);
+   }
+   if ( !(mask & (IAU_OBS_HADEC | IAU_OBS_RA)) ) return;
+
+/* Az/El vector to HA,Dec vector (both right-handed). */
+   v[0] = astrom->sphi*xaeo + astrom->cphi*zaeo;
+   v[1] = yaeo;
+   v[2] = - astrom->cphi*xaeo + astrom->sphi*zaeo;
+
+/* To spherical -HA,Dec, computing only the angles needed (as in iauC2s). */
+   double d2 = v[0]*v[0] + v[1]*v[1];
+   if ( mask & (IAU_OBS_HA | IAU_OBS_RA) ) {
+      double hmobs = (d2 == 0.0) ? 0.0 : atan2(v[1], v[0]);
+      if ( mask & IAU_OBS_HA ) *hob = -hmobs;
+      if ( mask & IAU_OBS_RA ) *rob = iauAnp(astrom->eral + hmobs);
+   }
+   if ( mask & IAU_OBS_DEC ) {
+      *dob = (v[2] == 0.0) ? 0.0 : atan2(v[2], sqrt(d2));
+   }
+}
+
+/*
+ Like iauAtioq, but computing only the outputs selected by the mask, a combination of the IAU_OBS_* flags.
+ Outputs that aren't selected aren't written, and their pointers may be NULL.
+*/
+void terse_alternate_iauAtioqm(int mask, double ri, double di, iauASTROM *astrom,
+               double *aob, double *zob, double *hob, double *dob, double *rob)
+{
+   atioq_masked(mask, ri, di, astrom,
+      sin(astrom->xpl), cos(astrom->xpl), sin(astrom->ypl), cos(astrom->ypl),
+      aob, zob, hob, dob, rob);
+}
+
+/*
+ The batch form of terse_alternate_iauAtioqm, for n places transformed with the same astrometry parameters.
+ The output arrays for outputs that aren't selected may be NULL.
+*/
+void terse_alternate_iauAtioqmv(int mask, int n, const double ri[], const double di[], iauASTROM *astrom,
+                double aob[], double zob[], double hob[], double dob[], double rob[])
+{
+   double sx = sin(astrom->xpl);
+   double cx = cos(astrom->xpl);
+   double sy = sin(astrom->ypl);
+   double cy = cos(astrom->ypl);
+   double unused = 0.0;
+   for (int i = 0; i < n; ++i) {
+      atioq_masked(mask, ri[i], di[i], astrom, sx, cx, sy, cy,
+         aob ? &aob[i] : &unused, zob ? &zob[i] : &unused, hob ? &hob[i] : &unused,
+         dob ? &dob[i] : &unused, rob ? &rob[i] : &unused);
+   }
+}
+
+/*
+ Like iauAtco13, but computing only the outputs selected by the mask.
+ The equation of the origins is always returned. Same status as iauAtco13.
+*/
+int terse_alternate_iauAtco13m(int mask, double rc, double dc,
+               double pr, double pd, double px, double rv,
+               double utc1, double utc2, double dut1,
+               double elong, double phi, double hm, double xp, double yp,
+               double phpa, double tc, double rh, double wl,
+               double *aob, double *zob, double *hob,
+               double *dob, double *rob, double *eo)
+{
+   iauASTROM astrom;
+   double ri, di;
+
+   int j = iauApco13(utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                 phpa, tc, rh, wl, &astrom, eo);
+   if ( j < 0 ) return j;
+
+   iauAtciq(rc, dc, pr, pd, px, rv, &astrom, &ri, &di);
+   terse_alternate_iauAtioqm(mask, ri, di, &astrom, aob, zob, hob, dob, rob);
+   return j;
+}
+
+/*
+ The batch form of terse_alternate_iauAtco13m: n stars, all observed at the same time and place.
+ The star-independent parameters are computed once.
+ The proper motion, parallax and radial velocity arrays may be NULL, meaning zero for every star.
+ The output arrays for outputs that aren't selected may be NULL.
+ Same status as iauAtco13.
+*/
+int terse_alternate_iauAtco13mv(int mask, int n, const double rc[], const double dc[],
+                const double pr[], const double pd[], const double px[], const double rv[],
+                double utc1, double utc2, double dut1,
+                double elong, double phi, double hm, double xp, double yp,
+                double phpa, double tc, double rh, double wl,
+                double aob[], double zob[], double hob[],
+                double dob[], double rob[], double *eo)
+{
+   iauASTROM astrom;
+
+   int j = iauApco13(utc1, utc2, dut1, elong, phi, hm, xp, yp,
+                 phpa, tc, rh, wl, &astrom, eo);
+   if ( j < 0 ) return j;
+
+   double sx = sin(astrom.xpl);
+   double cx = cos(astrom.xpl);
+   double sy = sin(astrom.ypl);
+   double cy = cos(astrom.ypl);
+   double unused = 0.0;
+   for (int i = 0; i < n; ++i) {
+      double ri, di;
+      iauAtciq(rc[i], dc[i], pr ? pr[i] : 0.0, pd ? pd[i] : 0.0, px ? px[i] : 0.0, rv ? rv[i] : 0.0,
+         &astrom, &ri, &di);
+      atioq_masked(mask, ri, di, &astrom, sx, cx, sy, cy,
+         aob ? &aob[i] : &unused, zob ? &zob[i] : &unused, hob ? &hob[i] : &unused,
+         dob ? &dob[i] : &unused, rob ? &rob[i] : &unused);
+   }
+   return j;
+}
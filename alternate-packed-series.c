@@ -0,0 +1,210 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Evaluators for the IAU 2000A nutation and IAU 2006/2000A CIP X,Y series that read
+ the packed tables in alternate-packed-tables.c, implemented in C99.
+
+ The cache footprint of the tables is about a third of that of the tables in nut00a.c,
+ and a half of that of the tables in xy06.c (see ./run_tests.exe bench).
+ The arithmetic is the same as in iauNut00a and iauXy06, in the same order, so the
+ results are bit-identical to theirs.
+*/
+
+/* The fundamental arguments of the luni-solar nutation series (as in iauNut00a). */
+void terse_alternate_nut00a_ls_args(double t, double fa[5]) {
+   //Mean anomaly of the Moon (IERS 2003).
+   fa[0] = iauFal03(t);
+
+   //Mean anomaly of the Sun (MHB2000).
+   fa[1] = fmod(1287104.79305  +
+            t * (129596581.0481  +
+            t * (-0.5532  +
+            t * (0.000136  +
+            t * (-0.00001149)))), TURNAS) * DAS2R;
+
+   //Mean longitude of the Moon minus that of the ascending node (IERS 2003).
+   fa[2] = iauFaf03(t);
+
+   //Mean elongation of the Moon from the Sun (MHB2000).
+   fa[3] = fmod(1072260.70369  +
+          t * (1602961601.2090  +
+          t * (-6.3706  +
+          t * (0.006593  +
+          t * (-0.00003169)))), TURNAS) * DAS2R;
+
+   //Mean longitude of the ascending node of the Moon (IERS 2003).
+   fa[4] = iauFaom03(t);
+}
+
+/* The fundamental arguments of the planetary nutation series (as in iauNut00a, which uses the MHB2000 forms for some). */
+void terse_alternate_nut00a_pl_args(double t, double fa[13]) {
+   fa[0] = fmod(2.35555598 + 8328.6914269554 * t, D2PI);
+   fa[1] = fmod(1.627905234 + 8433.466158131 * t, D2PI);
+   fa[2] = fmod(5.198466741 + 7771.3771468121 * t, D2PI);
+   fa[3] = fmod(2.18243920 - 33.757045 * t, D2PI);
+   fa[4] = iauFame03(t);
+   fa[5] = iauFave03(t);
+   fa[6] = iauFae03(t);
+   fa[7] = iauFama03(t);
+   fa[8] = iauFaju03(t);
+   fa[9] = iauFasa03(t);
+   fa[10] = iauFaur03(t);
+   fa[11] = fmod(5.321159000 + 3.8127774000 * t, D2PI);
+   fa[12] = iauFapa03(t);
+}
+
+/* The argument of luni-solar term i of the packed table. */
+double terse_alternate_nut00a_ls_arg(int i, const double fa[5]) {
+   const signed char *m = terse_alternate_nut_ls_mult[i];
+   return fmod((double)m[0] * fa[0] +
+               (double)m[1] * fa[1] +
+               (double)m[2] * fa[2] +
+               (double)m[3] * fa[3] +
+               (double)m[4] * fa[4], D2PI);
+}
+
+/* The argument of planetary term i of the packed table. */
+double terse_alternate_nut00a_pl_arg(int i, const double fa[13]) {
+   const signed char *m = terse_alternate_nut_pl_mult[i];
+   return fmod((double)m[0]  * fa[0]  +
+               (double)m[1]  * fa[1]  +
+               (double)m[2]  * fa[2]  +
+               (double)m[3]  * fa[3]  +
+               (double)m[4]  * fa[4]  +
+               (double)m[5]  * fa[5]  +
+               (double)m[6]  * fa[6]  +
+               (double)m[7]  * fa[7]  +
+               (double)m[8]  * fa[8]  +
+               (double)m[9]  * fa[9]  +
+               (double)m[10] * fa[10] +
+               (double)m[11] * fa[11] +
+               (double)m[12] * fa[12], D2PI);
+}
+
+/* Like iauNut00a, but reading the packed tables. Same arguments as iauNut00a. */
+void terse_alternate_iauNut00aPacked(double date1, double date2, double *dpsi, double *deps)
+{
+   //Units of 0.1 microarcsecond to radians
+   const double U2R = DAS2R / 1e7;
+   double fa[13];
+
+   //Interval between fundamental date J2000.0 and given date (JC).
+   double t = ((date1 - DJ00) + date2) / DJC;
+
+   //Luni-solar nutation.
+   terse_alternate_nut00a_ls_args(t, fa);
+   double dp = 0.0;
+   double de = 0.0;
+   for (int i = 0; i < NUT_LS_N; i++) {
+      double arg = terse_alternate_nut00a_ls_arg(i, fa);
+      double sarg = sin(arg);
+      double carg = cos(arg);
+      dp += ((double)terse_alternate_nut_ls_sp[i] + (double)terse_alternate_nut_ls_spt[i] * t) * sarg + (double)terse_alternate_nut_ls_cp[i] * carg;
+      de += ((double)terse_alternate_nut_ls_ce[i] + (double)terse_alternate_nut_ls_cet[i] * t) * carg + (double)terse_alternate_nut_ls_se[i] * sarg;
+   }
+   double dpsils = dp * U2R;
+   double depsls = de * U2R;
+
+   //Planetary nutation.
+   terse_alternate_nut00a_pl_args(t, fa);
+   dp = 0.0;
+   de = 0.0;
+   for (int i = 0; i < NUT_PL_N; i++) {
+      double arg = terse_alternate_nut00a_pl_arg(i, fa);
+      double sarg = sin(arg);
+      double carg = cos(arg);
+      dp += (double)terse_alternate_nut_pl_sp[i] * sarg + (double)terse_alternate_nut_pl_cp[i] * carg;
+      de += (double)terse_alternate_nut_pl_se[i] * sarg + (double)terse_alternate_nut_pl_ce[i] * carg;
+   }
+   double dpsipl = dp * U2R;
+   double depspl = de * U2R;
+
+   *dpsi = dpsils + dpsipl;
+   *deps = depsls + depspl;
+}
+
+/* Amplitude usage, by coefficient number within a frequency: X or Y, sin or cos, power of T (as in iauXy06). */
+static const int XY_JAXY[20] = {0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1,0,1};
+static const int XY_JASC[20] = {0,1,1,0,1,0,0,1,0,1,1,0,1,0,0,1,0,1,1,0};
+static const int XY_JAPT[20] = {0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4};
+
+/* The 14 fundamental arguments of the X,Y series (IERS 2003), in the order used by iauXy06. */
+static void xy06_args(double t, double fa[14]) {
+   fa[0] = iauFal03(t);
+   fa[1] = iauFalp03(t);
+   fa[2] = iauFaf03(t);
+   fa[3] = iauFad03(t);
+   fa[4] = iauFaom03(t);
+   fa[5] = iauFame03(t);
+   fa[6] = iauFave03(t);
+   fa[7] = iauFae03(t);
+   fa[8] = iauFama03(t);
+   fa[9] = iauFaju03(t);
+   fa[10] = iauFasa03(t);
+   fa[11] = iauFaur03(t);
+   fa[12] = iauFane03(t);
+   fa[13] = iauFapa03(t);
+}
+
+/* The polynomial part of X,Y (arcsec), for the powers of T. */
+static void xy06_poly(const double pt[6], double xypr[2]) {
+   static const double xyp[2][6] = {
+      { -0.016617, 2004.191898, -0.4297829, -0.19861834, 0.000007578, 0.0000059285 },
+      { -0.006951, -0.025896, -22.4072747, 0.00190059, 0.001112526, 0.0000001358 }
+   };
+   for (int jxy = 0; jxy < 2; jxy++) {
+      xypr[jxy] = 0.0;
+      for (int j = 5; j >= 0; j--) {
+         xypr[jxy] += xyp[jxy][j] * pt[j];
+      }
+   }
+}
+
+/* Like iauXy06, but reading the packed tables. Same arguments as iauXy06. */
+void terse_alternate_iauXy06Packed(double date1, double date2, double *x, double *y)
+{
+   double pt[6], fa[14], xypr[2], xypl[2] = {0.0, 0.0}, xyls[2] = {0.0, 0.0}, sc[2];
+
+   //Interval between fundamental date J2000.0 and given date (JC), and its powers.
+   double t = ((date1 - DJ00) + date2) / DJC;
+   double w = 1.0;
+   for (int jpt = 0; jpt <= 5; jpt++) {
+      pt[jpt] = w;
+      w *= t;
+   }
+   xy06_args(t, fa);
+   xy06_poly(pt, xypr);
+
+   //The amplitudes are read in one forward stream, through the planetary frequencies and then the luni-solar ones.
+   const double *amp = terse_alternate_xy_amp;
+   const unsigned char *count = terse_alternate_xy_count;
+   for (int f = 0; f < XY_PL_N; f++, count++) {
+      double arg = 0.0;
+      for (int i = 0; i < 14; i++) {
+         int m = terse_alternate_xy_pl_mult[f][i];
+         if (m != 0) arg += (double)m * fa[i];
+      }
+      sc[0] = sin(arg);
+      sc[1] = cos(arg);
+      for (int j = *count - 1; j >= 0; j--) {
+         xypl[XY_JAXY[j]] += *amp++ * sc[XY_JASC[j]] * pt[XY_JAPT[j]];
+      }
+   }
+   for (int f = 0; f < XY_LS_N; f++, count++) {
+      double arg = 0.0;
+      for (int i = 0; i < 5; i++) {
+         int m = terse_alternate_xy_ls_mult[f][i];
+         if (m != 0) arg += (double)m * fa[i];
+      }
+      sc[0] = sin(arg);
+      sc[1] = cos(arg);
+      for (int j = *count - 1; j >= 0; j--) {
+         xyls[XY_JAXY[j]] += *amp++ * sc[XY_JASC[j]] * pt[XY_JAPT[j]];
+      }
+   }
+
+   *x = DAS2R * (xypr[0] + (xyls[0] + xypl[0]) / 1e6);
+   *y = DAS2R * (xypr[1] + (xyls[1] + xypl[1]) / 1e6);
+}
@@ -0,0 +1,4374 @@
+#include "alternate-headers.h"
+
+/*
+ Packed coefficient tables for the IAU 2000A nutation series (iauNut00a) and the
+ IAU 2006/2000A CIP X,Y series (iauXy06), implemented in C99.
+
+ The values are exactly those in nut00a.c and xy06.c, but stored more compactly:
+   - the multipliers of the fundamental arguments are signed chars, not ints.
+   - the amplitudes are in separate arrays (structure-of-arrays), as the narrowest integer
+     type that holds them exactly. (The X,Y amplitudes aren't integers, and stay as doubles.)
+   - the terms are stored in the order in which SOFA sums them (it sums in reverse order),
+     so the evaluators stream forward through every table, and give bit-identical results.
+
+ These tables were generated mechanically from nut00a.c and xy06.c. Don't edit them by hand.
+*/
+
+/* Luni-solar nutation: multipliers of l, l', F, D, Om, then the amplitudes (0.1 microarcsec). */
+const signed char terse_alternate_nut_ls_mult[NUT_LS_N][5] = {
+   {  2,   0,   2,   4,   1},
+   {  2,  -1,   2,   4,   2},
+   {  5,   0,   2,   0,   1},
+   {  3,   1,   2,   2,   2},
+   {  1,   1,   2,   4,   2},
+   {  1,  -1,   2,   4,   1},
+   { -1,   0,   2,   6,   1},
+   { -1,  -1,   2,   6,   2},
+   {  4,   1,   2,   0,   2},
+   {  2,   1,   2,   2,   1},
+   {  3,   0,   2,   1,   2},
+   {  4,  -1,   2,   0,   2},
+   {  0,   0,   4,   2,   2},
+   {  2,   0,   2,   2,   0},
+   {  4,   0,   0,   2,   0},
+   {  1,   0,   2,   3,   2},
+   {  0,   0,   2,   4,   0},
+   {  2,  -2,   2,   2,   2},
+   {  2,   0,   0,   4,   0},
+   {  2,   0,   0,   4,   1},
+   { -2,   0,   2,   6,   1},
+   {  0,  -2,   2,   4,   2},
+   {  0,   0,   0,   6,   0},
+   { -2,  -1,   2,   6,   2},
+   {  3,   0,   4,  -2,   2},
+   {  3,   1,   2,   0,   1},
+   {  1,   0,   4,   0,   1},
+   {  2,   1,   2,   1,   2},
+   {  5,   0,   0,   0,   0},
+   {  2,   0,   2,   1,   1},
+   { -1,   0,   4,   2,   1},
+   {  0,   1,   2,   3,   2},
+   { -1,   1,   2,   4,   1},
+   {  0,   0,   2,   3,   1},
+   {  1,  -1,   2,   2,   0},
+   {  3,  -1,   0,   2,   0},
+   {  1,  -2,   2,   2,   1},
+   { -2,   0,   2,   5,   2},
+   {  1,  -1,   0,   4,   0},
+   {  1,  -1,   0,   4,   1},
+   { -3,   0,   2,   6,   1},
+   { -1,   0,   0,   6,   1},
+   { -3,  -1,   2,   6,   2},
+   { -1,  -1,   0,   6,   0},
+   {  4,   1,   2,  -2,   2},
+   {  2,   0,   4,  -2,   1},
+   {  2,   1,   2,   0,   0},
+   {  0,   2,   2,   2,   2},
+   {  1,   1,   2,   1,   1},
+   {  1,   0,   3,   0,   3},
+   {  1,   0,   2,   0,   2},
+   {  3,   0,   2,   0,   2},
+   {  2,   0,   2,   0,   3},
+   {  0,   1,   2,   2,   0},
+   {  1,   0,   2,   1,   0},
+   {  2,  -1,   2,   0,   0},
+   {  2,   1,   0,   2,   0},
+   {  2,   1,   0,   2,   1},
+   { -2,   0,   4,   2,   1},
+   { -1,   0,   2,   2,   2},
+   {  1,   0,   2,   2,   2},
+   {  0,   0,   2,   2,   3},
+   {  1,  -1,   2,   1,   2},
+   {  0,   1,   0,   4,   0},
+   {  0,   1,   0,   4,   1},
+   {  1,   0,   0,   3,   0},
+   {  2,  -1,   0,   2,   1},
+   { -2,   0,   2,   4,   0},
+   { -1,  -1,   2,   3,   2},
+   {  0,   0,   0,   4,   2},
+   {  0,  -3,   2,   2,   2},
+   { -2,  -2,   2,   4,   2},
+   { -2,   0,   0,   6,   1},
+   {  0,  -2,   0,   4,   0},
+   { -2,  -1,   0,   6,   0},
+   {  1,   1,   4,  -2,   2},
+   {  3,   1,   2,  -2,   1},
+   {  1,   2,   2,   0,   1},
+   { -1,   0,   4,   0,   0},
+   { -1,   2,   2,   2,   1},
+   {  0,   0,   3,   0,   2},
+   {  0,   0,   3,   0,   3},
+   {  0,   0,   2,   0,   1},
+   {  2,  -1,   2,  -1,   2},
+   {  2,   1,   0,   1,   0},
+   {  3,   0,   0,   0,   2},
+   { -1,   1,   2,   2,   0},
+   { -2,   0,   2,   2,   2},
+   {  0,   0,   2,   2,   2},
+   { -1,   0,   2,   2,   3},
+   {  0,   1,   0,   3,   0},
+   {  1,  -2,   2,   0,   1},
+   { -1,   1,   0,   4,   1},
+   {  0,   0,   0,   3,   2},
+   { -3,   0,   0,  -2,   1},
+   { -1,   0,   0,  -4,   1},
+   { -4,   0,   0,   0,   1},
+   { -2,   1,   0,  -2,   1},
+   {  0,   1,   0,  -4,   1},
+   { -3,   0,  -2,   2,   0},
+   { -3,   0,   0,   0,   2},
+   { -1,  -1,   0,  -2,   1},
+   { -3,   0,   2,  -2,   1},
+   { -3,   0,   2,   4,   2},
+   { -1,  -3,   2,   2,   2},
+   { -1,  -2,   0,   4,   0},
+   {  2,   0,   4,  -4,   2},
+   {  2,   2,   2,  -2,   2},
+   {  4,   0,   2,  -4,   2},
+   {  0,   1,   4,  -2,   1},
+   {  0,   0,   4,  -2,   3},
+   {  0,  -1,   4,  -2,   1},
+   {  2,  -1,   2,  -2,   1},
+   {  0,   2,   0,   2,   0},
+   {  1,   0,   1,   0,   0},
+   {  1,   0,   1,   0,   1},
+   {  1,   1,   0,   1,   1},
+   {  2,  -2,   2,  -2,   2},
+   { -2,   1,   2,   2,   1},
+   {  0,  -1,   2,   0,   0},
+   { -1,  -1,   2,   1,   2},
+   { -1,   1,   0,   3,   0},
+   { -1,   0,   1,   2,   1},
+   {  0,  -2,   2,   0,   1},
+   { -1,   0,   0,   2,   0},
+   {  1,  -1,   0,   1,   0},
+   {  2,  -2,   0,   0,   0},
+   { -1,   0,   0,   3,   1},
+   { -2,   0,   0,   4,   2},
+   { -1,  -1,   0,   3,   0},
+   {  0,   0,  -2,   4,   0},
+   {  0,  -3,   0,   2,   0},
+   { -2,  -2,   0,   4,   0},
+   { -1,   1,   4,  -2,   2},
+   {  2,   0,   2,  -3,   2},
+   {  1,   2,   0,   0,   1},
+   {  1,   0,   2,  -2,   3},
+   {  3,   0,   0,  -2,   1},
+   {  2,   0,   0,  -1,   1},
+   { -2,   0,   2,   0,   2},
+   {  0,   0,   2,   0,   2},
+   { -1,   2,   0,   2,   1},
+   {  0,   0,   1,   0,   0},
+   {  0,   0,   1,   0,   1},
+   {  0,   0,   1,   0,   2},
+   {  1,  -2,   2,  -2,   1},
+   { -1,   1,   0,   2,   2},
+   {  1,   1,  -2,   2,   0},
+   { -3,   0,   2,   2,   0},
+   {  0,  -1,   0,   1,   0},
+   { -2,   0,   0,   3,   1},
+   {  0,   0,  -2,   3,   0},
+   { -2,  -1,   0,   3,   0},
+   { -1,   0,  -2,   4,   1},
+   { -1,  -3,   0,   2,   0},
+   { -1,  -1,  -2,   4,   0},
+   {  0,   1,   4,  -4,   2},
+   {  0,   1,   4,  -4,   4},
+   {  2,   1,   2,  -4,   1},
+   {  2,   1,   2,  -4,   2},
+   {  1,   0,   0,  -4,   2},
+   { -1,   0,   2,  -4,   2},
+   {  1,   0,   2,  -6,   1},
+   { -2,  -1,  -2,   2,   0},
+   {  0,   0,  -4,   2,   0},
+   { -2,   0,  -2,   2,   1},
+   { -1,   0,  -2,   1,   0},
+   { -3,   0,   0,   1,   0},
+   {  0,   0,  -2,   0,   2},
+   { -1,  -1,   0,  -1,   1},
+   { -4,   0,   2,   0,   1},
+   {  2,   0,  -2,  -2,   1},
+   { -1,   0,   0,  -2,   0},
+   {  0,   1,   0,  -2,   2},
+   {  0,  -1,   2,  -4,   1},
+   { -2,   1,   2,  -2,   1},
+   {  2,   0,   0,  -4,   2},
+   {  0,   1,   2,  -4,   2},
+   {  2,   0,   2,  -6,   1},
+   { -3,  -1,   0,   2,   0},
+   { -3,   0,   0,   2,   0},
+   { -1,  -1,   0,   0,   2},
+   { -1,   1,  -2,   2,   0},
+   { -3,   1,   0,   2,   0},
+   {  1,   0,  -2,   0,   2},
+   {  1,  -2,   0,  -2,   1},
+   { -2,   1,   0,   1,   0},
+   {  0,   0,   0,  -1,   2},
+   { -1,   1,   0,   0,   2},
+   { -1,  -1,   2,  -2,   2},
+   {  0,   0,   0,  -2,   0},
+   { -1,   2,   0,   0,   1},
+   {  2,   0,   0,  -3,   1},
+   { -1,   2,   2,  -2,   1},
+   {  1,   1,   2,  -4,   2},
+   {  1,   2,   2,  -4,   1},
+   { -2,   0,  -2,   4,   0},
+   { -2,  -2,   0,   2,   1},
+   { -2,   0,   4,  -2,   1},
+   { -2,   0,   4,  -2,   2},
+   { -1,   1,   2,  -1,   1},
+   {  1,  -1,   2,  -3,   1},
+   {  0,   2,   0,   0,   2},
+   {  1,   0,   1,  -2,   1},
+   {  1,   1,   0,  -1,   1},
+   { -2,   1,   2,   0,   2},
+   { -1,   2,   0,   1,   0},
+   {  0,   0,   1,  -1,   0},
+   {  2,  -1,   0,  -2,   2},
+   {  2,   1,  -2,   0,   1},
+   { -4,   0,   0,   4,   0},
+   { -1,   0,  -2,   3,   0},
+   { -2,  -1,   0,   2,   2},
+   { -3,   0,   0,   3,   0},
+   {  0,  -2,   0,   0,   2},
+   {  0,  -2,   0,   0,   2},
+   { -1,   0,  -1,   2,   0},
+   { -3,   1,   0,   3,   0},
+   { -4,   0,   2,   2,   0},
+   {  2,  -1,  -2,   0,   1},
+   {  1,   0,  -2,   1,   1},
+   { -2,  -1,   2,   0,   2},
+   { -3,   0,   2,   1,   1},
+   { -4,   1,   2,   2,   2},
+   { -1,   0,   1,   0,   0},
+   { -2,   2,   0,   2,   2},
+   { -1,  -1,   2,  -1,   2},
+   { -1,   0,   1,   0,   1},
+   { -1,   0,   1,   0,   2},
+   {  2,  -2,   0,  -2,   1},
+   {  1,   0,  -1,   0,   1},
+   {  0,  -2,   2,  -2,   3},
+   { -1,   0,   1,   0,   3},
+   {  0,  -1,   1,  -1,   1},
+   {  4,   0,   2,   2,   2},
+   {  0,   0,   2,   6,   2},
+   {  5,   0,   2,   0,   2},
+   {  3,   0,   2,   2,   1},
+   {  3,  -1,   2,   2,   2},
+   {  1,  -1,   2,   4,   2},
+   {  0,   1,   2,   4,   2},
+   {  2,  -1,   2,   2,   1},
+   {  0,  -1,   2,   4,   1},
+   {  5,   0,   2,  -2,   2},
+   {  1,   0,   4,   0,   2},
+   {  3,   0,   2,   0,   0},
+   {  3,  -1,   2,   0,   1},
+   {  3,   0,   0,   2,   1},
+   { -1,   0,   2,   4,   0},
+   { -3,   0,   2,   6,   2},
+   { -1,  -2,   2,   4,   2},
+   { -1,   0,   0,   6,   0},
+   {  4,   0,   2,  -2,   1},
+   {  3,   0,   2,  -1,   2},
+   { -1,   1,   2,   3,   2},
+   {  2,  -2,   2,   0,   2},
+   {  2,   0,   0,   2,   2},
+   { -2,   1,   2,   4,   2},
+   { -1,   0,   2,   3,   1},
+   {  0,  -1,   2,   2,   0},
+   {  0,  -2,   2,   2,   1},
+   { -2,  -1,   2,   4,   1},
+   {  0,  -1,   0,   4,   1},
+   { -2,   0,   0,   6,   0},
+   {  1,   2,   2,   0,   2},
+   {  0,   0,   4,  -1,   2},
+   {  1,   1,   2,   0,   0},
+   {  2,   0,   2,  -1,   1},
+   {  3,  -1,   2,  -2,   2},
+   {  3,   1,   0,   0,   0},
+   {  1,   0,   2,   0,   3},
+   {  0,   0,   2,   1,   0},
+   {  1,  -1,   2,   0,   0},
+   {  2,   0,   0,   1,   0},
+   {  3,  -1,   0,   0,   0},
+   {  0,  -1,   2,   1,   2},
+   {  1,   0,   0,   2,   2},
+   { -2,   0,   2,   3,   2},
+   { -1,  -1,   2,   2,   0},
+   { -1,   1,   0,   4,   0},
+   {  0,   0,   0,   3,   0},
+   {  0,   0,   0,   3,   1},
+   { -2,   0,  -2,   0,   1},
+   {  0,   0,  -2,  -2,   1},
+   {  1,   0,  -2,  -2,   1},
+   { -1,   0,   0,  -2,   2},
+   { -1,  -2,   2,   2,   1},
+   { -1,   0,   0,   4,   2},
+   {  1,  -2,   0,   2,   0},
+   { -1,  -1,   0,   4,   1},
+   { -3,   0,   0,   6,   0},
+   {  0,   2,   2,   0,   1},
+   {  0,   0,   4,  -2,   4},
+   {  0,  -1,   4,  -2,   2},
+   {  0,   1,   2,   0,   0},
+   {  2,   1,   0,   0,   1},
+   { -2,   0,   4,   0,   1},
+   {  1,  -1,   2,  -1,   2},
+   {  0,   1,   0,   2,   2},
+   {  1,   0,   0,   1,   1},
+   {  2,   0,  -2,   2,   0},
+   { -2,  -1,   2,   2,   1},
+   { -2,   1,   0,   4,   0},
+   {  0,  -1,   0,   2,   2},
+   { -2,  -1,   0,   4,   1},
+   {  1,   0,   4,  -4,   2},
+   {  1,   2,   2,  -2,   1},
+   {  3,   0,   2,  -4,   2},
+   { -1,   0,   4,  -2,   1},
+   { -1,   2,   2,   0,   2},
+   {  1,   2,   0,   0,   0},
+   { -1,   1,   2,   0,   0},
+   {  1,   1,   0,   0,   2},
+   { -1,   0,   2,   0,   3},
+   {  0,  -1,   2,  -1,   1},
+   {  1,  -2,   2,  -2,   2},
+   { -1,  -1,   2,   0,   0},
+   {  0,   0,   0,   1,   2},
+   {  1,  -1,   0,   0,   2},
+   {  1,  -2,   0,   0,   1},
+   { -1,  -1,   0,   2,   2},
+   {  1,  -1,  -2,   2,   0},
+   { -3,   0,   0,   4,   1},
+   { -3,  -1,   0,   4,   0},
+   {  0,   3,   2,  -2,   2},
+   {  0,   0,   4,  -4,   1},
+   { -1,   0,   2,  -4,   1},
+   {  1,   1,   0,  -4,   1},
+   { -4,   0,   0,   2,   0},
+   { -2,  -1,   0,   0,   1},
+   { -2,   0,   2,  -2,   2},
+   {  1,   0,   0,  -3,   1},
+   {  0,   2,   0,  -2,   1},
+   {  2,   1,   0,  -4,   1},
+   {  0,   1,   2,  -4,   1},
+   { -1,  -1,  -2,   2,   0},
+   { -3,   0,   0,   2,   1},
+   {  0,   0,  -2,   1,   0},
+   { -2,   0,   0,   1,   0},
+   { -3,   0,   2,   0,   2},
+   { -3,   0,   2,   0,   0},
+   {  1,   1,   0,  -2,   2},
+   {  1,  -1,   2,  -4,   1},
+   { -1,   1,   2,  -2,   2},
+   {  3,   0,   0,  -4,   1},
+   {  1,   2,   0,  -2,   1},
+   {  0,  -2,  -2,   2,   0},
+   { -2,   0,  -2,   4,   0},
+   { -2,  -2,   0,   2,   0},
+   {  0,   0,   2,  -2,   4},
+   { -2,   1,   2,   0,   0},
+   {  0,  -1,   2,  -2,   3},
+   {  1,   0,   0,  -1,   2},
+   {  0,   0,  -2,   2,   2},
+   { -1,  -1,   0,   1,   0},
+   { -4,   0,   2,   2,   1},
+   { -1,   0,   0,   1,   2},
+   {  2,   0,  -2,   0,   2},
+   { -3,   1,   2,   1,   2},
+   {  1,   1,  -2,   1,   0},
+   {  2,   0,   2,   4,   2},
+   {  1,   0,   2,   4,   1},
+   { -1,   0,   2,   6,   2},
+   {  2,   1,   2,   2,   2},
+   { -2,   0,   2,   6,   2},
+   {  1,   1,   2,   2,   1},
+   { -1,   0,   4,   2,   2},
+   {  3,   0,   0,   2,   0},
+   { -1,   1,   2,   4,   2},
+   {  0,   0,   2,   3,   2},
+   {  1,  -2,   2,   2,   2},
+   {  1,   0,   0,   4,   1},
+   { -1,  -1,   2,   4,   1},
+   {  2,   0,   4,  -2,   2},
+   {  0,   0,   4,   0,   1},
+   {  2,  -1,   0,   2,   0},
+   {  0,  -1,   0,   4,   0},
+   {  3,   1,   2,  -2,   2},
+   { -1,   2,   2,   2,   2},
+   {  1,   1,   0,   2,   1},
+   {  1,  -1,   0,   2,   1},
+   {  0,   0,   0,  -4,   1},
+   { -1,   1,   0,  -2,   1},
+   {  0,   1,   4,  -2,   2},
+   {  1,   1,   0,   1,   0},
+   { -2,   1,   2,   2,   2},
+   {  2,  -1,   0,   0,   1},
+   { -2,   0,   2,   2,   0},
+   { -3,   0,   2,   2,   1},
+   { -3,   0,   2,   2,   2},
+   {  1,   0,  -2,   2,   1},
+   { -2,   0,   0,   3,   0},
+   { -1,  -2,   0,   2,   1},
+   {  0,   0,   4,  -4,   2},
+   {  0,   0,   4,  -4,   4},
+   {  2,   0,   2,  -4,   2},
+   { -1,   0,   0,  -1,   1},
+   { -2,   1,   0,   0,   1},
+   {  0,   0,   2,  -4,   2},
+   { -1,   0,  -2,   2,   1},
+   {  0,   0,   2,  -3,   1},
+   {  0,   1,   2,  -2,   3},
+   {  1,   0,   2,  -3,   2},
+   { -1,   0,   2,  -1,   2},
+   {  2,  -1,   0,  -2,   1},
+   {  0,  -1,  -2,   2,   1},
+   {  1,   0,  -2,   1,   0},
+   {  0,   1,  -2,   2,   1},
+   { -2,  -1,   2,   0,   0},
+   {  4,   0,   2,   0,   1},
+   {  3,   1,   2,   0,   2},
+   {  2,   0,   2,   1,   2},
+   {  1,   0,   2,   2,   0},
+   {  1,   0,   0,   4,   0},
+   {  1,   1,   2,   1,   2},
+   { -2,   0,   4,   2,   2},
+   {  1,   0,   4,  -2,   1},
+   {  0,   1,   2,   1,   1},
+   {  1,  -2,   2,   0,   2},
+   { -2,   0,   0,  -2,   1},
+   {  2,   1,   2,  -2,   1},
+   {  1,   0,   2,  -1,   1},
+   {  2,  -1,   2,  -2,   2},
+   {  1,   2,   2,  -2,   2},
+   {  1,  -1,   2,  -2,   1},
+   { -1,   2,   0,   2,   0},
+   {  0,   1,   0,   1,   1},
+   {  1,  -2,   0,   0,   0},
+   { -1,   0,  -2,   4,   0},
+   { -2,   0,  -2,   2,   0},
+   { -2,   0,   0,   0,   2},
+   {  0,  -1,   0,  -2,   1},
+   {  0,  -1,   0,  -1,   1},
+   { -1,  -1,   2,  -2,   1},
+   {  1,   1,   2,  -4,   1},
+   {  1,   0,   2,  -3,   1},
+   { -2,   2,   0,   2,   1},
+   {  3,  -1,   2,   0,   2},
+   {  2,   1,   2,   0,   1},
+   {  4,   0,   0,   0,   0},
+   {  1,   0,   2,   1,   1},
+   {  2,   0,   2,  -1,   2},
+   {  1,   1,   0,   2,   0},
+   {  0,   2,   2,   0,   2},
+   { -2,  -1,   2,   2,   2},
+   { -1,   0,   0,   3,   0},
+   { -2,  -1,   0,   4,   0},
+   {  1,  -1,   2,  -2,   2},
+   { -1,  -1,   2,   0,   1},
+   {  1,  -1,   0,  -2,   1},
+   {  1,   0,   2,  -4,   2},
+   {  0,  -2,   0,   0,   1},
+   { -1,  -1,   2,  -1,   1},
+   {  0,   2,  -2,   2,   0},
+   {  2,  -1,   2,   2,   2},
+   {  0,  -1,   2,   4,   2},
+   {  0,   1,   2,   2,   1},
+   {  2,  -1,   2,   0,   1},
+   { -1,   0,   2,   3,   2},
+   {  3,   0,   0,   0,   1},
+   { -1,   1,   2,   2,   1},
+   { -1,   0,  -2,   0,   1},
+   { -2,   0,   4,   0,   2},
+   {  0,   0,   2,   0,   3},
+   {  2,   0,   0,   0,   2},
+   { -1,   0,   2,   1,   2},
+   {  0,  -2,   2,   0,   2},
+   { -1,   0,   4,  -2,   2},
+   {  0,  -1,   2,  -1,   2},
+   { -1,   1,   0,   2,   2},
+   { -2,   0,   2,  -2,   1},
+   { -3,   0,   2,   0,   1},
+   {  2,   1,   0,  -2,   1},
+   { -2,   1,   2,   0,   1},
+   { -2,   1,   0,   2,   0},
+   {  1,  -1,   2,   2,   1},
+   { -2,  -1,   2,   4,   2},
+   { -1,  -2,   2,   2,   2},
+   { -1,  -1,   0,   4,   0},
+   { -1,   1,   2,   0,   1},
+   { -3,   0,   0,   4,   0},
+   {  0,   2,   2,  -2,   1},
+   {  1,   0,   0,  -4,   1},
+   {  0,   2,   0,   0,   1},
+   {  2,   0,   0,  -2,   2},
+   {  4,   0,   2,  -2,   2},
+   {  2,   0,   0,   2,   1},
+   {  0,  -2,   2,   2,   2},
+   {  0,   0,   2,  -1,   1},
+   { -1,   1,   0,   2,   1},
+   {  2,   0,   2,  -4,   1},
+   {  0,   0,   0,  -2,   2},
+   {  2,   0,   0,  -4,   1},
+   { -1,   1,   2,  -2,   1},
+   {  3,   0,   2,   2,   2},
+   {  0,   0,   2,   4,   1},
+   {  1,   1,   2,   2,   2},
+   { -3,   0,   0,   0,   1},
+   { -2,   0,   0,   4,   1},
+   {  0,  -2,   0,   2,   0},
+   {  1,   0,   0,  -1,   1},
+   { -2,  -1,   0,   2,   1},
+   {  3,   0,   2,  -2,   1},
+   {  0,   0,   4,  -2,   1},
+   { -1,  -1,   2,   0,   2},
+   { -2,   0,   0,   2,   2},
+   { -2,  -1,   2,   0,   1},
+   { -2,   2,   0,   2,   0},
+   {  1,   0,   2,   4,   2},
+   { -1,  -1,   2,   4,   2},
+   {  0,   0,   0,   4,   1},
+   {  0,  -1,   0,   2,   1},
+   {  0,   0,   2,  -4,   1},
+   {  0,   3,   0,   0,   0},
+   {  0,   0,   0,   0,   3},
+   {  0,   0,   4,   0,   2},
+   {  2,   1,   0,   0,   0},
+   { -1,  -2,   0,   2,   0},
+   {  0,   0,   2,  -3,   2},
+   {  2,   0,   2,   2,   1},
+   { -1,   0,   4,   0,   1},
+   { -1,   0,   0,   4,   1},
+   {  1,   0,   0,   1,   0},
+   {  2,   0,   2,   0,   0},
+   { -2,   0,   2,   4,   1},
+   {  0,   1,   0,   2,   1},
+   { -1,  -1,   0,   0,   1},
+   {  1,   0,   4,  -2,   2},
+   {  0,   1,   2,   1,   2},
+   {  2,   1,   2,  -2,   2},
+   {  2,  -1,   0,   0,   0},
+   {  4,   0,   2,   0,   2},
+   { -2,   0,   2,   2,   1},
+   { -1,   0,   2,  -1,   1},
+   {  0,   0,   2,   2,   0},
+   {  1,   1,   2,  -2,   1},
+   {  1,   0,  -2,   0,   1},
+   { -1,   0,   2,   4,   1},
+   {  1,   0,   0,  -2,   2},
+   {  0,   0,   2,   1,   1},
+   {  1,   0,   2,   1,   2},
+   {  0,   0,   0,   4,   0},
+   {  1,  -1,   0,   2,   0},
+   {  1,   0,   2,  -1,   2},
+   { -1,   1,   0,   0,   1},
+   {  0,   0,   0,  -1,   1},
+   { -1,   0,   2,  -2,   2},
+   {  0,   1,   0,  -2,   1},
+   {  0,   1,   0,   1,   0},
+   { -1,   0,   0,   2,   2},
+   {  1,   0,  -2,   2,   0},
+   {  2,   0,   0,   2,   0},
+   {  1,   1,   2,   0,   1},
+   {  1,   1,   0,   0,   1},
+   {  2,   1,   2,   0,   2},
+   { -1,   0,   2,   2,   0},
+   {  0,   0,   0,   1,   1},
+   {  0,   3,   2,  -2,   2},
+   {  0,  -1,  -2,   2,   0},
+   {  0,   1,   0,   2,   0},
+   { -1,   1,   2,   0,   2},
+   {  1,  -1,   2,   0,   1},
+   {  0,   0,   0,   2,   2},
+   {  2,  -1,   2,   0,   2},
+   {  0,  -1,   2,   2,   1},
+   { -1,   0,  -2,   2,   0},
+   {  1,   0,   2,  -4,   1},
+   {  0,  -1,   0,   0,   2},
+   { -1,  -1,   2,   2,   1},
+   {  0,   1,   2,   2,   2},
+   { -1,   0,   0,  -2,   1},
+   {  0,   1,  -2,   2,   0},
+   {  3,   0,   2,   0,   1},
+   { -1,   1,   2,   2,   2},
+   {  1,  -1,   2,   2,   2},
+   {  1,  -1,   0,   0,   1},
+   { -1,   1,   0,   1,   2},
+   { -1,   1,   0,   2,   0},
+   {  1,   1,   0,  -2,   1},
+   { -2,  -1,   0,   2,   0},
+   {  0,   0,   2,   4,   2},
+   {  0,   0,   2,  -1,   2},
+   {  0,  -1,   2,   0,   1},
+   {  0,   0,  -2,   0,   1},
+   {  0,   1,   0,   0,   2},
+   { -1,   0,   0,   1,   1},
+   { -1,  -1,   0,   2,   1},
+   { -2,   0,   0,   4,   0},
+   {  2,   0,  -2,   0,   1},
+   { -1,   0,   0,   4,   0},
+   {  0,   0,   2,  -2,   3},
+   {  0,   0,  -2,   2,   1},
+   {  0,   1,   2,   0,   1},
+   {  0,   0,   4,  -2,   2},
+   {  3,   0,   2,  -2,   2},
+   {  3,   0,   0,   0,   0},
+   {  1,   0,   0,   2,   1},
+   {  2,   0,   2,   2,   2},
+   {  2,   0,   2,  -2,   1},
+   { -1,   0,   4,   0,   2},
+   { -2,   0,   2,   4,   2},
+   {  1,   1,   2,  -2,   2},
+   { -1,   0,   0,   0,   2},
+   { -2,   0,   2,   2,   2},
+   {  1,   0,   2,   2,   1},
+   {  0,  -2,   2,  -2,   1},
+   { -1,   1,   0,   1,   1},
+   { -1,   0,   2,   4,   2},
+   {  0,   0,   2,   1,   2},
+   { -1,   0,   0,   1,   0},
+   {  1,   0,   0,   0,   2},
+   { -1,   0,   2,  -2,   1},
+   {  1,   0,   2,   0,   0},
+   {  1,   1,   0,   0,   0},
+   { -1,   1,   0,   1,   0},
+   {  2,   0,   0,   0,   1},
+   {  1,   1,   2,   0,   2},
+   { -2,   0,   0,   0,   1},
+   {  0,  -1,   2,   2,   2},
+   { -1,   0,   2,   0,   0},
+   { -1,  -1,   2,   2,   2},
+   {  0,   0,   0,   1,   0},
+   {  1,  -1,   2,   0,   2},
+   {  0,  -1,   0,   2,   0},
+   {  3,   0,   2,   0,   2},
+   { -2,   0,   2,   0,   2},
+   {  1,  -1,   0,   0,   0},
+   {  0,   1,   2,  -2,   1},
+   {  1,   0,   0,   2,   0},
+   {  2,   0,   0,  -2,   1},
+   { -1,  -1,   0,   2,   0},
+   {  0,   0,   0,  -2,   1},
+   {  0,  -1,   2,  -2,   1},
+   {  2,   0,   2,   0,   1},
+   { -2,   0,   0,   2,   1},
+   {  2,   0,   2,  -2,   2},
+   {  1,   0,   2,  -2,   1},
+   {  0,   0,   0,   2,   1},
+   {  0,  -1,   2,   0,   2},
+   {  0,   0,   2,   2,   1},
+   {  0,   1,   2,   0,   2},
+   { -2,   0,   2,   0,   0},
+   {  1,   0,   2,   2,   2},
+   {  0,   2,   0,   0,   0},
+   { -1,   0,   2,   2,   1},
+   {  0,  -1,   0,   0,   1},
+   {  1,   0,   0,  -2,   1},
+   {  0,   0,  -2,   2,   0},
+   {  0,   2,   2,  -2,   2},
+   { -1,   0,   0,   2,   1},
+   {  0,   1,   0,   0,   1},
+   {  0,   0,   2,   0,   0},
+   {  2,   0,   0,   0,   0},
+   { -1,   0,   2,   0,   1},
+   {  1,   0,   2,  -2,   2},
+   {  2,   0,   2,   0,   2},
+   { -2,   0,   0,   2,   0},
+   {  0,  -2,   2,  -2,   2},
+   {  0,   0,   2,   2,   2},
+   {  0,   0,   0,   2,   0},
+   { -2,   0,   2,   0,   1},
+   {  1,   0,   2,   0,   1},
+   { -1,   0,   2,   2,   2},
+   { -1,   0,   0,   0,   1},
+   {  1,   0,   0,   0,   1},
+   { -1,   0,   0,   2,   0},
+   { -1,   0,   2,   0,   2},
+   {  0,   0,   2,  -2,   1},
+   {  0,  -1,   2,  -2,   2},
+   {  1,   0,   2,   0,   2},
+   {  0,   0,   2,   0,   1},
+   {  1,   0,   0,   0,   0},
+   {  0,   1,   2,  -2,   2},
+   {  0,   1,   0,   0,   0},
+   {  0,   0,   0,   0,   2},
+   {  0,   0,   2,   0,   2},
+   {  0,   0,   2,  -2,   2},
+   {  0,   0,   0,   0,   1}
+};
+const int terse_alternate_nut_ls_sp[NUT_LS_N] = {
+   -3, -3, -3, 3, 4, -3, -4, -4,
+   5, 3, 4, -6, 5, 11, 4, 7,
+   7, -4, 10, -4, -6, -6, 5, -5,
+   4, 7, 3, -6, 6, 6, 4, -6,
+   4, 5, 6, 4, -4, 3, 12, -3,
+   -3, -5, -3, 3, 3, 5, -3, 6,
+   -7, 0, -3, 3, 3, -4, -3, 4,
+   -12, 3, 6, -4, 4, 4, 5, -11,
+   5, -3, -4, 13, 5, -7, -5, -6,
+   -3, 5, 4, 7, 4, 3, -13, 5,
+   0, 0, -4, 6, 4, -4, -4, -5,
+   5, 6, 6, -6, 6, 3, -4, -7,
+   -8, -4, -6, 11, 3, 8, -4, 3,
+   -3, 11, -4, 8, -7, 5, 3, -3,
+   5, -7, 3, 0, 4, -1, -3, 11,
+   3, 11, 0, -6, 4, -4, 7, -4,
+   -3, -7, 5, 9, 6, -5, -4, -3,
+   -3, 5, 5, 4, -4, -7, 0, 0,
+   0, 10, 3, 10, -7, -13, -5, -4,
+   -3, -3, 9, -7, -3, 3, 6, -3,
+   3, 3, -3, 3, 8, 3, -4, -4,
+   9, -4, -3, 4, 4, 9, 4, -5,
+   3, 4, -3, 3, 5, -3, -7, 3,
+   -5, 6, 9, -8, 5, -5, 5, -5,
+   4, -4, 7, -3, 0, -3, -4, -7,
+   -3, 3, 4, 0, 7, -7, 3, -5,
+   3, 5, -12, -7, 5, 6, 4, 0,
+   0, 3, 3, 3, -5, -3, 3, 5,
+   0, 4, -3, 0, 0, 5, 0, -4,
+   0, 0, -15, -13, -23, -24, -12, -24,
+   17, -16, -16, 10, 24, 30, -8, -12,
+   16, -23, -10, 16, 18, -8, -9, -9,
+   9, 19, 16, 27, -22, -19, -16, 23,
+   21, -10, -19, -8, 12, -23, 15, -18,
+   22, -25, 29, 12, 23, 15, 28, -22,
+   -15, 10, -10, -12, -17, 13, -14, -13,
+   25, -12, 14, 8, 15, -17, -20, -20,
+   -10, 22, 12, -19, -29, 9, -15, -21,
+   10, -10, 8, -26, -19, 9, -35, -18,
+   13, -11, 15, -12, 17, 13, -18, 9,
+   -20, -34, 19, 14, 0, -14, -17, -13,
+   20, 22, 16, 9, -17, -10, -18, 29,
+   -16, -31, -38, 18, 24, 14, 11, 24,
+   -14, -22, 17, 28, -20, -15, -29, -21,
+   -12, -9, -36, -10, -34, -21, -11, 30,
+   -27, -29, -32, 26, -43, 23, 32, 49,
+   31, 37, -31, -32, -30, 37, 32, 47,
+   65, 32, 35, 32, -37, -35, -36, 36,
+   47, -27, 35, -60, 26, 44, -36, -51,
+   28, -44, 45, -32, 28, -29, 31, 38,
+   27, 48, -60, -33, -38, 28, -61, -33,
+   -44, -45, 53, 47, 81, 82, -53, 46,
+   39, -42, -51, -42, 41, -40, 51, 45,
+   -39, -74, 49, 85, -75, 88, 56, 45,
+   -48, 47, -45, -43, -38, -63, 64, 94,
+   57, -69, -103, 74, 63, -103, 115, -73,
+   -63, 62, 71, -61, 68, -94, -92, -92,
+   84, -77, 91, 83, 84, -83, -79, 128,
+   -91, 83, -83, -93, 94, 2, -77, -78,
+   82, 82, 92, -100, -110, -104, 151, 96,
+   161, 87, -100, -94, -102, 113, -114, -129,
+   -106, -113, 101, 120, -102, -105, -134, -121,
+   144, -118, 123, 213, 159, -132, 147, 141,
+   -159, 175, 91, -228, -163, -174, -154, -156,
+   -153, 276, -219, 186, -286, 276, -188, -192,
+   197, -187, -325, 335, -208, 199, 208, 243,
+   -245, 252, 375, -259, 231, -229, 416, 245,
+   253, -263, 309, 280, 337, 494, 493, -334,
+   -301, 321, 357, -335, 565, -396, -578, 588,
+   360, -361, 412, 639, -390, -438, 658, -673,
+   463, -421, -468, -488, -446, 766, -453, 591,
+   -467, 535, -492, -875, -502, 570, -590, 528,
+   -595, -949, -585, -1014, -694, -704, -667, -666,
+   715, 1020, 742, 1282, 716, 1338, 1248, 834,
+   815, 922, 934, 1575, -970, -1100, 1019, 1146,
+   -1214, 1290, 1405, 1383, -1331, -1283, 1314, -1521,
+   1660, 4026, -1981, -1987, 3339, -3389, 3276, 2179,
+   2481, -2294, -2647, -4056, -2819, -4230, -2878, 4348,
+   -2904, -3075, 4725, 3579, 6579, 4065, 7350, -4940,
+   -4752, -5350, -5774, 6443, 5800, -6302, -7141, -6637,
+   7566, -11024, -7691, 16707, -10204, -12654, -12873, 21783,
+   -15794, 15164, -14053, 25887, 29243, 20441, 28593, -31046,
+   -47722, 32481, -38571, 63384, 45893, -51613, -59641, -57976,
+   63110, 156994, 123457, 128227, 215829, -301461, -387298, 711159,
+   -516821, 1475877, 2074554, -2276413, -13170906, -172064161
+};
+const int terse_alternate_nut_ls_spt[NUT_LS_N] = {
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, -11, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, -11,
+   -11, 0, -11, 0, 10, -11, 21, -11,
+   -21, 0, 0, -85, 0, 11, -10, 0,
+   72, 10, -25, 0, 0, 21, 0, -1,
+   0, 0, -1, 11, 50, -42, -11, -63,
+   63, 10, 11, 137, -494, -36, -367, 73,
+   1226, -3633, 207, -234, -1675, -174666
+};
+const int terse_alternate_nut_ls_cp[NUT_LS_N] = {
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, -5, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   -10, -26, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 6, -13, 0, 3, 0, 0,
+   0, 0, -3, -3, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 75, -162,
+   30, 13, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, -12, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   5, 0, 0, 0, 0, 0, 0, 0,
+   330, 0, 0, -1044, 364, 0, 5, 0,
+   -63, -1988, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, -1, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, -3, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, -3, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 1, 1,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 10, 0, 0, 0, 0, 0,
+   0, 0, -5, 1, 0, 0, -1, 0,
+   0, 0, -1, 0, 0, -1, 0, 1,
+   0, 0, 0, 0, 0, 0, 1, 1,
+   -1, -1, 0, 0, -28, 0, 0, 0,
+   0, 0, -4, 0, 2, 1, 1, 0,
+   -1, 0, 0, -1, 1, 0, 0, 2,
+   -1, 0, 1, -2, 1, 0, 1, -1,
+   1, 0, -1, 2, 0, 0, -2, 0,
+   1, 2, 1, -1, -1, -2, -2, 0,
+   -1, 1, 1, -1, -1, 0, 1, -3,
+   -1, 0, -2, -2, 0, 0, 0, 2,
+   0, 1, 0, 2, 2, 1, -1, 0,
+   1, -2, -3, 1, 3, -2, 4, 0,
+   0, 1, -2, -1, 5, 0, 1, -3,
+   -4, -25, 1, -3, -2, -5, 0, 2,
+   -1, -1, -3, -6, 2, 9, -1, -3,
+   5, 0, 4, -2, 8, 0, 0, 9,
+   -5, -353, 0, -6, -13, 5, 1, -2,
+   -7, -10, 11, 5, 7, 5, 8, -10,
+   15, -2, -6, 5, -24, 6, -8, -21,
+   -3, 21, -15, -7, 2, 2, 8, 25,
+   -11, -14, 44, -10, 25, 63, -37, 13,
+   -16, 11, 79, -66, -74, 10, -1, 131,
+   -18, 0, 158, -150, 31, 129, 149, -189,
+   27, -168, 19, 181, 111, 816, 380, -872,
+   -524, 11817, -698, 2796, -13696, 33386
+};
+const int terse_alternate_nut_ls_ce[NUT_LS_N] = {
+   2, 1, 1, -1, -2, 2, 2, 2,
+   -2, -2, -2, 2, -2, 0, 0, -3,
+   0, 2, 0, 2, 3, 3, 0, 2,
+   -2, -4, -2, 3, 0, -3, -2, 3,
+   -2, -3, 0, 0, 2, -1, 0, 2,
+   2, 3, 1, 0, -1, -3, 0, -3,
+   4, 0, 1, -1, 0, 0, 0, 0,
+   0, -2, -3, 2, -2, 0, -2, 0,
+   -2, 0, 2, 0, -2, 3, 2, 2,
+   2, 0, 0, -3, -2, -2, 0, -3,
+   0, 0, 2, -3, 0, 2, 0, 2,
+   -2, -1, 0, 3, -3, -1, 2, 3,
+   4, 2, 3, 0, -1, -4, 2, -1,
+   1, 0, 2, -3, 3, -3, 0, 1,
+   -3, 0, 0, 0, -2, 3, 2, 0,
+   -1, 0, 0, 3, 0, 0, 0, 2,
+   1, 0, 0, 0, 0, 2, 2, 2,
+   0, -3, -2, -2, 2, 4, 0, 0,
+   0, 6, -1, 0, 0, 0, 3, 0,
+   0, 2, 0, 0, 1, 0, -3, 1,
+   -1, -1, 2, 0, 0, -2, 0, 0,
+   -3, 2, 2, -2, 0, -3, -2, 2,
+   -1, -2, 2, 0, 0, 1, 0, 0,
+   2, -3, 0, 3, -2, 2, 0, 3,
+   -2, 2, -3, 1, 0, 1, 2, 3,
+   2, -2, -2, 0, -4, 3, 0, 0,
+   -1, -3, 0, 0, -2, 0, -2, 1,
+   0, 0, 0, -1, 2, 1, -2, -2,
+   0, -2, 1, 0, 0, -3, 0, 0,
+   0, 0, 7, 5, 9, 11, 5, 10,
+   -7, 7, 7, -4, -10, -2, 4, 6,
+   -1, 9, 4, -1, -9, 4, 4, 4,
+   -4, -8, -8, -1, 10, 9, 8, -1,
+   -9, 4, 0, 4, -5, 0, 3, 0,
+   0, 1, -1, -5, -10, -7, -1, 0,
+   0, -6, 5, 6, 9, -5, 8, 6,
+   0, 6, 0, -4, -3, 7, 0, 11,
+   5, -9, -5, 10, 0, -5, 0, 9,
+   -6, 4, -4, 11, 10, -4, 0, 0,
+   -5, 3, -8, 5, 0, -6, 7, -5,
+   8, 0, -10, 0, -7, 8, 9, 6,
+   0, -12, -6, -4, 10, 5, 10, 0,
+   8, 0, 0, -8, 0, -6, -6, -11,
+   7, 12, 0, 0, 0, 3, -1, 5,
+   5, 4, 0, 6, 15, 10, 5, 0,
+   12, 14, 14, -11, 18, -12, -13, -2,
+   -13, -16, 13, 16, 15, -16, -16, -1,
+   -2, -13, -14, -16, 19, 19, 20, -15,
+   -1, 11, -18, 2, -14, -19, 20, 0,
+   -15, 19, -8, 15, -15, 15, -13, -20,
+   -14, -10, 0, 21, 19, -15, 1, 16,
+   -2, 22, -23, -19, -4, -4, 22, -18,
+   -21, 22, 22, 24, -21, 21, -22, -20,
+   21, -1, -26, 0, 0, 2, -25, -26,
+   25, -24, 23, 24, 20, 26, -33, -4,
+   -29, 30, 3, -32, -28, 2, -2, 32,
+   33, -34, -31, 32, -36, 0, 39, 39,
+   -43, 39, -39, -43, -44, 47, 34, -1,
+   39, -36, 40, 40, -40, 54, 43, 41,
+   -45, -45, 12, 50, 48, 44, -5, -50,
+   -1, -47, 56, 51, 44, -49, 57, 55,
+   61, 59, -54, -52, 56, 57, 56, 60,
+   -61, 66, -64, -4, -54, 69, -75, -72,
+   69, -75, -54, 1, 69, 75, 78, 81,
+   84, 2, 43, -79, 6, -2, 83, 94,
+   -100, 96, 7, -14, 105, -102, -112, -104,
+   104, -108, -8, 109, -120, 128, -17, -128,
+   -138, 131, -134, -144, -143, -19, -15, 144,
+   162, -174, -154, 184, -6, 171, 5, -24,
+   -185, 189, -176, -19, 205, 188, -2, 14,
+   -200, 216, 201, 207, 225, 9, 244, -253,
+   240, -228, 275, 29, 250, -244, 252, -279,
+   258, 8, 316, 4, 294, 304, 346, 369,
+   -326, -495, -391, -23, -389, -39, -170, -440,
+   -422, -395, -399, -50, 496, 465, -527, -490,
+   518, -556, -610, -594, 663, 672, -700, 647,
+   -710, -553, 854, 1073, -107, 35, -9, -1129,
+   -1062, 1266, 1129, 40, 1207, -20, 1232, -81,
+   1233, 1313, -41, -1900, -199, -2206, -51, 2720,
+   2719, 2695, 3041, -2768, -3045, 3272, 3070, 3353,
+   -3250, 104, 3268, 168, 5222, 6415, 6953, -167,
+   6850, -8001, 8551, -550, -609, -10758, -12338, 13238,
+   477, -13870, 16452, -1220, -24236, 26366, 25543, 31429,
+   -33228, -1235, -53311, -68982, -95929, 129025, 200728, -6750,
+   224386, 73871, -897492, 978459, 5730336, 92052331
+};
+const int terse_alternate_nut_ls_cet[NUT_LS_N] = {
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, -1, 0, 0, 0, 0,
+   -42, 0, -2, 0, 0, 0, 10, -11,
+   0, 0, -11, 0, -10, 0, -11, 0,
+   0, 0, 32, -9, 299, -63, 18, 0,
+   -677, -184, 470, -485, -3015, 9086
+};
+const int terse_alternate_nut_ls_se[NUT_LS_N] = {
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, -2, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   -5, -11, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, -11, 0, -1, 0, 0,
+   0, 0, -2, 1, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, -138,
+   14, -5, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, -10, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, -891, 176, 0, 4, 0,
+   -27, -1679, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, -2, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, -1, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, -1, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, -2, 0, 0, 0, 0, 0,
+   0, 0, -2, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 1, 0,
+   0, 0, 0, 0, 11, 0, 0, 0,
+   0, 0, -2, 0, 1, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 1,
+   0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 1, 0, 0, 0, 0,
+   0, 1, 0, 0, -1, 0, 0, 0,
+   0, 0, 0, -1, 0, 0, 0, 0,
+   -1, 0, -1, 0, 0, 0, 0, 0,
+   0, 1, 0, 1, 1, 0, -1, 0,
+   1, -1, -1, 0, 2, -1, 2, 0,
+   0, -1, -1, -1, 2, 0, 1, -1,
+   2, -10, 0, 1, -1, 0, 1, 1,
+   -1, -1, -1, 0, 1, 4, -1, -1,
+   2, 0, 2, -2, 4, 0, 0, 4,
+   -2, -139, 0, -2, 1, -2, 0, -2,
+   -3, -4, 5, -2, 3, -2, 4, 2,
+   7, -1, 3, 1, 2, 1, 4, -9,
+   -3, 12, -5, -4, -1, 4, 4, 14,
+   -5, 2, 19, 10, 15, 26, -14, 13,
+   -5, -1, -45, 11, 13, -3, -3, 59,
+   -25, 0, 68, 29, 20, 78, 66, -75,
+   -9, 82, -4, 39, 132, 367, 318, 358,
+   -174, -1924, -291, 1374, -4587, 15377
+};
+
+/* Planetary nutation: multipliers of l, F, D, Om, Me, Ve, E, Ma, J, Sa, U, Ne, pA, then the amplitudes (0.1 microarcsec). */
+const signed char terse_alternate_nut_pl_mult[NUT_PL_N][13] = {
+   {  0,   2,   2,   2,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  1,   2,   0,   2,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   { -1,   2,   2,   2,   0,   3,  -3,   0,   0,   0,   0,   0,   0},
+   { -1,   2,   2,   2,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  2,   2,   0,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  1,   1,   1,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  1,   2,   0,   2,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  1,   2,   0,   2,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  2,   2,   0,   2,   0,   0,   2,   0,  -3,   0,   0,   0,   0},
+   { -1,   2,   2,   2,   0,   0,   2,   0,  -3,   0,   0,   0,   0},
+   {  1,   2,   0,   2,   0,  -1,   1,   0,   0,   0,   0,   0,   0},
+   { -1,   2,   2,   2,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,   2,  -3,   0,   0,   0,   0,   0,   0},
+   { -2,   2,   2,   2,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   { -1,   2,   0,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   1,   1,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  1,   2,   0,   1,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  2,   2,  -2,   2,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   { -1,   2,   0,   2,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  1,   2,   0,   2,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   1,   1,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   { -1,   2,   0,   2,   0,  10,  -3,   0,   0,   0,   0,   0,   0},
+   {  1,   2,   0,   2,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   1,   1,   2,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,  -2,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,  -1,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   2,   0,   2,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,  -2,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,  -2,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  1,   2,  -2,   2,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  1,   2,  -2,   2,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  1,   0,  -2,   1,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   { -1,   0,   2,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0},
+   { -1,   0,   2,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   { -1,   0,   2,   1,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   { -1,   0,   0,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  1,   1,  -1,   1,   0,   0,  -1,   0,   0,   0,   0,   0,   0},
+   { -1,   1,  -1,   1,   0,   0,  -1,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   { -2,   0,   0,   0,   0,   0,   2,   0,  -3,   0,   0,   0,   0},
+   { -1,   0,   2,   0,   0,   0,   2,   0,  -3,   0,   0,   0,   0},
+   {  1,  -1,   1,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   { -1,   0,   2,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   { -1,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   { -1,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   { -1,   0,   0,   0,   0,   0,   2,   0,  -3,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  1,   0,  -2,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   { -1,   0,   2,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   { -1,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   { -1,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0},
+   {  1,   0,  -2,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  1,   0,  -2,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  1,   0,  -2,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  1,   0,  -2,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   6,  -4,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   9,  -9,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -9,   9,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -9,   9,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -9,   9,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   8,  -8,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -8,   8,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   5,   0,  -2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   5,   0,  -3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   5,   0,  -4,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   4,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   4,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   4,  -2,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   4,  -2,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   7,  -7,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -7,   7,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   2,   1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   2,   1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   2,   1,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   5,  -4,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   8,  -9,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -2,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,   0,   0,  -2,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,   0,  -1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,  -4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,   0,  -2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   6,  -6,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   6,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -6,   6,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   4,   0,  -3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,   0,  -4,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -9,  11,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -9,  11,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   1,   2,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   4,  -3,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   7,  -8,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,  -5,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   7,  -7,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   7,  -7,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -5,   5,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -3,   8,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,   0,   1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   2,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -8,  10,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -8,  10,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -8,  10,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -1,   8,  -3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -5,  16,  -4,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   7,  -8,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,   0,   2,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -8,  16,   0,   0,   0,   0,   0,   2},
+   {  0,   2,  -2,   1,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,   0,   0,  -1,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,  -2,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,   0,   0,  -2,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,   0,  -1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,   0,  -1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   3,  -2,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   3,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,   0,  -2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,  -6,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   6,  -7,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -6,   7,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -2,   6,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,   0,  -3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,   0,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   7,  -8,   0,   0,   0,   0,   2},
+   {  0,   2,  -2,   1,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,   0,  -4,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -9,  12,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -3,   0,   5,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   1,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -4,   4,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,  -3,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -7,   9,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -7,   9,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -1,   4,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -1,   4,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   6,  -7,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   2,  -1,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   2,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   7,  -9,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -1,   6,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -5,   6,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -5,   6,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -3,   7,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,   2,   0,   0,   0,   0,   2},
+   {  0,   2,  -2,   1,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  0,   1,  -1,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   3,  -3,   0,   2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,   1,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  11,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -8,  11,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -8,  11,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -8,  11,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   3,  -5,   4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,  -2,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   6,  -8,   1,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -2,   8,  -3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -2,   8,  -3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -6,  16,  -4,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,  -8,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -2,   8,  -1,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   2,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -3,   9,  -4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -8,  15,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -6,  15,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,  -1,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,  -2,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,  -2,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,  -2,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -5,  13,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,  -3,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -3,   3,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -5,  10,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -3,   9,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   1,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   6,  -8,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -6,   8,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -6,   8,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -2,   5,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -2,   5,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   2,   0,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -2,   7,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,  -4,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -2,   0,   4,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -1,   5,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -9,  13,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -2,   0,   5,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -4,   8,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -7,  10,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -7,  10,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -1,   3,   0,   0,   0,   0,   0,   2},
+   {  0,   1,  -1,   1,   0,  -1,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -1,   3,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -5,   7,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,  -2,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -2,   2,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -6,   9,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   1,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -2,   6,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,  -1,   0,   3,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,  -5,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -5,   7,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -5,   7,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -1,   4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -3,   6,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -3,   6,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   1,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   1,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,  -5,   5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   0,   2,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   1,  -2,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -8,  12,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -8,  12,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,   0,  -2,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -3,   8,  -3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   5,  -8,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   5,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   2,  -5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -8,  14,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   1,   0,   0,  -2,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   0,  -2,   0,   0,   0},
+   {  0,   0,   0,   1,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,  -3,   5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -1,   0,   1,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   1,  -5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   0,  -3,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   2,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -3,   4,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -3,   4,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -5,   9,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   1,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -1,   0,   2,   0,   0,   0,   2},
+   {  0,   0,   0,   1,   0,   3,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   4,  -6,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -4,   6,   0,   0,   0,   0,   2},
+   {  0,   2,  -2,   1,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   1,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -6,   9,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -6,   9,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -2,   4,   0,   0,   0,   0,   0,   2},
+   {  0,   1,  -1,   1,   0,  -2,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -2,   4,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -1,   0,   3,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,  -1,   0,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   5,  -8,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -5,   8,   0,   0,   0,   0,   2},
+   { -2,   0,   2,   0,   0,   4,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -3,   7,   0,   0,   0,   0,   2},
+   {  0,   2,  -2,   1,   0,   0,  -3,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   1,   0,  -1,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,  -4,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -1,   0,   4,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -2,   5,   0,   0,   0,   0,   2},
+   {  0,   1,  -1,   1,   0,   1,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,  -1,   0,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -1,   1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -1,   1,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -7,  12,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -1,   3,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -1,   0,   5,   0,   0,   0,   2},
+   {  0,   0,   0,   1,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   4,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -4,   6,   0,   0,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,  -4,   5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -4,   6,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -4,   6,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -4,   7,   0,   0,   0,   0,   0,   2},
+   {  0,   1,  -1,   1,   0,  -4,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -4,   7,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,  -4,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0},
+   {  0,  -2,   2,   0,   0,   4,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -7,  11,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -7,  11,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -1,   2,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -1,   2,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   1,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -3,   5,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,  -3,   5,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   2},
+   {  0,   0,   0,   1,   0,  -1,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -5,  10,   0,   0,   0,   0,   2},
+   {  0,   2,  -2,   1,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,  -2,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   4,  -7,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -4,   7,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,  -4,   7,   0,   0,   0,   0,   2},
+   {  0,  -2,   2,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -4,   8,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -2,   3,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -2,   3,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -6,  10,   0,   0,   0,   0,   0,   1},
+   {  0,  -2,   2,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0},
+   { -2,   1,   1,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   0,   1,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -9,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -5,   9,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,  -5,   9,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   1,   0,   2,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -3,   6,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -3,   6,   0,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -4,   6,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -3,   6,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,  -5,   7,   0,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,   0,  -4,   4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   2,  -4,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   3,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   3,  -5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   2},
+   {  0,   2,  -2,   2,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   2},
+   {  0,   2,  -2,   1,   0,   0,  -7,   9,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   2,   0,   0,  -2,   0,   0,   0},
+   {  2,   0,  -2,   1,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,  -1,   0,   4,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   6, -11,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -6,  11,   0,   0,   0,   0,   2},
+   {  0,   2,  -2,   1,   0,   0,  -2,   0,   1,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   0,   0,  -1,   0,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,   0,  -1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   5,  -8,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -5,   8,   0,   0,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,  -5,   7,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -5,   8,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -5,   8,   0,   0,   0,   0,   0,   2},
+   {  0,   2,  -2,   2,   0,  -5,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -5,   8,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -2,   4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -2,   4,   0,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -3,   4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -2,   4,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,   1,  -4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,  -3,   5,   0,   0,   0,   0,   0,   2},
+   {  0,   2,  -2,   2,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -3,   5,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -3,   5,   0,   0,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   3,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,   0,  -2,   0,   0,   2,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   0,   1,   0,   0,  -2,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   1,  -2,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,   0,   0,  -2,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  2,   0,  -2,   1,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   2,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   2,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   0,   3,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,  -1,   0,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,   0,  -8,  11,   0,   0,   0,   0,   0},
+   {  2,   0,  -2,   1,   0,   0,  -5,   6,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   7, -13,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -7,  13,   0,   0,   0,   0,   2},
+   {  0,  -1,   1,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   0,   0,   0,  -1,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,   0,  -1,   0,   0,  -1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0},
+   {  1,   0,  -1,   1,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   { -2,   0,   2,   1,   0,   0,   6,  -8,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   1,   0,   0,   2,   0,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,  -8,  15,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   1,   0,   6,  -8,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   5,  -8,   0,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   5,  -7,   0,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,  -5,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,  -2,   4,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,  -3,   5,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   0,   2,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   0,  -2,   0,   0,   0},
+   { -1,   0,   1,   1,   0,   0,   3,  -4,   0,   0,   0,   0,   0},
+   { -1,   0,   1,   1,   0,   3,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -1,   2,   0,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -2,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,   0,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   1,   0,  -8,  13,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,  -8,  12,   0,   0,   0,   0,   0,   0},
+   { -2,   1,   1,   1,   0,   0,   1,   0,  -2,   0,   0,   0,   0},
+   {  1,   0,   0,   1,   0, -18,  16,   0,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,  -3,   7,  -4,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   2,   0,   0,  -5,   0,   0,   0},
+   {  2,  -1,  -1,   1,   0,   0,   3,  -7,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   0,   1,   0,   2,  -5,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   0,   0,   2,  -5,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   { -1,   0,   0,   1,   0,  10,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,   0,  -2,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,   1,   0, -10,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   0,   0,  -2,   5,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,   0,  -1,   0,  -2,   5,   0,   0,   0},
+   { -2,   1,   1,   1,   0,   0,  -3,   7,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   3,  -7,   4,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,  -1,   1,   0,   0,   0},
+   { -1,   0,   0,   1,   0,  18, -16,   0,   0,   0,   0,   0,   0},
+   { -1,   0,   1,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,  -8,  11,   0,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   8, -12,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   8, -13,   0,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   1,   0,   3,  -3,   0,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   1,   0,   0,   2,   0,  -3,   1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   3,  -5,   0,   2,   0,   0,   0,   0},
+   {  0,  -2,   2,   0,   1,   0,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   1,   0,   0,   0,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   2,   0,   0,  -1,   2,   0,   0,   0,   0,   0},
+   {  1,   0,  -1,   1,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  1,   0,  -1,   1,   0,   0,  -3,   4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -9,  17,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   9, -17,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   7, -13,   0,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,   0,  -9,  13,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   0,   1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   0,  -1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,  -1,   0,   0,   1},
+   {  0,  -2,   2,   1,   0,   5,  -6,   0,   0,   0,   0,   0,   0},
+   {  2,   0,  -2,   1,   0,  -6,   8,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,  -2,   4,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   0,   0,   1,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   0,   1,   0,   1,   0,   0,   0,   0},
+   {  0,   2,  -2,   1,   0,   0, -10,  15,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   8, -15,   0,   0,   0,   0,   0},
+   {  1,   0,  -2,   0,   0,  20, -21,   0,   0,   0,   0,   0,   0},
+   { -1,   1,   1,   1,   0, -20,  20,   0,   0,   0,   0,   0,   0},
+   { -1,   0,   1,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   2,   0,  -1,  -5,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   6,  -8,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   2,   0,  -3,   0,   0,   0,   0},
+   { -2,   1,   1,   1,   0,   0,   1,   0,  -3,   0,   0,   0,   0},
+   { -2,   1,   1,   0,   0,   0,   1,   0,  -3,   0,   0,   0,   0},
+   {  2,   0,  -2,   1,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  2,   0,  -2,   1,   0,   0,  -6,   8,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   2,   0,  -5,   5,   0,   0,   0},
+   {  2,   0,  -2,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0},
+   {  1,  -1,  -1,   0,   0,   0,   8, -15,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   8, -15,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,  -9,  15,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,  -8,  15,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,  -8,  15,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   0,   0,   2,   0,   0},
+   {  0,  -1,   1,   1,   0,   0,   1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   2,   0,   0,   0,   0,   1,   0,   0,   0,   0},
+   {  2,   1,  -3,   1,   0,  -6,   7,   0,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   6,  -8,   0,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   1,   0,   5,  -7,   0,   0,   0,   0,   0,   0},
+   {  0,  -2,   2,   0,   0,   5,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   0,   1,   0,   0,   1,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,   0,   0,   0,   1,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,   0,  -1,   0,   0,   1,   0,   0,   0},
+   {  0,  -2,   2,   0,   0,   0,   9, -13,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   1,   0,   0,   5,  -6,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   1,  -3,   0,   0,   0},
+   {  1,   0,  -2,   0,   0,  17, -16,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,  -1,   2,   0,   0,   0},
+   {  0,   0,   0,   2,   0,  -3,   5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,  -9,  17,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,   0,  -1,   0,   0,   2,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   0,   1,   0,   0,   2,   0,   0,   0},
+   { -1,   0,   1,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   1},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   0,   0,   0,   2,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   0,   0,  -1,   0,   0},
+   { -2,   2,   0,   2,   0,   0,  -5,   9,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   2,   0,  -2,  -2,   0,   0,   0},
+   { -1,   0,   1,   0,   0,   3,  -4,   0,   0,   0,   0,   0,   0},
+   { -1,   1,   0,   1,   0,   3,  -5,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   2,   0,   0,  -2,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   0,  -1,   2,   0,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   2,   0,  -4,   3,   0,   0,   0},
+   {  0,   0,   0,   1,   0,   3,  -5,   0,   2,   0,   0,   0,   0},
+   { -2,   0,   2,   0,   0,   0,   2,   0,  -3,   1,   0,   0,   0},
+   { -2,   0,   2,   2,   0,   3,  -3,   0,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   1,   0,   0,   2,   0,  -4,   5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   8, -13,   0,   0,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   8, -14,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   8, -13,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,  -8,  12,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -8,  13,   0,   0,   0,   0,   0,   1},
+   {  0,   2,  -2,   2,   0,  -8,  11,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,  -8,  13,   0,   0,   0,   0,   0,   2},
+   { -1,   0,   1,   1,   0,   0,   2,  -2,   0,   0,   0,   0,   0},
+   { -1,   1,  -1,   1,   0,  18, -17,   0,   0,   0,   0,   0,   0},
+   { -2,   1,   1,   2,   0,   0,   1,   0,  -2,   0,   0,   0,   0},
+   { -1,   0,   0,   0,   0,  18, -16,   0,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   1,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  0,  -1,   1,   0,   0,   0,   1,   0,   1,  -1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   3,  -7,   4,   0,   0,   0,   0,   0},
+   { -2,   0,   2,   1,   0,   0,   2,   0,   0,  -5,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,  -4,  10,   0,   0,   0},
+   {  1,   0,  -1,   1,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   2,  -4,   0,  -3,   0,   0,   0,   0},
+   {  1,   0,  -2,   0,   0,  19, -21,   3,   0,   0,   0,   0,   0},
+   {  2,  -1,  -1,   0,   0,   0,   3,  -7,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,  -2,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,  -2,   5,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,  -2,   5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,  -1,   0,   2,  -5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,  -5,   6,   4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,  -8,   1,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -4,   8,  -3,   0,   0,   0,   1},
+   {  0,   1,  -1,   1,   0,   0,  -5,   8,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,  -2,   6,  -3,   0,   2},
+   { -1,   0,   0,   0,   0,  10,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   1,  -1,   1,   0,   0,   3,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,  -4,   8,  -1,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  -1,   2,   2},
+   {  0,   0,   0,   0,   0,   0,   8, -16,   4,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,  -8,  16,  -4,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   8, -16,   4,   5,   0,   0,   0}
+};
+const short terse_alternate_nut_pl_sp[NUT_PL_N] = {
+   3, 3, 7, 13, 4, -24, 0, 0, 0, 24,
+   -5, -3, 3, -3, -6, 8, 0, -3, -21, 0,
+   21, 3, -126, 0, 0, 5, -3, -5, 126, 0,
+   -3, 0, -8, 6, 3, 4, 3, 3, -4, -6,
+   -3, 3, -19, -34, 20, -3, 0, 0, 0, 0,
+   21, 13, 0, 4, -5, 4, -3, 5, 0, 0,
+   6, 4, -4, 7, 6, -3, 3, 5, 0, 6,
+   6, 0, 8, 0, 2, 0, 13, 0, 0, 0,
+   14, 0, 19, 0, 17, 3, -9, -3, 0, 0,
+   8, 0, 28, 0, 0, 0, 19, 0, 0, 3,
+   0, -7, -3, 31, 0, -3, -3, -184, 0, 40,
+   3, -37, -5, 0, 34, 4, 0, -10, 0, -6,
+   0, 0, 370, 4, -3, -8, 0, 59, 4, 0,
+   -5, -4, 0, 0, 50, -22, 0, -3, -25, 5,
+   -6, -4, 29, 143, 0, 517, 0, 0, 0, 30,
+   67, -4, 6, 0, 3, -8, 9, 18, 0, 3,
+   5, 0, -339, 5, -4, 3, 3, 11, 0, 83,
+   6, 19, 26, -3, 74, 3, -3, 7, 0, 5,
+   6, 0, 0, 3, 3, 0, 3, 0, -21, -63,
+   163, -85, 0, 0, 0, -3, 0, -11, -62, 3,
+   0, -13, 12, 0, -123, 0, 0, -89, 0, 0,
+   7, -5, 0, 123, 0, -11, 14, 61, 11, 0,
+   80, 0, 0, 15, -154, 0, 3, 0, 54, 3,
+   89, 8, 18, 8, -3, -6, -4, 393, 0, 3,
+   0, -3, -3, -5, 117, 0, -4, 83, 0, 11,
+   17, -5, -3, -5, -4, -18, 5, -13, 0, 5,
+   0, -3, 27, 4, 0, 113, 0, 8, 8, 16,
+   4, 5, 3, -5, -3, -598, 0, 12, 0, 3,
+   6, -3, -35, 1, 0, 5, 16, 0, -8, 202,
+   -19, 0, -7, 0, -262, 0, 8, 4, 0, -74,
+   6, -14, -1, -8, -6, 0, -4, -19, 8, -4,
+   -3, 21, -13, -3, 3, 11, -75, -368, -6, 0,
+   3, 0, -1223, 0, -3, -3, 0, 5, 3, -5,
+   7, 0, -78, 10, 15, -166, -5, 0, -16, 6,
+   11, 0, 0, 9, 0, -458, 0, 14, 5, -28,
+   0, 118, 0, 5, -3, 0, 4, 0, 0, -19,
+   -4, 30, -6, 0, -7, 1485, 5, 25, -3, 0,
+   -11, 0, 5, -28, 0, 2, -5, -46, -3, -7,
+   -22, 490, 3, 3, -12, -25, 0, 27, -68, 4,
+   0, -16, -3, -4, 22, -4, -10, -20, 0, 17,
+   -9, 0, 0, 7, 0, 0, 3, 16, 5, -6,
+   3, -127, 0, -3, 6, 3, 8, 18, 30, 5,
+   24, 0, 13, 0, 50, -3, 7, 3, 8, 0,
+   3, -24, -4, 4, -5, 0, -5, 3, -4, 117,
+   0, -8, -6, -5, -1166, 9, -27, 42, -25, 7,
+   0, -3, 16, 5, -4, 9, 0, -3, 0, 4,
+   0, -14, 57, 140, 31, 0, 0, -11, -51, -8,
+   9, -6, -86, 3, 4, 85, -12, -2150, 11, -10,
+   -145, -3, -9, 8, -4, 0, -37, -7, 0, 54,
+   0, 0, -138, 0, 8, -8, -4, -4, 0, 0,
+   3, 10, -4, -4, 0, -3, 52, 0, -6, 6,
+   -91, -13, -50, 0, 4, 0, -53, -5, 11, 0,
+   35, -18, -11, 0, -21, 0, -133, 51, -48, 3,
+   -3, 0, 6, -8, -449, 273, 23, -40, -4, 0,
+   57, -439, -9, -3, 3, -9, -73, -82, -3, -3,
+   3, 84, 76, -3, -5, 10, 0, -68, -5, 0,
+   -14, 46, -5, 3, 10, 0, 8, -5, 0, 4,
+   3, 5, -24, -3, 10, 0, 47, -66, 11, 174,
+   32, 0, -17, 5, 0, 20, -21, -3, 15, 0,
+   5, -53, -3, -15, -349, -3, 0, 89, 3, 0,
+   0, -3, 45, 0, 0, -14, -7, 0, 0, 0,
+   0, 0, 78, -3, -10, -42, 4, -5, -3, -6,
+   0, 0, 0, 0, 3, -3, 11, 0, -16, -6,
+   -9, -17, 0, 0, 0, 4, 0, -3, 0, -460,
+   266, -6, 13, 15, 6, -5, 5, 11, 235, 1200,
+   425, 0, -41, 5, 0, 0, 226, 284, 0, -7,
+   12, 9, -26, 0, 103, 26, 11, -1444, -3084, -491,
+   31, 14, -12, 3, 0, -3, 99, -462, -3, -219,
+   -114, 3, 3, 0, 125, 56, 1440
+};
+const short terse_alternate_nut_pl_cp[NUT_PL_N] = {
+   0, 0, 0, 0, 0, -12, 3, 3, 3, -12,
+   0, 0, 0, 0, 0, 0, 3, 0, -11, -4,
+   -11, 0, -63, 9, 9, 0, 28, 0, -63, -3,
+   0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 10, 0, -5, 5, -5, -5,
+   11, 0, 3, 0, 0, 0, 0, 0, -4, -4,
+   0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+   0, 4, 0, 0, 9, -3, 0, 5, 0, 0,
+   -3, -5, 0, 7, -3, 12, 0, 0, 3, 0,
+   -4, -7, 0, 9, 3, 0, -23, 3, 4, -4,
+   -8, 0, -32, -6, -10, 0, 0, -3, -3, 0,
+   13, -7, 0, 5, 0, 17, 9, 0, 6, 3,
+   3, 0, -8, -15, 0, 0, -4, 0, 17, 4,
+   -11, 4, 3, 7, 0, 12, 4, 0, 0, 12,
+   0, 0, 0, -3, -7, 16, 0, -114, 0, -18,
+   -91, -12, -9, 9, 0, 0, -11, -3, -4, 0,
+   0, -10, 0, -23, 0, 0, 0, -3, -10, 0,
+   24, 0, -14, 12, 0, -4, 0, -12, -7, -173,
+   19, -4, -7, 0, 10, 8, 0, -3, -32, -16,
+   -12, -70, 4, 3, 4, 0, -19, 5, -97, 0,
+   -15, 9, -6, -3, -416, 0, -86, 0, -4, -9,
+   -32, 0, 0, -415, -3, -6, 9, -96, 5, -20,
+   -71, 9, 4, 0, -30, 35, 0, 3, -15, 12,
+   0, 34, -29, 0, 8, 0, 21, 3, -6, 0,
+   -3, 0, 0, 19, 0, -114, 0, 15, -6, 4,
+   0, -9, 0, 6, -28, -10, 0, 0, -3, 0,
+   -4, 0, 0, 0, -24, 0, 3, -31, -3, -6,
+   0, -7, 0, -7, -13, 0, 5, 55, -5, 0,
+   0, -5, -48, 0, -3, 0, -5, 4, 35, 0,
+   -8, -27, 0, -4, 0, 3, 11, 0, -3, 0,
+   0, 0, 0, 0, 0, 5, 0, -11, -27, 0,
+   0, 3, -30, 0, 0, 0, 0, 0, 20, 3,
+   0, 7, -26, -4, 0, 0, 3, 0, 0, 328,
+   0, -5, 45, 0, 0, 269, 0, -4, 23, 0,
+   0, -4, -3, 0, -45, 0, 9, -59, -5, 36,
+   -5, 0, 11, 3, 0, -3, 0, 3, 4, 0,
+   4, -6, -3, 5, -32, 0, 21, 106, 0, 3,
+   0, 3, 0, 0, -3, 1, 0, 14, 13, 28,
+   93, 0, 66, 0, -3, 0, -4, 0, 39, 0,
+   -3, -3, -6, 0, -87, 0, 0, 34, -3, 0,
+   3, 3, -5, 0, 19, 22, 0, 9, 0, -10,
+   5, 21, 6, -9, 17, -3, 614, 0, -3, -11,
+   5, 5, 0, -5, 0, 16, 13, 0, 12, -32,
+   0, -13, 0, 0, 0, 31, 0, 0, 8, 0,
+   -4, 0, 0, 0, 0, 49, -143, 223, 22, 0,
+   3, 0, 0, 3, 10, 6, 11, 0, 4, 15,
+   -6, -39, 11, 27, 6, 7, 12, -268, 0, 12,
+   -13, 9, 153, 0, 0, 0, 0, 0, -49, 40,
+   47, -9, -14, 0, 9, 4, 35, 0, 10, 0,
+   -7, -7, 0, 15, -4, 4, 0, 0, 8, 8,
+   0, 0, 8, 0, 5, 0, 23, 5, -47, 49,
+   248, 52, 194, -4, 0, 3, -9, -3, -3, 5,
+   -7, -436, -21, -3, -6, 4, 0, 114, -110, -4,
+   0, 23, 47, -47, 430, 80, 7, 57, 0, -6,
+   -28, 0, -5, 0, 0, -16, 17, 292, 0, 0,
+   0, 298, 17, 5, -4, -6, 14, -34, 0, 3,
+   7, 66, 0, 0, 0, -3, -3, -4, 29, 3,
+   0, -6, 12, 0, -22, 8, 8, -12, 56, 84,
+   15, 6, -4, 3, 6, -70, -78, 0, -7, -8,
+   0, 0, 0, 22, -62, 7, 3, -16, 5, 3,
+   -3, 0, -22, 19, 8, 8, 0, -5, -8, -4,
+   -3, 3, -18, 0, 233, 20, 24, 0, -5, 4,
+   3, 5, 3, -8, 0, -4, 24, 3, 8, 0,
+   -11, -19, 3, 4, 3, 0, 131, 0, 15, -435,
+   -78, -9, 0, 0, 0, 0, -6, -12, 334, 598,
+   212, 15, 175, 0, -6, -8, 101, 0, 24, 0,
+   0, -27, -29, -13, -60, -9, -24, 2409, 5123, 128,
+   -481, -218, 0, 0, 6, 0, 0, 1604, 0, 89,
+   0, 0, -7, 5, -43, -117, 0
+};
+const short terse_alternate_nut_pl_se[NUT_PL_N] = {
+   0, 0, 0, 0, -1, -5, 2, 1, 1, -5,
+   0, 0, 0, 0, 0, 0, 1, 0, -6, 0,
+   -6, 0, -27, 4, 4, 1, 15, 1, -27, -2,
+   0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 3, -2, 0,
+   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+   0, 2, 0, 0, 4, -2, 0, 3, 0, -1,
+   0, -3, 0, 4, -1, 5, 1, 0, 0, -2,
+   0, -4, 0, 5, 2, 0, -10, 1, 0, 0,
+   -4, 0, -14, 0, -6, 0, 0, -1, -2, 0,
+   7, -3, 0, 3, 0, 7, 4, 0, 0, 1,
+   1, -3, 0, -8, 0, 0, -2, 0, 9, 2,
+   -5, 2, 1, 4, 0, 5, 2, 0, 0, 5,
+   0, 0, 0, -1, -3, 7, 0, -50, 0, -8,
+   -39, 0, -4, 0, 0, 0, -5, 0, -2, 0,
+   0, -5, 0, -12, 0, 0, 1, -1, -5, 0,
+   13, 0, -6, 6, 0, -2, 0, -5, -3, -75,
+   0, -2, -3, 0, 4, 0, 0, -1, -14, -7,
+   -5, -31, 2, 0, 2, 0, -8, 2, -42, 0,
+   -7, 4, -3, -1, -180, -19, -19, 0, 2, -5,
+   -17, 0, 0, -180, -1, -3, 4, -42, 2, -9,
+   -31, 0, 2, 0, -13, 0, 0, 0, -7, 6,
+   0, 18, -13, 0, 4, -1, 11, 0, -2, 0,
+   -1, 0, 0, 10, 0, -49, 0, 0, -2, 0,
+   0, -4, 0, 3, 0, -4, 0, 0, 0, 0,
+   -2, 0, 0, 0, -10, 0, 1, -16, 0, 0,
+   0, 0, 0, -3, -7, 0, 3, 29, 0, 0,
+   0, -2, -21, 0, 0, 0, 0, 2, 19, 0,
+   -4, -12, 0, 0, 0, 2, 0, 0, -1, 0,
+   0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+   0, 3, 0, -2, 0, 0, 1, 0, 0, 0,
+   0, -2, 0, 0, 0, 0, 0, -2, 0, 0,
+   0, -2, 0, 0, -20, 0, 5, -31, 0, 0,
+   -3, 0, 0, 1, 0, -1, 0, 0, 2, 0,
+   0, -2, -2, 3, -17, 0, 11, 57, 0, 1,
+   0, 0, 0, 0, 0, 0, 0, 0, 7, 15,
+   49, 0, 29, 0, -2, 0, 0, 0, 0, 0,
+   -2, -1, -2, 0, 0, 0, 1, 0, -2, 0,
+   1, 1, -2, 0, 10, 0, 0, 4, 0, -4,
+   0, 9, 3, -5, 9, -1, 0, 0, -2, -5,
+   2, 3, 0, -3, 0, 0, 0, 0, 5, -17,
+   0, -6, 0, 0, 1, 0, 0, 0, 4, 0,
+   0, 1, 0, 0, 0, 26, -77, 119, 0, 0,
+   2, 0, 0, 0, 4, 0, 5, 0, 0, 8,
+   -2, 0, 6, 14, 3, 3, 5, -116, 0, 6,
+   -7, 5, 0, 0, 0, 0, 0, 0, -26, 21,
+   0, -5, -8, 0, 0, 0, 19, 0, 4, 0,
+   -3, -3, 0, 7, -2, 2, 0, 0, 4, 4,
+   0, 0, 3, 0, 3, 0, 10, 3, -25, 26,
+   0, 28, 103, 0, 0, 2, -5, -1, -1, 3,
+   0, -233, -11, -1, -3, 0, 0, 61, -59, -2,
+   0, 13, 25, -25, 0, 43, 3, 30, 0, -3,
+   -15, 0, -3, 0, -1, 0, 9, 156, 0, 0,
+   0, 159, 9, 2, -2, -3, 7, -18, 0, 2,
+   0, 35, 0, 0, 0, 0, -1, -2, 15, 1,
+   0, 0, 0, 0, -12, 4, 4, -6, 0, 45,
+   -8, 3, -2, 2, 3, -37, 0, 0, -4, 0,
+   0, 0, 0, 0, 0, 4, 0, -9, 3, 0,
+   0, 0, 0, 10, -4, 3, 0, 3, -4, -2,
+   -1, 1, 0, 0, 0, 0, 13, 0, 0, 2,
+   2, 0, 0, -4, 0, -2, 11, 0, 0, 0,
+   6, -10, 0, 2, 0, 0, 0, 0, 7, -232,
+   0, 0, 0, 0, 0, 0, 3, -7, 0, 319,
+   -133, 6, 76, 0, -3, -2, 0, 0, 0, 0,
+   0, -14, -16, -7, 0, 0, -11, -1286, 2735, 0,
+   -257, 117, 0, 0, 2, 0, 0, 0, 0, 0,
+   0, 0, -3, 0, 0, -42, 0
+};
+const short terse_alternate_nut_pl_ce[NUT_PL_N] = {
+   -1, -1, -3, -6, -2, 10, 0, 0, 0, -11,
+   2, 1, -1, 1, 3, -4, 0, 1, 11, 0,
+   -11, -1, 55, -1, 1, -2, 2, 2, -55, 0,
+   0, 0, 3, -3, -1, 0, 0, 0, 0, 3,
+   1, -2, 0, 0, 0, 2, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, -1, -2, 0, 0,
+   -3, 0, 0, -4, 3, 0, 0, 0, -5, 0,
+   -1, 0, 0, 0, 0, -1, 4, 1, 0, 0,
+   -4, 0, 0, -1, 0, -10, 2, 0, 0, 0,
+   0, 3, 1, -13, -1, 0, 1, 80, 0, 0,
+   -2, 16, 2, 0, -15, -2, 0, 4, 0, 3,
+   0, 0, -160, -2, 0, 4, 0, 0, -2, 0,
+   2, 2, 0, 0, -22, 10, 0, 1, 11, -2,
+   3, 2, -13, -62, 0, -224, 23, 0, 0, -13,
+   -29, 0, -2, 0, -1, 4, -4, 0, 0, -1,
+   0, 0, 147, -3, 0, -1, -1, -5, 0, 0,
+   -3, -8, -11, 2, -32, -1, 2, -3, 0, -2,
+   0, 0, 0, -1, -1, 0, -2, 0, 9, 28,
+   -72, 37, 0, 0, 0, 1, 0, 5, 27, -1,
+   0, 6, -5, 0, 53, 6, -6, 38, 0, 0,
+   -4, 0, -35, -53, 0, 5, -6, -27, -5, 0,
+   -35, 0, 0, 0, 67, 0, -1, 0, -24, -1,
+   0, -4, -8, 0, 1, 3, 2, 0, 0, 0,
+   0, 2, 0, 2, -51, 0, 2, 0, 0, 0,
+   -7, 2, 1, 2, 0, 8, -2, 6, 0, -2,
+   0, 1, 0, -2, 0, -49, 0, -4, 0, 0,
+   -2, 0, -1, 2, 1, 0, 0, -6, 0, -1,
+   -3, 1, 15, 0, 0, -3, 0, 0, 5, -87,
+   8, 0, 4, 0, 114, 0, 0, -2, 0, 32,
+   0, 6, 0, 0, 2, 0, 2, 0, 0, 2,
+   1, 0, 0, 1, -2, -6, 0, 0, 0, 0,
+   0, 0, 0, 0, 0, 0, 0, -2, -2, 0,
+   -4, 0, 0, -4, -8, 0, 2, 0, 0, -2,
+   -6, -1, 0, -5, 0, 198, 1, -8, 0, 0,
+   0, -52, 0, -2, 0, 0, -2, 0, -1, 10,
+   0, -13, 3, 0, 4, 0, -3, -13, 1, 0,
+   5, 0, -2, 15, 0, 0, 0, 0, 2, 4,
+   12, -213, -1, -1, 6, 0, 0, -14, 0, 0,
+   0, 7, 1, 2, 0, 2, 5, 0, -1, -7,
+   4, 0, 0, -4, 0, 0, -2, -7, 0, 3,
+   0, 55, -1, 2, -3, -2, 0, -9, -16, -2,
+   -11, 1, 0, 0, -27, 0, 0, -1, -3, 0,
+   0, 10, 2, -2, 3, 0, 2, -2, 2, -63,
+   0, 4, 3, 2, 505, -5, 14, -22, 0, -3,
+   -1, 0, -9, 0, 2, 0, 0, 1, 0, -2,
+   0, 0, -30, -75, -17, 0, 0, 5, 22, 4,
+   -5, 3, 0, -2, -2, -37, 5, 932, -7, 5,
+   0, 3, 5, -4, 0, 0, 20, 3, 0, -29,
+   0, 0, 0, 0, -4, 4, 0, 0, 1, 0,
+   -2, 0, 2, 0, 0, 1, -23, 0, 3, -3,
+   0, 7, 27, 0, -2, 1, 28, 3, -6, 0,
+   0, 9, 6, 0, 11, 0, 57, -27, 26, -2,
+   2, 0, -3, 4, 0, -146, -13, 21, 2, 0,
+   -30, 0, 5, 0, -2, 0, 39, 44, 1, 2,
+   -1, -45, -41, 1, 3, -5, 0, 36, 0, 0,
+   0, -25, 3, -2, 0, 0, -5, 2, 0, -2,
+   -2, 0, 0, 2, -5, 0, -25, 35, 0, -93,
+   17, 0, 9, -2, 0, -11, 0, 1, -8, 0,
+   -3, 0, 0, 0, 0, 2, 0, -48, -2, 0,
+   0, 0, 0, 0, 0, 6, 3, 0, -1, 1,
+   0, 0, 0, 1, 0, 0, -2, 2, 0, 3,
+   0, 0, 0, 0, -1, 1, -5, 0, 0, 3,
+   -5, 9, 0, 0, 0, 0, 0, 2, 0, 246,
+   0, 0, -7, 0, -3, 3, 3, -6, 0, -641,
+   269, 0, 17, -3, 0, 0, 0, -151, 0, 0,
+   -6, -5, 14, 0, 0, 0, -9, -771, 1647, 0,
+   -17, 8, 0, 0, 0, 2, -53, 0, 0, 0,
+   61, -2, 0, 0, -54, -40, 0
+};
+
+/* CIP X,Y: multipliers of the 14 fundamental arguments, planetary frequencies first, then the luni-solar ones. */
+const signed char terse_alternate_xy_pl_mult[XY_PL_N][14] = {
+   {  0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -6,   3,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -3,   5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -3,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   2,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   1,  -5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -8,   1,   5,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   0,  -3,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -7,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -9,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,  -5,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   5, -13,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   5, -16,   4,   5,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -8,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -9,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   5,   0,  -4,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   6, -10,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   6,  -4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   6,  -8,   1,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   7, -12,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -3,   0,   2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   5,  -4,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   5,  -6,  -4,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   6,  -7,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   6,  -8,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   8, -11,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   8, -14,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   9, -13,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   1,   0,  -1,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   2,   0,  -3,   5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   2,   0,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   2,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,  -1,   0,  -5,   7,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,  -1,   0,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   0,  -1,   0,   0,  -2,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,  -1,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,  -4,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   2,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   2,   0,   0,  -1,   0,   0,  -1,   0,   0,   0},
+   {  0,   0,   2,  -2,   0,  -1,   0,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0, -10,  15,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,  -2,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,   2,   2,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  1,   0,  -1,  -1,   0,   0,   0,   8, -15,   0,   0,   0,   0,   0},
+   {  1,   0,  -1,   1,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  1,   0,  -2,  -2,  -2,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  1,   0,   2,  -2,   2,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   2,   0,   2,   0,  -1,   1,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   2,   0,   2,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  1,   0,   2,   0,   2,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  1,   0,   2,   0,   2,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  2,   0,  -1,  -1,   0,   0,   0,  -1,   0,   3,   0,   0,   0,   0},
+   {  2,   0,  -2,   0,  -2,   0,   0,   5,  -9,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,  -4,   4,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -2,   0,   0,   2,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -2,   0,   0,   5,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -2,   0,   1,   5,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -2,   0,   5,  -5,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   2,  -5,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   1,  -3,   1,   0,  -6,   7,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   2,  -2,   2,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   2,   0,   0,   0,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   2,   0,   2,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,   0,   2,   0,  -2,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,   0,   2,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,   0,   2,   0,   2,  -3,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,   0,  -1,   0, -10,   3,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   1,   0, -10,   3,   0,   0,   0,   0,   0,   0},
+   {  2,   0,  -2,  -2,  -2,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   8,  -9,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   2,   0,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,  -4,   5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   0,  -1,   0,   0,   1,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   0,  -2,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   3,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,   1,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   0,   0,  -4,   4,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -2,   0,   2,   2,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -4,   4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   1,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,  -2,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,  -4,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   0,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  1,   0,   0,  -1,   0,   0,   0,  -2,   2,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,  17, -16,   0,  -2,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,  -1,   1,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -4,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   1,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -7,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -8,   3,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   7,  -7,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   9, -17,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   1,  -4,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   4,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   6,  -4,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   6,  -6,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   7, -11,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   1,   0,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,  -2,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,   7, -13,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   1,  -3,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,   1,  -4,   0,   0,   0,   0,   0},
+   {  0,   0,   1,   1,   2,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   0,   0,   0,  -9,  13,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,  -8,  11,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,  -4,   4,   0,   0,   0,   0,   0},
+   {  1,   0,  -1,   0,  -1,   0,  -3,   5,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -1,  -1,   0,   0,  -3,   4,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,  -1,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   1,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  1,   0,   1,   1,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,  -1,   0,   0,  -2,   0,   3,  -1,   0,   0,   0},
+   {  2,   0,   0,  -2,   1,   0,   0,  -5,   6,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   7,  -8,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   2,   0,  -8,  12,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,  -1},
+   {  0,   0,   2,  -2,   1,   0,   0,  -7,   9,   0,   0,   0,   0,   0},
+   {  2,   0,  -1,  -1,   1,   0,   0,   3,  -7,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,  -1,   0,   0,  -6,   8,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   0,  -2,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -8,   3,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   7,  -8,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   7,  -9,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   3,  -8,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   7, -10,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   1,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   3,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,  -5,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   0,   0,  -1,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -4,   6,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   1,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,  -5,   5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,  -3,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  1,   0,   0,  -1,   1,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   6, -10,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   1,   0,   0,   1,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,  -1,   0,   0,  -1,   0,  -1,   0,   0,   0,   0},
+   {  2,   0,   2,   0,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -7,   4,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -2,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -2,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -5,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,  -5,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   4,   0,  -4,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   1,   0,   0,   2,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   2,   0,  -5,   7,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   2,   0,   0,  -1,   0,   0,   1,   0,   0,   0},
+   {  0,   0,   2,  -2,   2,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  1,   0,  -1,   1,  -1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  1,   0,  -2,  -2,  -2,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,  -4,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   1,   0,   0,  -9,  17,   0,   0,   0,   0,   0},
+   {  1,   0,  -2,   0,  -2,   0, -10,   3,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -1,   1,   0,   0,  -3,   4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -7,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -6,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -8,   1,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   9, -17,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   8, -12,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   1,  -1,   2,   0,   0,  -1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   8, -12,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,  20, -21,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -8,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   2,   0,   0,  -1,   0,  -2,   5,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   0,  -2,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,  -7,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -3,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   9, -11,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   1,   0,   0,   0,   0,   0,  -1,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   5,  -8,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,  -2,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   1,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  1,   0,  -1,  -1,  -1,   0,  20, -20,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -1,  -1,   0,   0,  -2,   2,   0,   0,   0,   0,   0},
+   {  1,   0,   1,  -1,   1,   0,   0,  -1,   0,   0,   0,   0,   0,   0},
+   {  2,   0,  -1,  -1,  -1,   0,   0,  -1,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,  -1,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,  -1,   0,   0,  -2,   0,   4,  -5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   2,   0,   0,   0,   0,   2},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,  -2,   4,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6, -10,   0,   0,   0,   0,   0,  -1},
+   {  2,   0,  -1,  -1,  -2,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   2,   0,   0,  -1,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   8, -16,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   1,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   2,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,  -1,   0,  -5,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,   0,   2,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   2,   0,   2,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  1,   0,  -1,   1,  -1,   0, -18,  17,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   2,  -2,   2,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  2,   0,  -1,  -1,  -1,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,  -2,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,  -8,  15,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   0,  -1,   0,   0,   2,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   7, -13,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -5,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,  -6,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,   0,  -2,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   4,   0,   0,  -2,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   6,  -7,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   2,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   2,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   2,   0,   0,   0,  -2,   0,   0,   0,   0,   0},
+   {  1,   0,  -2,  -2,  -2,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   6,  -5,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -8,   1,   5,   0,   0,  -2},
+   {  2,   0,   0,  -2,   1,   0,   0,  -6,   8,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   6, -11,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -2,   0,   4,  -3,   0,   0,   0},
+   {  0,   0,   2,   0,   2,   0,  -1,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -8,   0,   0,   0,   0,   0},
+   {  2,   0,  -1,  -1,  -1,   0,   0,   3,  -7,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,  -2},
+   {  2,   0,   0,  -2,  -1,   0,   0,  -5,   6,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,  -4,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   4,  -2,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   8, -10,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   8,  -8,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   2,  -2,   1,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   7, -13,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -2,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   8, -15,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   2,  -6,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,  -1,   2,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,  -2,   0,   0,   2,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,  -8,  11,   0,   0,   0,   0,   0},
+   {  0,   0,   2,   0,   2,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   9,  -9,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   0,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   3,  -5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   0,   0,   2,   0,   0},
+   {  0,   0,   2,  -2,   1,  -1,   0,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   8, -13,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   5, -10,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   4,  -2,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,  -3,   0,   0,   0,   0,   0,   2},
+   {  2,   0,  -1,  -1,  -1,   0,   0,  -1,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   5,   0,  -3,   0,   0,   0,   2},
+   {  0,   0,   2,   0,   2,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  0,   0,   2,   0,   2,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   5,  -9,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   1,  -1,   2,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   5,  -3,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   1,   0,   0,   2,  -4,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   0,   3,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   9,  -9,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   5,  -6,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -9,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   0,  -2,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -2,   0,   3,  -1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,  -5,   0,   0,   0,   0,  -2},
+   {  0,   0,   1,  -1,  -1,   0,   0,   0,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   1,  -1,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   1,   0,  -4,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   6,  -6,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   7,  -7,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   1,  -1,   1,   0,  -2,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,  -8,  12,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   9, -12,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   1,  -1,   0,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   6, -11,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -5,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -8,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   2,  -2,   2,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   2,   0,  -5,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   5,   0,  -2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   1,   0,  -3,   7,  -4,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -1,   0,   0,   0,  -3,   4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,   1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   6, -15,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,  11,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,  -3,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   0,  -1,   0,  -2,   5,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   3,  -7,   4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,   2,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   8,  -8,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,  -1,   0,  -6,   8,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,  -1,   0,   0,  -2,   0,   0,   5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   2,  -5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   6,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,  -2,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   2},
+   {  1,   0,  -2,  -2,  -2,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   4,  -7,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   7,  -9,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -9,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -2,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   2,   0,  -8,  11,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,  -3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   1,   0,   3,  -5,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   2,  -4,   0,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -7,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,  -1,   1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,  -6,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   2},
+   {  0,   0,   1,  -1,   2,   0,   0,  -2,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   8, -15,   0,   0,   0,   0,  -2},
+   {  2,   0,   0,   0,   0,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   0,  -1,   0,  -1,   1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -5,   4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   7, -11,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,  -4,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   3,  -9,   4,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   2,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,   1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   1,   0,   0,   0,   0,  -1,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -5,   6,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -6,   8,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -3,   4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -7,   0,   0,   0,   0,  -2},
+   {  2,   0,  -1,  -1,   0,   0,   0,   3,  -7,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   1,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   2},
+   {  2,   0,   0,  -2,   1,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   7,  -7,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -6,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,   8, -15,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   8, -14,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,  -2,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   3,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   0,  -1},
+   {  2,   0,   0,  -2,   1,   0,  -6,   8,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   0,  -1,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,  -4,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,  -1,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,  -2,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -9,  15,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,  -8,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   2,  -5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   7, -10,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   1},
+   {  0,   0,   1,  -1,   0,   0,  -5,   7,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,  -1,   0,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,  -3,   5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   7,  -8,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   6, -10,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,  -8,   3,   0,   0,   0,  -2},
+   {  0,   0,   2,   0,   2,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   2,   1,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,  -2,   4,   0,   0,   0,   0,   0},
+   {  1,   0,  -2,   0,  -1,   0,   0,  -1,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   2,   0,   1,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   6,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,  -2},
+   {  1,   0,   0,  -1,  -1,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   2,   0,   0,  -1,   0,   0,   2,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -6,   0,   0,   0,   0,   0,  -2},
+   {  2,   0,   2,   0,   2,   0,   0,   2,   0,  -3,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,  -9,  13,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,   0,   0,   0,   1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   5,  -8,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   0,   0,   0,   2,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -3,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,   0,  -1,   0,   0,   2},
+   {  0,   0,   2,  -2,   1,   0,  -4,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -4,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   3,  -1,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -3,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   0,  -1,   0,   0,  -1,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,  -4,  10,   0,   0,   0},
+   {  0,   0,   1,   1,   1,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -1,   1,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,   0,  -1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,  -6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,  -4,   5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   8, -15,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   9, -11,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   5,  -4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,  -1},
+   {  1,   0,   0,  -1,   0,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   2,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   4,   0,  -3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   4,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   5,  -5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0,  -1},
+   {  1,   0,   0,  -1,   1,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   6,  -9,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   1,  -1,   1,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   8, -10,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   0,  -1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,  -1},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   1},
+   {  0,   0,   1,  -1,   1,   0,   0,  -2,   2,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,  -6,   8,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   0,   0,   0,  -1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   4,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,  -3,   0,   0,   0,   0},
+   {  0,   0,   2,  -2,   1,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   1,   0,   0,   1,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -3,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,  -1,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,  -1},
+   {  2,   0,   0,  -2,   1,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   3,  -7,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   4,  -7,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   6, -16,   4,   5,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,  -1},
+   {  1,   0,   0,   0,   1,   0, -18,  16,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   7,  -9,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   0,   1,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,  -8,  13,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,  -2,   0,   0,  19, -21,   3,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,   0,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,   0,   0,   2,  -5,   0,   0,   0},
+   {  1,   0,   0,   0,  -1,   0, -18,  16,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   2},
+   {  1,   0,   0,  -1,   0,   0,  -3,   4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,   0,   0,  -2,   5,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   8, -13,   0,   0,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -8,   0,   0,   0,   0,   0,  -1},
+   {  2,   0,   0,  -2,   1,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,  -2,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   2,   0,   0,   0,   0,   2},
+   {  0,   0,   1,  -1,   1,   0,   0,  -5,   8,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,  -2,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   1,  -3,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   8, -15,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   3,  -2,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   6,  -8,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -3,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   4,  -6,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   0,   0,   0,   8, -16,   4,   5,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   8, -11,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   1,  -1,   1,   0,   0,   3,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   8, -16,   4,   5,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   2},
+   {  0,   0,   2,  -2,   1,   0,  -3,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   0,   2,   0,   0,   0},
+   {  1,   0,  -2,   0,  -2,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -2,   0,   0,   0,   0,   2},
+   {  1,   0,   2,   0,   2,   0,   0,   1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,  -1,   0,   0,   0,   2},
+   {  0,   0,   2,  -2,   0,   0,  -5,   6,   0,   0,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0, -10,   3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,  -5,   7,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,   1,   0,   0,   0,   2},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   2,   0,   0,   0,   0},
+   {  1,   0,   0,   0,   0,   0, -18,  16,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,  -1,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   8, -13,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   4,   0,  -2,   0,   0,   0,   2},
+   {  0,   0,   1,  -1,   0,   0,   0,   0,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -7,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -2,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   0,  -1,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -4,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,  -1,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -2,   0,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   1},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   5,  -8,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,   1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   8, -13,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   2,   0,  -2,   0,   0,   0,   0},
+   {  2,   0,   0,  -2,   0,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   1},
+   {  2,   0,   0,  -2,  -1,   0,   0,  -2,   0,   2,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,   0,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,   1,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   1,   0,   0,  -4,   8,  -3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,  -2,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   2,  -3,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,  -2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   6,  -8,   3,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   2,  -4,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   2,  -8,   3,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   3,   0,  -1,   0,   0,   0,   2},
+   {  0,   0,   0,   0,   0,   0,   4,  -6,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   2,  -2,   1,   0,  -5,   6,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,   2,  -5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   8, -13,   0,   0,   0,   0,   0,  -1},
+   {  0,   0,   0,   0,   1,   0,   0,  -1,   2,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   1,   0,  -1,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   8, -16,   4,   5,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   1,  -1,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   4,  -8,   3,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,   0,   0,   0,   2},
+   {  0,   0,   1,  -1,   1,   0,  -8,  12,   0,   0,   0,   0,   0,   0},
+   {  0,   0,   0,   0,   0,   0,   3,  -5,   0,   0,   0,   0,   0,  -2},
+   {  0,   0,   0,   0,   0,   0,   0,   0,   0,   2,  -5,   0,   0,  -1},
+   {  0,   0,   1,  -1,   1,   0,   0,  -1,   0,  -2,   5,   0,   0,   0}
+};
+const signed char terse_alternate_xy_ls_mult[XY_LS_N][5] = {
+   {  0,   0,   4,  -4,   4},
+   {  1,   0,  -2,   0,  -3},
+   {  0,   1,  -4,   2,  -1},
+   {  1,  -2,   0,  -1,   0},
+   {  1,   0,  -2,   4,  -2},
+   {  1,   0,   0,  -4,   2},
+   {  1,   0,   0,   3,   0},
+   {  1,   0,   2,   1,   0},
+   {  1,   1,  -2,  -1,  -2},
+   {  1,   1,  -2,   1,  -2},
+   {  1,   1,   0,  -6,   0},
+   {  1,   1,   0,   0,  -2},
+   {  1,   3,  -2,  -2,  -2},
+   {  2,  -1,   0,  -2,   2},
+   {  2,  -1,   2,   4,   2},
+   {  2,   0,  -2,  -5,  -2},
+   {  2,   0,   0,  -4,  -2},
+   {  2,   0,   0,  -4,   2},
+   {  2,   1,  -2,   0,  -2},
+   {  2,   1,   0,  -3,   0},
+   {  2,   1,   2,  -2,   0},
+   {  2,   1,   2,  -4,   2},
+   {  2,   1,   2,   0,   0},
+   {  3,  -1,   0,  -2,   0},
+   {  3,  -1,   0,  -3,   0},
+   {  3,   0,  -2,  -4,  -2},
+   {  3,   0,   0,   0,  -2},
+   {  3,   1,  -2,  -6,  -2},
+   {  3,   1,   0,  -2,   0},
+   {  3,   1,   2,   2,   2},
+   {  4,   0,  -2,  -2,   0},
+   {  4,   1,   2,  -2,   2},
+   {  5,   0,   2,   0,   1},
+   {  0,   0,   0,   3,   2},
+   {  0,   1,   4,  -4,   2},
+   {  1,   2,   2,  -4,   1},
+   {  2,  -1,  -2,   0,   1},
+   {  2,   2,   0,  -2,  -1},
+   {  0,   0,   2,  -3,   0},
+   {  0,   1,   2,   2,   0},
+   {  1,  -1,  -2,  -2,   0},
+   {  1,  -1,   0,   1,   0},
+   {  1,   0,   2,  -1,   0},
+   {  2,  -1,   2,   0,   0},
+   {  2,   1,   0,  -6,   0},
+   {  2,   1,   0,   1,   0},
+   {  3,  -1,   0,   2,   0},
+   {  3,   0,   0,  -1,   0},
+   {  4,   0,   0,   2,   0},
+   {  0,   1,  -2,   2,  -3},
+   {  0,   2,   0,   0,  -2},
+   {  0,   0,   0,   6,   0},
+   {  0,   0,   1,  -1,   0},
+   {  0,   0,   2,  -4,   0},
+   {  0,   2,   0,  -4,   0},
+   {  1,   0,   1,  -2,   0},
+   {  3,   0,   0,  -2,   0},
+   {  0,   1,   2,  -2,   3},
+   {  1,  -1,  -2,   1,  -1},
+   {  1,  -1,   0,   4,   1},
+   {  1,  -1,   2,  -3,   1},
+   {  1,  -1,   2,   4,   1},
+   {  1,   0,  -1,  -2,  -1},
+   {  1,   0,   2,  -4,  -1},
+   {  1,   0,   2,  -6,   1},
+   {  1,   0,   4,   0,   1},
+   {  1,   2,   0,   0,   1},
+   {  1,   2,   2,   0,   1},
+   {  2,  -1,  -2,  -2,  -1},
+   {  2,   0,   0,  -6,  -1},
+   {  2,   0,   2,  -2,  -1},
+   {  2,   0,   2,  -6,   1},
+   {  2,   0,   2,   4,   1},
+   {  2,   1,   0,   2,   1},
+   {  2,   1,   2,   2,   1},
+   {  3,   0,  -2,  -1,  -1},
+   {  3,   0,  -2,  -6,  -1},
+   {  4,   0,  -2,   0,  -1},
+   {  0,   1,   0,   3,   0},
+   {  1,  -1,   2,   2,   0},
+   {  2,   2,   0,  -4,   0},
+   {  3,   0,   0,  -3,   0},
+   {  5,   0,   0,   0,   0},
+   {  0,   1,  -2,   4,  -1},
+   {  0,   1,   2,  -4,   2},
+   {  0,   2,   0,   0,   2},
+   {  1,  -1,  -2,  -4,  -1},
+   {  1,  -2,  -2,   2,  -1},
+   {  1,  -2,   2,   2,   1},
+   {  1,   0,  -2,  -6,  -1},
+   {  1,   0,  -4,  -2,  -1},
+   {  1,   0,   0,  -3,  -1},
+   {  1,   1,  -2,  -6,  -2},
+   {  1,   1,   0,   1,  -1},
+   {  1,   1,   0,   1,   1},
+   {  1,   1,   2,   4,   2},
+   {  2,  -1,   0,   2,  -1},
+   {  2,  -1,   0,   2,   1},
+   {  2,  -2,   0,  -2,  -2},
+   {  2,  -2,   2,   2,   2},
+   {  2,   0,  -2,  -2,   1},
+   {  2,   0,  -4,   2,  -1},
+   {  2,   0,   0,  -3,   1},
+   {  2,   0,   0,   4,   1},
+   {  2,   0,   2,  -3,   2},
+   {  2,   0,   4,  -4,   2},
+   {  3,   0,  -2,   2,  -1},
+   {  3,   0,   0,   0,   2},
+   {  3,   0,   0,   2,  -1},
+   {  3,   0,   2,   1,   2},
+   {  3,   0,   4,  -2,   2},
+   {  3,   1,   2,  -2,   1},
+   {  1,   0,   1,   0,   0},
+   {  0,   0,   2,   4,   0},
+   {  0,   2,   0,   2,   0},
+   {  1,  -1,   2,  -2,   0},
+   {  1,   0,   2,  -3,   0},
+   {  1,   1,   0,  -3,   0},
+   {  1,   1,   2,  -4,   0},
+   {  2,  -2,   0,   0,   0},
+   {  3,   0,  -2,  -2,   0},
+   {  0,   0,   4,   2,   2},
+   {  0,   1,   0,   4,   1},
+   {  0,   3,  -2,  -2,  -2},
+   {  1,  -1,  -4,   2,  -2},
+   {  1,  -1,   0,   0,  -2},
+   {  1,  -1,   2,   1,   2},
+   {  1,   0,  -2,   0,   2},
+   {  1,   0,  -2,   1,   1},
+   {  1,   0,   3,   0,   3},
+   {  1,   1,  -2,  -3,  -2},
+   {  1,   1,  -2,   2,  -2},
+   {  2,  -1,  -2,   2,  -1},
+   {  2,   0,   0,  -1,   1},
+   {  2,   1,  -2,  -6,  -2},
+   {  2,   1,   0,  -2,  -2},
+   {  4,  -1,  -2,  -2,  -2},
+   {  4,   1,   2,   0,   2},
+   {  2,   2,  -2,  -4,  -2},
+   {  4,  -1,   2,   0,   2},
+   {  0,   0,   4,  -2,   0},
+   {  2,  -2,   2,  -2,   2},
+   {  0,   3,   0,  -2,   0},
+   {  1,   3,   0,  -2,   0},
+   {  2,  -1,   0,  -1,   0},
+   {  0,   0,   2,   3,   1},
+   {  0,   1,   4,  -2,   1},
+   {  1,  -2,  -2,  -2,  -1},
+   {  1,  -2,   0,   0,  -1},
+   {  1,   0,   0,  -6,  -1},
+   {  2,  -1,   2,  -2,   1},
+   {  2,  -2,   0,  -2,   1},
+   {  2,   0,   0,  -3,  -1},
+   {  2,   0,   4,  -2,   1},
+   {  2,   1,  -2,   0,   1},
+   {  3,   0,   0,  -2,   1},
+   {  0,   1,   0,  -4,   1},
+   {  0,   1,   2,   3,   2},
+   {  0,   2,  -2,  -4,  -2},
+   {  0,   2,   2,   2,   2},
+   {  1,  -1,   0,  -4,  -1},
+   {  1,  -2,   0,  -2,   1},
+   {  1,  -2,   2,   0,   1},
+   {  2,  -1,   2,  -1,   2},
+   {  2,   0,  -2,  -6,  -1},
+   {  2,   0,  -4,  -2,  -1},
+   {  2,   0,   2,   1,   1},
+   {  2,   1,   2,  -4,   1},
+   {  2,   1,   2,   1,   2},
+   {  1,   1,  -2,   2,   0},
+   {  2,   0,   0,   4,   0},
+   {  0,   0,   0,   4,   2},
+   {  1,   0,   0,   4,  -1},
+   {  1,   0,   2,   3,   2},
+   {  1,   1,   2,  -4,   2},
+   {  1,   1,   4,  -2,   2},
+   {  2,  -1,  -2,   0,  -2},
+   {  2,   0,  -4,   2,  -2},
+   {  4,   0,   2,  -4,   2},
+   {  0,   2,  -2,   0,  -1},
+   {  0,   0,   0,   1,  -2},
+   {  2,   2,   2,  -2,   2},
+   {  0,   1,  -2,   0,   0},
+   {  0,   1,   0,   4,   0},
+   {  1,  -1,   0,  -3,   0},
+   {  1,   2,   0,  -4,   0},
+   {  2,   0,   2,   2,   0},
+   {  3,   0,   2,  -2,   0},
+   {  1,   0,  -1,   0,   1},
+   {  0,   0,   2,   0,  -2},
+   {  0,   1,   0,  -2,   2},
+   {  1,  -1,   0,   4,   0},
+   {  2,   1,   0,   2,   0},
+   {  4,   0,   0,  -4,   0},
+   {  1,  -2,   0,  -2,  -1},
+   {  1,   1,   0,  -1,   1},
+   {  1,   1,   2,   1,   1},
+   {  3,   1,   2,   0,   1},
+   {  0,   2,   2,   0,   1},
+   {  1,   1,   0,   2,  -1},
+   {  1,   2,   2,  -2,   1},
+   {  2,   0,   2,  -1,   1},
+   {  3,  -1,   2,   0,   1},
+   {  3,   0,   2,  -1,   2},
+   {  4,   0,   0,   0,  -1},
+   {  0,   1,   0,  -1,   0},
+   {  1,   0,  -4,   0,   0},
+   {  2,   0,  -2,  -4,   0},
+   {  0,   0,   2,  -2,  -2},
+   {  1,  -1,  -2,  -3,  -2},
+   {  1,  -2,  -2,   0,  -2},
+   {  1,   0,   0,  -3,   1},
+   {  2,  -2,   2,   0,   2},
+   {  2,   0,   0,   2,   2},
+   {  3,   0,   0,  -6,   0},
+   {  3,   1,   0,  -4,   0},
+   {  0,   0,   4,  -1,   2},
+   {  1,   0,   4,  -4,   2},
+   {  1,   2,  -2,  -4,  -2},
+   {  5,   0,   2,  -2,   2},
+   {  0,   0,   0,   3,   0},
+   {  2,  -1,   0,  -4,   0},
+   {  1,  -2,   0,   0,   1},
+   {  2,   1,  -2,  -2,  -1},
+   {  0,   0,   3,   0,   2},
+   {  2,   0,  -4,   0,  -1},
+   {  2,   0,   2,   0,  -1},
+   {  2,   1,   0,  -4,   1},
+   {  1,   0,  -2,  -4,   0},
+   {  1,   0,   0,  -6,   0},
+   {  3,  -1,  -2,  -1,  -2},
+   {  0,   2,   2,  -2,   0},
+   {  1,   1,  -2,   0,   0},
+   {  0,   1,  -2,  -1,  -2},
+   {  0,   1,   0,   2,   2},
+   {  1,  -2,   2,  -2,   2},
+   {  1,   0,   0,  -1,   2},
+   {  3,  -1,   2,  -2,   2},
+   {  3,  -1,   2,   2,   2},
+   {  1,   0,   0,   2,  -2},
+   {  0,   0,   2,   1,   0},
+   {  1,  -1,  -2,   0,   0},
+   {  0,   0,   0,   3,   1},
+   {  2,   1,   0,  -4,  -1},
+   {  4,   0,  -2,  -2,  -1},
+   {  0,   0,   2,   6,   2},
+   {  1,   1,   0,   0,   2},
+   {  1,  -1,   2,  -4,   1},
+   {  1,   1,   2,   0,   0},
+   {  0,   0,   2,   2,  -1},
+   {  1,   1,   0,  -4,  -1},
+   {  3,   0,   0,   2,   1},
+   {  0,   0,   0,   1,   2},
+   {  1,   0,   0,  -4,  -2},
+   {  1,   1,   0,  -4,   1},
+   {  0,   1,   2,   0,   0},
+   {  2,   2,   0,  -2,   0},
+   {  4,   0,   0,  -2,   0},
+   {  1,   1,   0,  -2,   2},
+   {  2,   0,  -2,   2,  -2},
+   {  1,  -1,   0,  -4,   0},
+   {  1,  -1,   2,   0,   0},
+   {  3,   0,   0,  -4,   1},
+   {  3,   1,   0,   0,   0},
+   {  1,   0,   2,   0,   3},
+   {  2,   0,   0,  -6,   0},
+   {  2,   0,  -2,  -3,  -2},
+   {  4,   0,   2,   2,   2},
+   {  0,   1,  -2,  -4,  -1},
+   {  2,  -1,   2,   2,   1},
+   {  3,   0,  -2,   0,   0},
+   {  0,   1,  -4,   2,  -2},
+   {  0,   1,   2,   4,   2},
+   {  0,   0,   4,  -4,   1},
+   {  1,   2,  -2,  -2,  -1},
+   {  1,  -2,   0,   2,   0},
+   {  2,   0,   0,   1,   0},
+   {  1,  -1,   0,   0,   2},
+   {  0,   1,  -2,   1,  -1},
+   {  1,  -2,   2,  -2,   1},
+   {  0,   1,   0,  -4,  -1},
+   {  1,   0,  -2,  -3,  -1},
+   {  3,   0,   0,  -2,  -1},
+   {  0,   1,  -2,  -2,   0},
+   {  3,   0,  -2,   0,  -2},
+   {  2,  -1,  -2,  -4,  -2},
+   {  1,   0,   1,  -2,   1},
+   {  1,   1,  -2,  -2,   0},
+   {  1,   1,   0,  -2,  -2},
+   {  2,   0,   2,  -4,   0},
+   {  1,   0,  -2,  -2,   1},
+   {  1,   0,  -2,   4,  -1},
+   {  1,   1,   2,  -2,   0},
+   {  2,   0,  -2,   2,   0},
+   {  4,   0,   2,  -2,   1},
+   {  2,  -1,  -2,   0,   0},
+   {  3,  -1,   0,   0,   0},
+   {  2,   1,  -2,  -4,  -1},
+   {  1,   1,  -2,   1,   0},
+   {  3,   0,   2,   0,   0},
+   {  0,   2,   0,  -2,   1},
+   {  1,   0,   1,   0,   1},
+   {  0,   0,   2,  -1,   0},
+   {  0,   1,   0,  -2,  -2},
+   {  1,   2,   2,   0,   2},
+   {  0,   1,   2,  -4,   1},
+   {  1,   0,  -4,   2,  -1},
+   {  1,   0,   0,   1,   1},
+   {  3,   0,   0,  -4,  -1},
+   {  1,  -1,   2,  -1,   2},
+   {  3,   0,  -2,  -6,  -2},
+   {  5,   0,   2,   0,   2},
+   {  2,   0,  -2,   0,   2},
+   {  0,   2,  -2,  -2,  -1},
+   {  1,  -1,  -2,   2,   0},
+   {  1,   0,   0,   2,   2},
+   {  2,   1,   0,   0,   1},
+   {  1,  -1,   2,   4,   2},
+   {  1,   0,   4,   0,   2},
+   {  1,   2,   0,   0,   0},
+   {  1,   1,   0,  -1,   0},
+   {  1,  -1,  -2,   2,  -2},
+   {  3,   0,   2,   2,   1},
+   {  1,   2,   0,  -2,   1},
+   {  2,   1,   0,   0,  -1},
+   {  1,   1,   2,   2,   1},
+   {  0,   0,   3,   0,   3},
+   {  2,   1,   2,   2,   2},
+   {  3,   0,   2,  -4,   2},
+   {  2,   0,   0,  -1,   0},
+   {  2,  -1,  -2,  -2,  -2},
+   {  0,   0,   0,   0,   3},
+   {  2,   0,   2,   4,   2},
+   {  3,   0,  -2,  -2,  -1},
+   {  2,   1,  -2,   0,   0},
+   {  0,   0,   2,  -3,   1},
+   {  0,   0,   2,  -4,   2},
+   {  1,  -1,  -2,  -4,  -2},
+   {  1,  -2,   2,   2,   2},
+   {  1,   0,   2,   4,   1},
+   {  1,   0,  -4,  -2,  -2},
+   {  3,   1,   2,  -2,   2},
+   {  0,   0,   1,   0,   2},
+   {  1,   0,   0,   1,  -1},
+   {  1,   2,   0,  -2,  -1},
+   {  1,   1,   0,   1,   0},
+   {  0,   1,   2,  -2,  -1},
+   {  2,  -1,   0,   2,   0},
+   {  2,  -1,   0,   0,  -1},
+   {  1,   0,  -2,  -6,  -2},
+   {  1,   1,  -2,  -4,  -1},
+   {  2,   0,   2,  -4,   2},
+   {  3,   0,   0,   2,   0},
+   {  1,  -2,  -2,  -2,  -2},
+   {  1,   0,   0,  -1,  -2},
+   {  2,   0,   0,  -3,   0},
+   {  0,   0,   4,   0,   1},
+   {  1,   0,   0,   4,   1},
+   {  1,   1,   0,   2,   1},
+   {  0,   1,  -2,   2,   1},
+   {  0,   1,   4,  -2,   2},
+   {  0,   0,   2,   3,   2},
+   {  2,   0,   4,  -2,   2},
+   {  2,  -1,   0,   0,   1},
+   {  0,   0,   0,   4,  -1},
+   {  1,   0,   2,  -3,   2},
+   {  2,   0,  -2,  -2,   0},
+   {  1,  -1,   0,   2,   1},
+   {  2,  -1,   0,  -2,   1},
+   {  1,   0,  -2,   1,   0},
+   {  1,  -1,   0,   2,  -1},
+   {  1,   0,  -2,   2,   1},
+   {  1,   0,  -2,   1,  -2},
+   {  2,   0,  -2,  -6,  -2},
+   {  1,   0,   2,  -2,  -1},
+   {  2,  -2,   0,  -2,  -1},
+   {  2,   0,  -4,  -2,  -2},
+   {  0,   0,   4,  -4,   2},
+   {  3,   0,  -2,  -2,  -2},
+   {  0,   1,   0,  -4,   0},
+   {  1,  -1,   2,  -2,   1},
+   {  1,   0,   4,  -2,   1},
+   {  1,   0,   2,  -1,   1},
+   {  2,   1,   2,  -2,   1},
+   {  2,   0,   2,   1,   2},
+   {  1,   2,   2,  -2,   2},
+   {  0,   1,   2,   1,   1},
+   {  4,   0,   2,   0,   1},
+   {  1,   1,   2,  -4,   1},
+   {  2,   0,   0,   2,  -1},
+   {  1,  -2,   0,  -2,   0},
+   {  1,   0,   2,  -3,   1},
+   {  0,   0,   1,   0,   0},
+   {  1,   0,   2,  -4,   0},
+   {  1,  -2,   2,   0,   2},
+   {  2,  -1,   2,  -2,   2},
+   {  1,   1,  -2,   2,  -1},
+   {  1,   1,   2,   1,   2},
+   {  3,   1,   2,   0,   2},
+   {  0,   0,   2,  -2,   3},
+   {  0,   1,   0,   1,  -1},
+   {  0,   1,   0,   2,  -1},
+   {  1,   0,   2,   2,   0},
+   {  0,   1,   0,   1,   1},
+   {  1,   0,   0,   4,   0},
+   {  2,   0,   0,   0,  -2},
+   {  1,  -2,   0,   0,   0},
+   {  2,   0,   2,  -2,   0},
+   {  3,  -1,   2,   0,   2},
+   {  1,   0,  -1,   0,  -3},
+   {  1,   0,   2,   1,   1},
+   {  0,   2,  -2,   2,   0},
+   {  2,   1,  -2,  -2,  -2},
+   {  4,   0,   0,   0,   0},
+   {  2,  -1,   0,  -2,   0},
+   {  0,   2,   0,   0,  -1},
+   {  2,   0,   2,  -1,   2},
+   {  1,   0,   0,  -3,   0},
+   {  1,   1,   0,   2,   0},
+   {  1,   1,  -2,   0,  -1},
+   {  1,   0,   2,  -4,   2},
+   {  2,   1,   2,   0,   1},
+   {  1,  -1,   0,  -2,   1},
+   {  1,  -1,   2,  -2,   2},
+   {  0,   2,   2,   0,   2},
+   {  1,   1,  -2,   1,  -1},
+   {  2,   1,   0,  -4,   0},
+   {  2,   0,  -4,   0,  -2},
+   {  0,   0,   2,   0,   3},
+   {  1,   0,  -2,  -1,  -2},
+   {  2,  -1,   2,   0,   1},
+   {  3,   0,  -2,   0,  -1},
+   {  0,   2,  -2,   0,  -2},
+   {  2,   0,  -2,   2,  -1},
+   {  1,  -1,   0,  -2,  -2},
+   {  2,   0,   0,   0,   2},
+   {  1,   0,  -2,  -3,  -2},
+   {  0,   1,  -2,  -4,  -2},
+   {  2,  -1,   2,   2,   2},
+   {  3,   0,   0,   0,   1},
+   {  0,   1,   2,   2,   1},
+   {  1,   0,  -4,   2,  -2},
+   {  0,   1,  -2,   1,  -2},
+   {  1,  -1,  -2,  -2,  -1},
+   {  2,  -1,  -2,   0,  -1},
+   {  2,   1,   0,  -2,   1},
+   {  1,   0,   2,   0,  -1},
+   {  0,   2,   2,  -2,   1},
+   {  2,   0,   0,  -2,   2},
+   {  1,   1,   0,  -4,   0},
+   {  1,   2,  -2,  -2,  -2},
+   {  0,   2,   0,   0,   1},
+   {  1,  -1,  -2,   0,  -1},
+   {  1,  -1,   2,   2,   1},
+   {  3,   0,   0,  -4,   0},
+   {  2,   1,  -2,  -4,  -2},
+   {  2,   1,  -2,   0,  -1},
+   {  4,   0,   2,  -2,   2},
+   {  2,   0,   2,  -4,   1},
+   {  1,   0,   0,  -4,   1},
+   {  2,   0,   0,  -4,   1},
+   {  0,   0,   0,   2,  -2},
+   {  1,  -1,  -2,   2,  -1},
+   {  2,   0,   0,   2,   1},
+   {  0,   0,   2,  -1,   1},
+   {  1,  -1,   0,  -2,  -1},
+   {  0,   2,  -2,  -2,  -2},
+   {  0,   0,   2,   4,   1},
+   {  3,   0,   2,   2,   2},
+   {  2,   0,   0,  -4,  -1},
+   {  3,   0,   0,   0,  -1},
+   {  1,   1,   2,   2,   2},
+   {  1,   0,   0,  -1,   1},
+   {  0,   2,   0,  -2,   0},
+   {  2,   1,   0,  -2,  -1},
+   {  2,  -2,   0,  -2,   0},
+   {  0,   0,   4,  -2,   1},
+   {  1,   1,  -2,   0,  -2},
+   {  1,   0,   2,   4,   2},
+   {  3,   0,   2,  -2,   1},
+   {  0,   0,   0,   4,   1},
+   {  0,   1,   0,  -2,  -1},
+   {  1,   1,  -2,  -4,  -2},
+   {  2,   0,   0,  -2,  -2},
+   {  0,   0,   2,  -4,   1},
+   {  0,   0,   4,   0,   2},
+   {  0,   3,   0,   0,   0},
+   {  1,   2,   0,  -2,   0},
+   {  0,   0,   2,  -3,   2},
+   {  2,   1,   0,   0,   0},
+   {  2,   0,   2,   2,   1},
+   {  1,   0,   0,  -4,  -1},
+   {  1,   0,  -4,   0,  -1},
+   {  0,   1,   0,   2,   1},
+   {  1,   0,   0,   1,   0},
+   {  1,   0,  -1,   0,   0},
+   {  2,   0,  -2,  -4,  -1},
+   {  2,   0,   2,   0,   0},
+   {  1,   1,   0,   0,  -1},
+   {  1,   0,   4,  -2,   2},
+   {  0,   1,   2,   1,   2},
+   {  2,   1,   2,  -2,   2},
+   {  2,  -1,   0,   0,   0},
+   {  4,   0,   2,   0,   2},
+   {  2,   0,  -2,  -2,  -1},
+   {  0,   0,   1,   0,   1},
+   {  1,   0,  -2,   1,  -1},
+   {  1,   1,   2,  -2,   1},
+   {  0,   0,   2,   2,   0},
+   {  1,   0,  -2,  -4,  -1},
+   {  1,   0,  -2,   0,   1},
+   {  1,   0,   0,  -2,   2},
+   {  0,   0,   2,   1,   1},
+   {  1,   0,   2,  -1,   2},
+   {  1,   0,   2,   1,   2},
+   {  1,  -1,   0,   2,   0},
+   {  0,   0,   0,   4,   0},
+   {  1,  -1,   0,   0,  -1},
+   {  1,   0,  -2,   2,  -2},
+   {  0,   0,   0,   1,  -1},
+   {  0,   1,   0,   1,   0},
+   {  0,   1,   0,  -2,   1},
+   {  1,   0,  -1,   0,  -2},
+   {  1,   0,  -2,   2,   0},
+   {  1,   0,   0,  -2,  -2},
+   {  1,   1,   2,   0,   1},
+   {  2,   0,   0,   2,   0},
+   {  1,   1,   0,   0,   1},
+   {  2,   1,   2,   0,   2},
+   {  0,   3,   2,  -2,   2},
+   {  1,   0,  -2,  -2,   0},
+   {  0,   0,   0,   1,   1},
+   {  0,   1,   2,  -2,   0},
+   {  0,   1,   0,   2,   0},
+   {  1,  -1,  -2,   0,  -2},
+   {  1,  -1,   2,   0,   1},
+   {  0,   0,   0,   2,   2},
+   {  2,  -1,   2,   0,   2},
+   {  0,   1,  -2,  -2,  -1},
+   {  1,   0,   2,  -4,   1},
+   {  1,   1,  -2,  -2,  -1},
+   {  1,   0,   2,  -2,   0},
+   {  0,   1,   2,   2,   2},
+   {  3,   0,   2,   0,   1},
+   {  1,  -1,  -2,  -2,  -2},
+   {  1,   0,   0,   2,  -1},
+   {  1,  -1,   2,   2,   2},
+   {  0,   1,   0,   0,  -2},
+   {  0,   1,  -2,   2,   0},
+   {  1,  -1,   0,   0,   1},
+   {  1,  -1,   0,  -1,  -2},
+   {  1,  -1,   0,  -2,   0},
+   {  1,   1,   0,  -2,   1},
+   {  2,   1,   0,  -2,   0},
+   {  0,   0,   2,   4,   2},
+   {  0,   0,   2,  -1,   2},
+   {  0,   1,   0,   0,   2},
+   {  0,   1,  -2,   0,  -1},
+   {  0,   0,   2,   0,  -1},
+   {  2,   0,  -2,   0,   1},
+   {  1,   1,   0,  -2,  -1},
+   {  2,   0,   0,  -4,   0},
+   {  0,   1,   2,   0,   1},
+   {  1,   0,   0,  -4,   0},
+   {  0,   0,   4,  -2,   2},
+   {  3,   0,   2,  -2,   2},
+   {  0,   0,   2,  -2,  -1},
+   {  1,   0,   0,   2,   1},
+   {  3,   0,   0,   0,   0},
+   {  2,   0,   2,   2,   2},
+   {  1,   0,   0,  -1,  -1},
+   {  2,   0,   2,  -2,   1},
+   {  1,   0,  -4,   0,  -2},
+   {  2,   0,  -2,  -4,  -2},
+   {  1,   1,   2,  -2,   2},
+   {  2,   0,  -2,  -2,  -2},
+   {  1,   0,   0,   0,  -2},
+   {  0,   2,  -2,   2,  -1},
+   {  1,   0,   2,   2,   1},
+   {  1,  -1,   0,  -1,  -1},
+   {  1,   0,  -2,  -4,  -2},
+   {  0,   0,   2,   1,   2},
+   {  1,   0,  -1,   0,  -1},
+   {  1,   0,   0,   0,   2},
+   {  1,  -1,   0,  -1,   0},
+   {  1,   0,   2,   0,   0},
+   {  1,   0,  -2,   2,  -1},
+   {  1,   1,   0,   0,   0},
+   {  2,   0,   0,   0,   1},
+   {  1,   1,   2,   0,   2},
+   {  0,   1,  -2,  -2,  -2},
+   {  2,   0,   0,   0,  -1},
+   {  1,   0,  -2,   0,   0},
+   {  1,   1,  -2,  -2,  -2},
+   {  1,  -1,   2,   0,   2},
+   {  0,   0,   0,   1,   0},
+   {  3,   0,   2,   0,   2},
+   {  1,   0,   0,  -1,   0},
+   {  0,   1,   0,  -2,   0},
+   {  2,   0,  -2,   0,  -2},
+   {  0,   1,  -1,   1,  -1},
+   {  1,  -1,   0,   0,   0},
+   {  0,   1,   2,  -2,   1},
+   {  1,   0,   0,   2,   0},
+   {  2,   0,   0,  -2,   1},
+   {  1,   1,   0,  -2,   0},
+   {  0,   1,  -2,   2,  -1},
+   {  0,   0,   0,   2,  -1},
+   {  2,   0,   2,   0,   1},
+   {  2,   0,   2,  -2,   2},
+   {  2,   0,   0,  -2,  -1},
+   {  1,   0,   2,  -2,   1},
+   {  0,   0,   0,   2,   1},
+   {  0,   1,  -2,   0,  -2},
+   {  0,   0,   2,   2,   1},
+   {  2,   0,  -2,   0,   0},
+   {  0,   1,   2,   0,   2},
+   {  1,   0,   2,   2,   2},
+   {  1,   0,  -2,  -2,  -1},
+   {  0,   2,   0,   0,   0},
+   {  0,   1,   0,   0,  -1},
+   {  1,   0,   0,  -2,   1},
+   {  0,   0,   2,  -2,   0},
+   {  0,   2,   2,  -2,   2},
+   {  1,   0,   0,  -2,  -1},
+   {  0,   1,   0,   0,   1},
+   {  0,   0,   2,   0,   0},
+   {  2,   0,   0,   0,   0},
+   {  1,   0,  -2,   0,  -1},
+   {  1,   0,   2,  -2,   2},
+   {  2,   0,   2,   0,   2},
+   {  0,   2,  -2,   2,  -2},
+   {  2,   0,   0,  -2,   0},
+   {  0,   0,   2,   2,   2},
+   {  0,   0,   0,   2,   0},
+   {  2,   0,  -2,   0,  -1},
+   {  1,   0,   2,   0,   1},
+   {  1,   0,  -2,  -2,  -2},
+   {  1,   0,   0,   0,  -1},
+   {  1,   0,   0,   0,   1},
+   {  1,   0,   0,  -2,   0},
+   {  1,   0,  -2,   0,  -2},
+   {  0,   0,   2,  -2,   1},
+   {  0,   1,  -2,   2,  -2},
+   {  1,   0,   2,   0,   2},
+   {  0,   0,   2,   0,   1},
+   {  1,   0,   0,   0,   0},
+   {  0,   1,   2,  -2,   2},
+   {  0,   1,   0,   0,   0},
+   {  0,   0,   0,   0,   2},
+   {  0,   0,   2,   0,   2},
+   {  0,   0,   2,  -2,   2},
+   {  0,   0,   0,   0,   1}
+};
+
+/* CIP X,Y: the number of amplitudes at each frequency (same order as the multipliers), then the amplitudes (microarcsec). */
+const unsigned char terse_alternate_xy_count[XY_PL_N + XY_LS_N] = {
+   3, 1, 3, 3, 1, 3, 1, 1, 3, 1, 3, 3, 1, 3, 3, 1, 1, 1, 1, 1,
+   1, 1, 1, 3, 1, 3, 1, 3, 1, 1, 1, 1, 3, 1, 3, 1, 3, 1, 1, 3,
+   1, 1, 1, 3, 1, 1, 1, 1, 3, 1, 3, 3, 3, 1, 3, 1, 3, 1, 1, 1,
+   1, 1, 3, 1, 1, 1, 1, 1, 1, 3, 3, 1, 3, 3, 1, 1, 1, 1, 3, 3,
+   3, 1, 4, 4, 2, 4, 2, 4, 2, 2, 2, 1, 3, 1, 3, 3, 1, 3, 3, 1,
+   3, 3, 3, 3, 1, 1, 3, 3, 1, 1, 1, 1, 1, 1, 4, 3, 1, 3, 3, 1,
+   1, 3, 1, 3, 3, 1, 1, 3, 4, 2, 3, 2, 2, 4, 2, 2, 2, 4, 2, 4,
+   4, 4, 3, 4, 2, 2, 2, 4, 2, 4, 3, 4, 2, 2, 2, 2, 2, 2, 4, 2,
+   2, 1, 3, 1, 1, 2, 4, 4, 4, 4, 4, 2, 2, 4, 2, 4, 4, 4, 2, 2,
+   4, 4, 4, 2, 2, 4, 4, 4, 2, 2, 2, 2, 4, 2, 4, 2, 4, 4, 4, 4,
+   1, 1, 4, 2, 4, 2, 2, 2, 4, 3, 4, 2, 2, 2, 2, 2, 4, 2, 4, 4,
+   4, 4, 4, 2, 4, 4, 3, 2, 4, 1, 3, 1, 3, 4, 4, 3, 3, 4, 4, 4,
+   3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2, 4, 4, 2, 2, 4, 4, 4,
+   4, 4, 2, 2, 2, 2, 4, 4, 2, 2, 4, 2, 4, 2, 4, 3, 4, 1, 1, 2,
+   2, 4, 4, 4, 2, 4, 4, 4, 4, 2, 2, 4, 4, 4, 3, 3, 2, 3, 4, 4,
+   4, 3, 4, 1, 2, 2, 4, 4, 4, 2, 4, 3, 4, 4, 4, 4, 2, 2, 4, 2,
+   4, 2, 1, 1, 1, 4, 4, 4, 4, 4, 3, 4, 4, 3, 4, 4, 4, 4, 2, 2,
+   4, 4, 3, 4, 4, 4, 4, 3, 1, 1, 4, 4, 2, 4, 4, 4, 4, 4, 4, 3,
+   4, 4, 4, 3, 4, 2, 4, 3, 3, 4, 4, 2, 3, 2, 4, 4, 4, 4, 3, 4,
+   4, 4, 4, 4, 3, 3, 2, 2, 4, 4, 1, 1, 4, 2, 4, 4, 4, 4, 2, 2,
+   3, 4, 4, 4, 4, 2, 3, 3, 4, 4, 2, 4, 3, 3, 4, 4, 4, 4, 4, 4,
+   3, 3, 4, 4, 4, 2, 2, 4, 1, 2, 4, 4, 4, 4, 3, 3, 4, 1, 4, 3,
+   4, 2, 2, 1, 3, 4, 3, 3, 4, 2, 4, 4, 4, 4, 4, 4, 3, 2, 4, 4,
+   4, 3, 3, 1, 4, 3, 4, 3, 4, 4, 2, 4, 4, 4, 4, 4, 3, 4, 4, 4,
+   4, 1, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 4, 4, 4, 2, 2, 4, 4, 3,
+   3, 3, 2, 4, 4, 4, 4, 3, 4, 3, 4, 2, 4, 4, 4, 1, 4, 4, 4, 4,
+   4, 3, 4, 4, 1, 4, 4, 4, 4, 4, 1, 2, 3, 4, 4, 4, 4, 3, 3, 1,
+   4, 4, 3, 2, 4, 4, 4, 2, 1, 4, 3, 8, 4, 2, 4, 4, 4, 4, 4, 4,
+   7, 2, 2, 4, 7, 8, 7, 7, 7, 2, 8, 7, 7, 6, 7, 7, 8, 8, 8, 5,
+   8, 6, 8, 8, 8, 6, 8, 6, 8, 8, 8, 8, 8, 6, 8, 6, 6, 8, 8, 8,
+   7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 6, 8, 6, 8, 8, 8, 8, 8,
+   8, 6, 8, 7, 8, 8, 6, 8, 7, 8, 7, 8, 8, 8, 8, 6, 8, 8, 8, 7,
+   8, 8, 7, 8, 8, 8, 8, 8, 6, 6, 8, 7, 8, 7, 8, 12, 1, 2, 1, 1,
+   1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+   1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1,
+   1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 3, 1, 2, 2, 2, 2, 2, 4, 2,
+   2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 2,
+   2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+   2, 2, 2, 2, 2, 2, 2, 2, 3, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+   2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 4, 1, 1,
+   1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+   2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 1, 1,
+   1, 1, 1, 1, 4, 2, 2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+   2, 1, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 1, 1, 2, 2,
+   4, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 2,
+   2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 1, 1, 2, 1,
+   2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 1, 1, 2, 2, 4, 2, 2, 2, 2,
+   2, 2, 4, 2, 2, 4, 2, 2, 1, 1, 2, 2, 2, 2, 1, 2, 2, 4, 1, 2,
+   2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 1, 1, 2, 2, 2,
+   2, 2, 4, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2,
+   2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2,
+   2, 1, 2, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+   2, 2, 2, 2, 2, 2, 4, 2, 3, 1, 2, 2, 2, 2, 2, 4, 2, 2, 3, 2,
+   2, 2, 1, 2, 2, 4, 2, 1, 2, 2, 4, 2, 2, 2, 4, 2, 2, 2, 2, 2,
+   2, 2, 6, 2, 3, 2, 2, 2, 4, 2, 5, 2, 2, 3, 3, 2, 2, 2, 2, 5,
+   5, 5, 5, 5, 5, 6, 5, 5, 5, 5, 6, 5, 7, 6, 5, 5, 5, 6, 5, 6,
+   5, 6, 6, 6, 7, 6, 6, 6, 8, 6, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6,
+   6, 6, 6, 6, 6, 6, 7, 6, 6, 6, 6, 8, 6, 6, 6, 7, 7, 7, 6, 7,
+   6, 8, 6, 7, 6, 7, 7, 7, 7, 7, 7, 6, 6, 7, 7, 7, 6, 6, 8, 6,
+   7, 7, 6, 7, 7, 7, 7, 7, 6, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7,
+   7, 7, 7, 7, 6, 7, 7, 6, 7, 6, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7,
+   7, 7, 7, 7, 8, 8, 8, 7, 7, 7, 7, 7, 7, 7, 8, 7, 8, 7, 8, 7,
+   6, 8, 8, 7, 7, 8, 8, 8, 7, 8, 8, 7, 8, 8, 8, 7, 8, 8, 7, 8,
+   7, 8, 7, 8, 8, 8, 8, 7, 7, 8, 8, 9, 12, 8, 10, 9, 12, 12, 9, 12,
+   12, 12, 9, 9, 12, 12, 12, 12, 9, 12, 9, 12, 12, 11, 12, 12, 9, 12, 12, 12,
+   12, 12, 12, 12, 14, 14, 14, 16, 20
+};
+const double terse_alternate_xy_amp[XY_AMP_N] = {
+   0.04, 0.00, 0.08, 0.12, 0.12, 0.00,
+   0.00, 0.12, 0.00, 0.00, 0.12, 0.12,
+   0.00, 0.00, 0.12, -0.12, -0.12, 0.00,
+   0.00, -0.12, -0.12, 0.00, 0.00, 0.12,
+   0.00, 0.00, 0.12, -0.12, 0.00, 0.00,
+   -0.12, 0.00, 0.00, -0.12, -0.12, 0.12,
+   0.12, -0.12, -0.12, -0.12, -0.12, 0.12,
+   0.00, 0.00, -0.12, -0.12, 0.00, 0.00,
+   -0.12, 0.12, 0.00, 0.00, 0.12, -0.12,
+   -0.12, -0.12, -0.12, 0.00, 0.00, 0.12,
+   0.12, 0.00, 0.00, -0.12, -0.12, 0.00,
+   0.00, -0.12, -0.12, -0.12, 0.00, 0.00,
+   -0.12, 0.12, 0.12, 0.12, 0.00, 0.00,
+   0.12, -0.12, -0.12, 0.12, -0.12, 0.00,
+   0.00, -0.12, 0.12, 0.00, 0.00, 0.12,
+   0.00, 0.00, 0.12, 0.00, 0.00, 0.12,
+   -0.12, 0.00, 0.00, -0.12, -0.12, 0.00,
+   0.00, -0.12, -0.12, 0.12, 0.12, -0.12,
+   0.12, 0.00, 0.00, -0.12, -0.12, 0.12,
+   0.12, -0.12, -0.12, 0.12, 0.00, 0.00,
+   0.12, 0.00, 0.00, 0.12, 0.12, 0.00,
+   0.00, 0.12, 0.00, 0.00, 0.12, 0.12,
+   0.12, 0.12, 0.12, 0.00, 0.00, -0.12,
+   0.00, 0.00, 0.12, 0.00, 0.00, 0.12,
+   0.10, 0.12, 0.00, 0.00, -0.10, -0.12,
+   0.00, 0.00, -0.10, 0.12, 0.10, 0.12,
+   0.00, 0.00, 0.10, -0.12, 0.10, 0.12,
+   0.00, 0.00, 0.10, 0.12, -0.10, 0.12,
+   0.10, 0.12, -0.16, -0.16, 0.00, 0.00,
+   -0.16, -0.16, 0.00, 0.00, 0.16, 0.00,
+   0.00, -0.16, -0.16, 0.00, 0.00, -0.16,
+   0.00, 0.00, 0.16, 0.16, 0.00, 0.00,
+   0.16, 0.00, 0.00, 0.16, 0.00, 0.00,
+   -0.16, 0.00, 0.00, -0.16, -0.16, -0.16,
+   0.00, 0.00, -0.16, 0.00, 0.00, -0.16,
+   -0.16, -0.16, -0.16, -0.16, 0.16, 0.10,
+   0.00, -0.10, 0.12, 0.20, 0.00, 0.00,
+   0.20, -0.16, 0.00, 0.12, -0.20, 0.00,
+   0.00, -0.20, 0.20, 0.20, 0.00, 0.00,
+   0.20, -0.20, 0.00, 0.00, -0.20, 0.00,
+   0.00, 0.20, -0.20, 0.16, 0.00, -0.16,
+   0.20, 0.12, 0.00, 0.00, -0.20, -0.12,
+   0.20, 0.00, 0.12, 0.20, 0.12, -0.20,
+   0.12, -0.20, 0.12, 0.00, 0.00, -0.20,
+   -0.12, 0.20, 0.12, -0.20, 0.12, -0.20,
+   0.12, 0.00, 0.00, -0.20, -0.12, -0.20,
+   -0.12, 0.00, 0.00, -0.20, -0.12, 0.00,
+   0.00, 0.20, -0.12, 0.00, 0.00, 0.12,
+   0.00, 0.20, 0.20, 0.12, 0.00, 0.00,
+   -0.20, 0.12, 0.20, -0.12, 0.20, -0.12,
+   0.20, 0.12, 0.00, 0.00, -0.20, 0.12,
+   -0.20, -0.12, 0.00, 0.00, -0.20, 0.00,
+   0.12, 0.20, 0.12, 0.00, 0.00, 0.20,
+   -0.12, -0.20, 0.12, 0.20, 0.12, 0.20,
+   0.12, 0.20, 0.12, -0.20, 0.12, 0.20,
+   0.12, 0.00, 0.00, -0.20, -0.12, -0.20,
+   0.12, 0.24, 0.24, 0.00, 0.00, 0.24,
+   -0.24, 0.20, -0.15, 0.20, -0.12, -0.10,
+   0.00, 0.20, 0.12, -0.10, 0.00, -0.10,
+   0.00, -0.20, 0.12, -0.20, 0.12, 0.10,
+   0.00, 0.20, -0.16, 0.00, 0.00, 0.20,
+   0.16, -0.20, 0.16, 0.20, 0.16, 0.00,
+   0.00, 0.20, 0.16, 0.20, 0.16, 0.00,
+   0.00, -0.20, -0.16, 0.00, 0.00, -0.20,
+   -0.16, 0.00, 0.00, 0.20, 0.16, 0.20,
+   0.16, -0.20, 0.16, 0.00, 0.00, 0.20,
+   -0.16, 0.00, 0.00, -0.20, -0.16, 0.00,
+   0.00, -0.20, -0.16, -0.20, 0.16, -0.20,
+   -0.16, 0.00, 0.00, 0.20, 0.16, 0.00,
+   0.00, 0.20, 0.16, 0.00, 0.00, -0.20,
+   0.16, 0.20, -0.16, -0.20, 0.16, -0.20,
+   0.16, 0.20, 0.16, 0.00, 0.00, 0.20,
+   -0.16, 0.20, 0.16, 0.00, 0.00, -0.20,
+   0.16, -0.20, 0.16, -0.10, 0.00, -0.20,
+   -0.16, -0.10, 0.00, 0.20, -0.16, 0.10,
+   0.00, -0.10, 0.00, -0.20, 0.16, -0.28,
+   0.28, -0.10, -0.12, -0.20, 0.12, 0.20,
+   0.20, 0.20, 0.20, 0.00, 0.00, -0.20,
+   -0.20, -0.20, -0.20, 0.20, -0.20, 0.20,
+   -0.20, 0.00, 0.00, -0.20, 0.00, 0.20,
+   0.20, -0.20, 0.00, 0.00, -0.20, -0.20,
+   -0.20, 0.20, 0.20, -0.20, 0.20, -0.20,
+   0.20, -0.20, 0.20, -0.20, 0.00, 0.00,
+   0.20, 0.20, 0.20, -0.16, -0.10, -0.12,
+   -0.20, -0.16, 0.10, -0.12, -0.10, 0.00,
+   0.20, 0.20, 0.10, 0.12, -0.20, 0.16,
+   0.20, -0.24, 0.00, 0.00, -0.20, -0.24,
+   0.20, 0.24, 0.00, 0.00, -0.20, -0.24,
+   0.00, 0.00, -0.24, 0.00, 0.20, 0.20,
+   0.24, -0.20, -0.24, 0.00, 0.00, 0.32,
+   0.32, 0.00, 0.00, 0.32, -0.32, 0.00,
+   0.00, 0.20, -0.20, 0.10, 0.12, -0.10,
+   0.12, -0.20, -0.20, -0.12, 0.00, 0.32,
+   -0.28, 0.00, 0.20, 0.21, 0.22, 0.10,
+   -0.13, -0.20, -0.16, -0.20, 0.12, 0.20,
+   -0.24, 0.10, 0.12, 0.36, 0.00, 0.00,
+   0.36, 0.00, 0.00, 0.30, -0.20, 0.00,
+   0.00, 0.30, -0.20, 0.00, 0.00, -0.30,
+   -0.20, 0.00, 0.00, -0.30, 0.20, 0.00,
+   0.00, 0.30, 0.20, 0.00, 0.00, 0.30,
+   0.20, 0.00, 0.00, 0.30, 0.20, 0.00,
+   0.00, 0.30, 0.20, 0.00, 0.00, -0.30,
+   0.20, -0.30, -0.20, -0.30, -0.20, 0.30,
+   0.20, 0.00, 0.00, 0.30, -0.20, 0.00,
+   0.00, 0.30, 0.20, 0.30, 0.20, 0.20,
+   0.16, 0.20, -0.16, 0.20, 0.12, -0.20,
+   0.20, -0.30, 0.20, 0.10, 0.00, 0.20,
+   -0.32, 0.00, 0.00, -0.20, -0.16, 0.20,
+   -0.20, 0.30, -0.24, 0.30, -0.24, 0.30,
+   0.24, -0.30, 0.24, 0.30, 0.24, 0.00,
+   0.00, -0.30, 0.24, 0.00, 0.00, -0.30,
+   0.24, 0.30, -0.24, 0.30, -0.24, 0.00,
+   0.00, 0.30, -0.24, 0.30, -0.24, 0.00,
+   0.00, -0.30, -0.24, -0.10, -0.12, 0.30,
+   -0.20, 0.36, 0.00, 0.16, -0.10, 0.00,
+   0.30, -0.24, 0.40, 0.40, 0.30, -0.28,
+   -0.30, 0.28, 0.30, -0.28, 0.00, 0.00,
+   0.30, 0.28, 0.00, 0.00, -0.30, -0.28,
+   0.00, 0.00, 0.30, -0.28, -0.30, -0.28,
+   0.00, 0.00, 0.30, 0.28, 0.00, 0.00,
+   -0.30, -0.28, 0.00, 0.00, -0.30, -0.28,
+   0.00, 0.00, 0.30, -0.28, -0.30, -0.28,
+   0.10, 0.12, 0.30, -0.24, 0.30, -0.28,
+   0.00, -0.12, 0.30, 0.20, -0.20, 0.12,
+   0.24, 0.00, 0.36, -0.36, 0.00, 0.24,
+   0.30, -0.32, 0.44, 0.00, 0.00, 0.20,
+   -0.16, 0.30, 0.20, 0.20, -0.12, 0.30,
+   0.24, -0.20, 0.16, 0.30, 0.24, 0.16,
+   0.00, 0.44, 0.30, 0.24, 0.20, -0.20,
+   -0.48, -0.40, -0.28, 0.40, 0.28, -0.40,
+   -0.28, 0.00, 0.00, -0.40, 0.28, 0.00,
+   0.00, -0.40, 0.28, 0.00, 0.00, -0.40,
+   0.28, -0.30, -0.28, 0.20, -0.20, -0.48,
+   0.00, -0.16, -0.30, 0.32, 0.20, 0.16,
+   0.40, 0.32, 0.00, 0.00, -0.40, -0.32,
+   0.00, 0.00, 0.40, 0.32, 0.00, 0.00,
+   0.40, 0.32, 0.40, -0.32, -0.40, -0.32,
+   0.00, 0.00, -0.40, 0.32, 0.40, 0.32,
+   0.00, 0.00, -0.40, 0.32, 0.52, -0.52,
+   -0.52, 0.10, 0.00, 0.40, -0.32, -0.40,
+   -0.32, -0.10, 0.00, 0.40, 0.32, 0.10,
+   0.00, 0.30, -0.24, 0.30, 0.20, -0.40,
+   0.32, 0.10, 0.12, -0.16, -0.40, 0.32,
+   0.40, 0.36, 0.00, 0.00, -0.40, 0.28,
+   0.20, 0.12, 0.44, 0.00, 0.32, 0.10,
+   0.00, 0.40, -0.36, 0.40, 0.36, -0.10,
+   0.00, 0.40, 0.36, 0.10, 0.00, 0.10,
+   0.12, 0.40, -0.36, 0.40, -0.40, -0.40,
+   -0.40, 0.40, 0.40, 0.00, 0.00, -0.20,
+   -0.16, -0.40, 0.32, -0.12, 0.00, 0.56,
+   0.40, 0.32, 0.20, -0.16, 0.20, 0.16,
+   0.40, -0.32, -0.20, 0.20, -0.50, 0.00,
+   0.40, 0.40, -0.10, 0.12, 0.52, 0.00,
+   0.28, 0.60, -0.60, 0.40, -0.36, 0.20,
+   0.20, 0.10, -0.12, -0.50, -0.32, -0.50,
+   -0.36, -0.50, -0.36, 0.00, 0.00, -0.40,
+   0.40, 0.20, 0.16, -0.40, -0.36, -0.20,
+   0.24, -0.10, 0.00, 0.50, 0.36, -0.50,
+   0.36, -0.10, 0.00, 0.50, 0.36, 0.10,
+   0.00, 0.28, 0.00, 0.56, -0.50, -0.40,
+   0.00, 0.00, 0.50, -0.40, 0.00, 0.00,
+   0.10, 0.00, 0.50, -0.40, 0.64, 0.00,
+   0.12, -0.50, -0.36, 0.20, -0.12, 0.50,
+   0.44, -0.50, 0.44, 0.00, 0.00, -0.20,
+   0.00, 0.64, -0.24, 0.00, 0.64, 0.40,
+   -0.40, 0.30, 0.24, -0.10, -0.12, -0.50,
+   0.44, -0.40, 0.56, -0.12, 0.00, 0.68,
+   0.50, -0.48, 0.50, 0.48, 0.00, 0.00,
+   -0.50, -0.36, 0.30, -0.12, 0.50, 0.48,
+   -0.10, 0.12, -0.30, -0.20, 0.50, -0.36,
+   0.32, 0.00, 0.64, -0.50, -0.44, 0.20,
+   -0.20, -0.20, 0.20, -0.50, -0.44, 0.20,
+   0.20, 0.50, -0.44, 0.50, -0.44, -0.20,
+   -0.20, -0.60, -0.40, -0.10, 0.00, -0.12,
+   0.00, 0.72, -0.64, 0.00, 0.36, -0.60,
+   0.44, -0.60, 0.44, -0.30, -0.24, -0.50,
+   0.40, 0.50, 0.48, -0.20, 0.20, 0.76,
+   0.76, 0.10, -0.12, -0.60, -0.44, -0.60,
+   -0.48, -0.30, -0.24, 0.50, -0.44, 0.40,
+   0.36, -0.20, 0.52, 0.60, 0.48, -0.10,
+   0.12, -0.30, -0.24, -0.50, 0.48, 0.60,
+   -0.52, -0.60, -0.52, 0.76, 0.00, 0.24,
+   0.20, -0.12, 0.60, 0.48, -0.60, 0.48,
+   0.20, 0.12, -0.50, -0.48, -0.30, 0.28,
+   -0.50, 0.48, -0.30, -0.32, 0.60, -0.56,
+   0.80, 0.00, -0.24, 0.12, 0.00, 0.84,
+   0.60, 0.60, 0.00, 0.00, -0.50, -0.44,
+   -0.40, 0.36, -0.70, 0.52, -0.70, -0.52,
+   0.00, 0.00, -0.44, 0.00, -0.76, 0.88,
+   0.00, 0.00, -0.70, -0.52, 0.10, -0.12,
+   0.70, 0.56, 0.00, 0.00, -0.70, 0.52,
+   -0.20, -0.12, 0.70, 0.60, 0.00, 0.00,
+   0.70, 0.60, 0.00, 0.00, -0.30, 0.32,
+   0.60, 0.56, 0.44, 0.00, -0.84, 0.95,
+   0.00, 0.00, 0.40, 0.36, 0.60, -0.52,
+   0.10, -0.12, 0.70, 0.64, 0.60, -0.44,
+   -0.50, -0.36, -0.70, -0.68, -0.70, -0.68,
+   -0.40, 0.36, -0.60, -0.56, -0.99, -0.80,
+   0.59, 0.70, 0.68, -0.20, 0.16, 0.20,
+   0.12, -1.00, 0.00, -0.80, -0.60, -0.20,
+   0.16, 0.80, 0.60, -0.20, 0.16, 0.48,
+   0.00, 0.95, 0.88, 0.00, 0.60, -0.70,
+   -0.52, -0.50, 0.36, 1.07, -0.40, 0.36,
+   -0.70, -0.64, -0.36, 0.00, 1.03, -0.80,
+   -0.76, 0.00, 0.00, -0.80, 0.76, -0.90,
+   0.64, 1.11, 0.91, 0.00, -0.64, -0.40,
+   -0.28, -0.80, 0.60, -1.07, 0.00, 0.32,
+   -1.11, 0.00, -0.16, -0.70, -0.48, -0.60,
+   0.44, -0.90, 0.72, -0.80, -0.56, 0.50,
+   -0.36, -0.90, 0.68, -0.20, -0.16, -0.20,
+   -0.16, 0.90, -0.68, -0.90, -0.80, 0.00,
+   0.00, -0.40, -0.40, 0.80, -0.72, 0.40,
+   -0.32, 0.80, 0.76, 1.23, 0.00, 0.00,
+   1.00, -0.76, 1.00, 0.76, 0.00, 0.00,
+   1.00, 0.76, 0.00, 0.00, -1.00, 0.76,
+   0.20, 0.20, -1.19, 0.00, -0.52, 0.88,
+   0.00, -0.99, 1.35, 1.00, -0.95, 0.00,
+   0.00, 1.39, 0.00, 0.00, 1.10, 0.84,
+   0.20, -0.16, -0.28, 0.00, -1.39, 1.10,
+   0.84, -0.30, 0.20, -0.30, -0.24, 1.10,
+   -0.84, 1.10, -0.99, -0.20, 0.20, -1.10,
+   -0.95, -0.50, 0.48, 1.00, 0.88, -0.50,
+   -0.48, 1.00, -0.95, -1.20, -0.91, -0.30,
+   0.20, -1.00, -0.91, 0.20, 0.76, 1.35,
+   0.00, -0.80, -1.10, -0.84, 0.60, -0.44,
+   0.60, -0.44, 1.10, 0.84, -0.60, -0.44,
+   -1.10, 0.84, 1.20, 0.91, -0.40, 0.24,
+   1.59, 0.60, -0.52, 1.00, 0.95, -1.30,
+   0.92, 0.00, 0.00, 1.10, 0.95, -0.50,
+   0.44, 1.20, -1.07, 0.00, 0.00, -0.50,
+   -0.48, -1.10, 0.95, -1.20, -0.88, -0.50,
+   0.40, 1.30, 0.95, -0.20, 0.16, 0.30,
+   0.28, -1.30, 0.91, -1.55, 0.00, -0.56,
+   -1.10, 0.84, 0.70, 0.56, -1.30, 0.95,
+   -0.30, -0.24, -1.00, -0.76, 0.90, -0.68,
+   -0.60, -0.56, -1.10, 1.03, -1.30, 1.15,
+   -1.40, 1.07, 1.10, -0.95, -0.90, -0.44,
+   0.20, -0.24, -1.30, -1.19, -0.24, -1.30,
+   1.23, 1.43, 0.00, -1.11, 0.80, 0.00,
+   1.67, 1.50, -1.11, -1.40, -1.07, -0.50,
+   0.36, 1.50, 1.11, 0.20, -0.12, 1.50,
+   1.15, 0.00, 0.00, -1.40, -1.27, 0.10,
+   -0.12, 0.56, 0.00, -1.83, 1.50, 1.11,
+   0.40, -0.28, -0.88, 0.00, 1.79, 0.20,
+   -0.12, -1.60, -1.19, -1.50, -1.35, -1.30,
+   -1.15, -0.80, 0.72, -0.80, -0.72, -1.30,
+   1.19, 1.60, -1.23, -0.40, -0.32, 2.11,
+   -1.70, -1.27, 0.00, 0.00, -1.50, -1.43,
+   -0.40, 0.28, -1.70, -1.27, 0.40, -0.28,
+   -0.30, -0.28, 1.60, -1.47, -1.40, -1.27,
+   0.90, -0.84, 2.23, 0.00, 0.44, -1.80,
+   1.35, -0.40, -0.32, 0.80, 0.60, 1.70,
+   -1.27, 2.35, -1.90, 1.39, 0.50, 0.32,
+   -1.60, -1.15, 1.40, -1.03, 2.00, -1.79,
+   0.00, 0.00, 2.10, 1.59, 0.50, -0.40,
+   -0.10, 0.12, -2.20, -1.99, -2.98, 2.20,
+   2.03, 1.55, 0.00, -2.70, -2.50, 1.87,
+   -0.30, -0.24, -2.50, -1.87, 0.30, -0.24,
+   0.40, 0.32, -2.50, 1.87, -2.50, -1.87,
+   0.40, -0.32, -0.72, 0.00, -3.10, -3.10,
+   0.00, 0.84, 3.30, -0.70, -0.60, -2.40,
+   2.15, 2.60, -1.95, -0.70, -0.44, 0.60,
+   0.00, 3.30, -2.70, 1.99, 1.00, 0.91,
+   -2.30, 2.07, 1.90, 1.39, 2.00, -1.47,
+   -2.10, -1.91, 1.50, -1.39, -3.50, -0.20,
+   3.54, 0.50, -0.36, 2.80, 2.11, -3.46,
+   0.00, 0.88, -0.04, 0.00, 0.07, 0.00,
+   0.00, 1.79, 0.00, -3.10, -2.80, 2.07,
+   0.70, 0.52, -2.90, 2.15, 2.90, 2.15,
+   -0.30, 0.24, -2.90, 2.19, -0.60, -0.48,
+   0.70, -0.64, 2.80, 2.51, -2.90, 2.63,
+   -0.10, -0.12, 1.90, -3.42, -0.60, 0.00,
+   3.10, -2.35, -0.80, -0.56, -0.03, 0.00,
+   -0.07, -1.50, -1.11, -3.00, 2.27, 3.20,
+   -2.94, -3.20, -2.94, -0.60, -0.48, 3.50,
+   -2.63, 0.07, 0.00, 0.05, 3.00, 2.27,
+   2.10, -1.59, 0.05, 0.00, -0.09, 0.00,
+   0.00, -2.39, 0.00, 4.10, -0.08, 0.00,
+   -0.02, -3.70, -2.78, -1.10, 0.80, 0.02,
+   0.00, 0.09, 0.90, 0.68, 3.90, -2.90,
+   0.04, 0.00, 0.08, 1.80, -1.35, 3.60,
+   2.70, 3.80, -3.54, -0.12, 0.00, 0.00,
+   0.00, 0.00, 5.21, 0.00, 0.00, 0.02,
+   0.00, -0.09, 0.90, 0.68, -4.10, 3.02,
+   0.08, 0.00, -0.06, 3.50, 2.63, -2.50,
+   1.83, -0.12, 0.00, 0.00, 0.00, 0.00,
+   5.49, -0.02, 0.00, -0.11, -0.90, 0.68,
+   -4.70, -3.50, -0.02, 0.00, -0.11, -0.90,
+   -0.64, -4.80, 3.54, -0.04, 0.00, 0.13,
+   0.00, 0.00, 1.87, 0.00, -5.77, 0.06,
+   -0.07, -0.07, -0.08, -3.10, -2.82, -3.50,
+   3.18, 0.06, -0.07, 0.08, 0.08, -3.10,
+   -2.78, 3.70, -3.38, -0.12, 0.00, 0.00,
+   -5.30, 3.94, 0.08, -0.09, -0.06, -0.06,
+   -3.90, -3.62, -2.90, 2.67, 0.10, -0.11,
+   0.00, 0.00, -4.90, -4.49, 0.10, 0.11,
+   0.00, 0.00, 4.90, -4.53, 0.00, 0.00,
+   0.09, 0.10, 0.05, -0.06, 4.20, -3.82,
+   -2.70, -2.43, 0.10, -0.11, 0.00, 0.00,
+   -5.00, -4.53, 0.00, 0.00, 0.10, -0.11,
+   0.00, 0.00, -5.10, -4.65, -0.14, 0.00,
+   0.08, 0.00, 0.00, 6.09, 0.00, -3.42,
+   0.10, -0.12, 0.00, 0.00, -5.20, -4.69,
+   -0.09, -0.13, -0.02, 0.03, -5.60, 4.22,
+   1.40, 0.99, -0.09, -0.13, 0.02, -0.03,
+   -5.70, 4.22, -1.30, -0.99, 0.04, 0.00,
+   -0.11, -0.12, 0.00, -1.71, -5.40, 4.97,
+   -0.02, 0.02, 0.11, 0.12, 0.90, 0.84,
+   5.50, -5.05, 0.10, 0.11, -0.06, 0.06,
+   4.90, -4.46, 2.70, 2.47, 0.10, 0.14,
+   0.00, 0.00, 6.10, -4.53, 0.10, 0.10,
+   0.05, -0.09, 4.20, -4.65, -4.00, -2.23,
+   0.12, 0.13, 0.00, 0.00, 5.70, -5.29,
+   -0.10, -0.14, 0.00, 0.00, -6.30, 4.65,
+   0.10, -0.13, 0.04, 0.06, -5.90, -4.38,
+   2.60, -1.91, 0.06, 0.06, -0.11, 0.12,
+   2.70, -2.51, 5.50, 5.01, -0.10, 0.14,
+   -0.05, -0.06, 6.10, 4.53, -2.70, 2.03,
+   -0.01, -0.13, -0.14, -0.10, -0.12, -6.20,
+   5.69, 0.06, -0.06, -0.12, -0.13, -2.60,
+   -2.51, -5.70, 5.21, 0.03, -0.03, 0.14,
+   0.15, -1.30, -1.19, 6.70, -6.13, -0.21,
+   0.00, -0.01, 0.00, 0.00, 9.27, 0.00,
+   0.40, -0.08, 0.00, -0.19, 0.00, 0.00,
+   3.54, 0.00, 8.71, -0.02, 0.03, -0.12,
+   -0.17, 1.40, 1.07, -7.50, 5.57, 0.01,
+   -0.01, -0.14, -0.16, -0.50, -0.48, -7.20,
+   6.48, 0.13, -0.17, 0.02, 0.03, -7.70,
+   -5.69, 1.40, -1.07, -0.09, 0.00, 0.20,
+   0.00, 0.00, 4.02, 0.00, -8.99, 0.15,
+   -0.17, 0.00, 0.00, -7.50, -6.88, -0.20,
+   0.20, -0.22, 0.00, 0.08, 0.00, 0.00,
+   9.86, 0.00, -3.62, -0.16, -0.17, -0.04,
+   0.03, -7.60, 6.96, 1.70, 1.63, 0.16,
+   0.18, -0.10, -0.12, 8.00, -7.32, 0.07,
+   0.00, 0.24, 0.00, 0.00, -3.10, 0.00,
+   -10.58, 0.18, -0.19, 0.00, 0.00, -8.70,
+   -8.04, -0.24, 0.00, 0.15, 0.00, 0.00,
+   10.70, 0.00, -6.60, -0.07, 0.10, -0.15,
+   -0.21, 4.50, 3.34, -9.30, 6.92, -0.29,
+   0.00, 0.00, 0.00, 0.00, 13.05, 0.00,
+   -0.20, -0.17, 0.23, 0.04, 0.06, 10.30,
+   7.72, 2.70, -1.99, 0.06, 0.00, -0.31,
+   0.00, 0.00, -2.47, 0.00, 13.88, 0.19,
+   0.26, -0.01, 0.02, 11.70, -8.67, 0.80,
+   0.56, 0.33, 0.00, 0.00, 0.00, 0.00,
+   -14.64, 0.23, 0.25, -0.01, 0.02, 11.30,
+   -10.38, 0.50, 0.44, 0.01, 0.23, 0.25,
+   0.00, 0.00, 11.40, -10.42, -0.30, 0.00,
+   -0.21, 0.00, 0.00, 13.29, 0.00, 9.35,
+   -0.01, 0.00, -0.37, 0.00, 0.00, 0.52,
+   0.00, 16.43, -0.39, 0.00, 0.00, 0.00,
+   0.00, 17.46, -0.24, 0.32, -0.05, -0.07,
+   14.50, 10.82, -2.70, 2.03, 0.01, 0.25,
+   -0.34, 0.00, 0.00, -15.10, -11.30, -0.07,
+   0.09, -0.24, -0.33, 4.30, 3.18, -14.60,
+   10.86, 0.01, 0.30, 0.33, 0.00, 0.00,
+   14.70, -13.48, -0.11, 0.00, 0.44, 0.00,
+   0.00, 5.09, 0.00, -19.53, -0.26, 0.35,
+   0.07, 0.09, 15.60, 11.62, 4.40, -3.26,
+   -0.27, 0.35, -0.07, -0.11, 15.90, 11.86,
+   -4.50, 3.34, 0.01, -0.01, -0.33, -0.36,
+   0.00, -0.32, -16.00, 14.72, 0.53, 0.00,
+   0.00, 0.00, 0.00, -23.79, -0.55, 0.00,
+   -0.01, 0.00, 0.00, 24.42, 0.00, 0.32,
+   -0.38, 0.00, 0.40, 0.00, 0.00, 17.10,
+   0.00, -17.86, 0.37, -0.41, -0.11, -0.11,
+   -18.00, -16.51, -5.30, 4.89, -0.01, -0.41,
+   0.44, 0.00, 0.00, 19.80, 18.22, 0.37,
+   0.44, -0.11, 0.14, 19.90, -16.55, 5.90,
+   4.89, -0.01, 0.00, -0.46, -0.45, 0.70,
+   0.64, -20.10, 20.57, 0.01, 0.44, -0.48,
+   0.00, 0.00, -21.30, -19.49, 0.39, -0.52,
+   0.02, 0.03, -23.30, -17.34, 0.90, -0.72,
+   0.43, -0.58, -0.03, -0.03, -25.70, -19.13,
+   -1.70, 1.23, -0.19, 0.31, 0.38, 0.60,
+   13.30, 8.43, 26.90, -16.91, 0.39, -0.51,
+   0.41, 0.56, -23.20, -17.30, 24.60, -18.30,
+   0.03, 0.00, 1.09, 0.00, 0.00, -1.15,
+   0.00, -48.65, -1.28, 0.00, 0.00, 0.00,
+   0.00, 57.28, -1.32, 0.00, 0.00, 0.00,
+   0.00, 59.07, -1.43, 0.00, 0.41, 0.00,
+   0.00, 63.80, 0.00, -18.38, 0.02, 1.04,
+   1.13, 0.00, 0.00, 50.50, -46.38, -0.53,
+   0.69, -1.07, -1.45, 31.90, 23.79, -64.10,
+   47.73, -0.04, -1.84, 2.00, 0.00, 0.00,
+   89.50, 82.14, -2.14, 2.85, -1.28, -1.77,
+   128.60, 95.82, -77.10, 57.44, -0.07, 0.00,
+   -0.04, 0.00, -4.56, 6.18, 2.74, 3.58,
+   273.50, 203.78, 164.70, -122.67, 0.11, 0.11,
+   0.00, 0.12, -0.12, -0.12, 0.12, -0.12,
+   -0.12, -0.12, 0.12, -0.12, 0.12, 0.12,
+   0.12, -0.12, -0.12, 0.12, 0.12, 0.12,
+   0.12, -0.12, -0.12, -0.12, -0.12, -0.12,
+   -0.12, -0.12, 0.12, -0.12, 0.12, -0.12,
+   0.12, -0.12, -0.10, 0.12, 0.10, -0.12,
+   0.10, -0.12, -0.10, 0.12, 0.10, 0.12,
+   0.16, -0.16, 0.16, -0.16, 0.16, 0.16,
+   -0.16, 0.16, 0.16, 0.16, 0.16, 0.17,
+   0.00, -0.10, -0.16, 0.20, -0.20, -0.20,
+   -0.20, 0.20, 0.00, 0.00, -0.20, -0.21,
+   0.00, 0.20, 0.12, 0.20, -0.12, -0.20,
+   0.12, 0.20, -0.12, 0.20, -0.12, 0.00,
+   0.00, 0.20, 0.12, 0.20, -0.12, -0.20,
+   0.12, 0.20, -0.12, -0.20, 0.12, 0.20,
+   0.12, 0.20, 0.12, -0.20, -0.12, 0.20,
+   -0.12, 0.20, -0.12, -0.20, 0.12, -0.20,
+   0.12, -0.20, -0.12, 0.20, 0.12, 0.20,
+   0.12, 0.24, 0.24, -0.24, -0.24, 0.24,
+   -0.20, -0.16, -0.20, 0.16, -0.20, 0.16,
+   -0.20, -0.16, 0.20, 0.16, 0.20, -0.16,
+   0.20, 0.16, -0.20, -0.16, 0.20, 0.16,
+   0.20, 0.16, 0.20, 0.16, -0.20, 0.16,
+   -0.20, 0.16, 0.20, 0.16, 0.20, -0.16,
+   -0.20, -0.16, 0.20, -0.16, -0.20, 0.16,
+   0.20, 0.16, -0.20, 0.16, 0.20, -0.16,
+   0.20, -0.16, 0.20, -0.16, 0.20, 0.16,
+   0.20, -0.16, 0.20, 0.16, -0.20, 0.16,
+   -0.20, 0.16, -0.20, 0.16, 0.24, 0.00,
+   0.12, 0.28, -0.28, 0.28, 0.28, 0.28,
+   0.28, 0.28, 0.28, -0.20, 0.20, -0.20,
+   0.20, 0.20, 0.20, 0.20, 0.20, -0.20,
+   -0.20, -0.20, 0.20, 0.20, -0.20, 0.20,
+   -0.20, -0.20, -0.20, 0.00, 0.00, -0.20,
+   -0.20, 0.20, 0.20, 0.20, 0.20, -0.20,
+   0.20, 0.20, 0.20, -0.20, -0.20, -0.20,
+   -0.20, -0.20, 0.20, 0.20, 0.24, 0.20,
+   -0.24, -0.32, -0.10, 0.12, 0.30, -0.04,
+   -0.36, -0.36, -0.36, -0.30, 0.20, -0.30,
+   0.20, -0.30, -0.20, 0.30, 0.20, 0.30,
+   0.20, -0.30, 0.20, -0.30, 0.20, 0.30,
+   0.20, -0.30, 0.20, -0.30, 0.20, -0.30,
+   0.20, 0.30, -0.24, 0.30, -0.24, 0.30,
+   0.24, -0.30, 0.24, -0.30, -0.24, -0.30,
+   0.24, 0.30, -0.24, -0.30, 0.24, 0.30,
+   0.24, -0.30, -0.24, -0.30, 0.24, -0.30,
+   0.24, 0.30, -0.24, 0.40, 0.40, 0.30,
+   -0.28, 0.30, 0.28, -0.30, 0.28, -0.30,
+   0.28, -0.30, 0.28, 0.30, 0.28, 0.30,
+   0.28, 0.30, -0.28, -0.10, -0.12, 0.30,
+   0.24, 0.30, 0.32, -0.30, 0.32, -0.44,
+   -0.44, -0.44, -0.44, 0.44, -0.44, 0.40,
+   0.20, 0.00, 0.00, -0.30, -0.36, -0.30,
+   0.36, 0.48, -0.48, 0.48, 0.40, 0.28,
+   -0.40, 0.28, 0.40, -0.28, -0.40, 0.28,
+   -0.40, 0.32, -0.40, -0.32, -0.40, 0.32,
+   0.40, -0.32, 0.40, -0.32, 0.40, -0.32,
+   0.40, 0.32, 0.52, 0.52, -0.52, 0.40,
+   0.36, 0.40, 0.36, -0.40, -0.36, -0.40,
+   0.36, 0.40, -0.36, -0.40, 0.36, -0.56,
+   -0.56, 0.40, -0.40, 0.40, -0.40, 0.40,
+   0.40, -0.40, 0.40, -0.60, 0.60, -0.50,
+   0.36, -0.50, -0.36, -0.50, -0.40, 0.00,
+   0.00, 0.50, 0.40, 0.50, 0.40, 0.50,
+   -0.40, -0.10, -0.64, -0.10, -0.64, 0.50,
+   0.44, -0.68, -0.68, -0.50, -0.48, -0.50,
+   0.48, 0.50, -0.48, 0.50, -0.48, -0.50,
+   0.48, 0.50, -0.48, -0.50, -0.51, -0.72,
+   0.72, -0.60, 0.40, -0.60, -0.40, 0.60,
+   0.40, 0.50, -0.52, -0.50, 0.52, -0.60,
+   0.44, -0.76, 0.60, 0.48, 0.60, 0.48,
+   0.60, -0.48, -0.60, 0.52, 0.60, 0.52,
+   0.60, -0.52, -0.80, 0.80, -0.80, -0.60,
+   0.55, -0.60, -0.63, 0.88, 0.88, 0.70,
+   -0.56, -0.91, 0.76, -0.51, -0.10, -0.91,
+   -0.70, -0.60, 0.70, -0.60, 0.70, 0.64,
+   0.70, -0.64, -0.95, 0.70, 0.68, -0.70,
+   0.68, 0.80, -0.56, 0.80, 0.56, 0.99,
+   -0.99, 0.70, -0.71, -0.80, -0.60, -0.50,
+   0.52, 0.60, 0.40, 0.80, 0.64, -0.80,
+   -0.64, 0.80, 0.64, -0.10, -1.07, -0.80,
+   -0.72, -0.80, -0.76, -1.00, -0.48, 0.00,
+   0.00, -0.10, -1.11, 0.80, 0.79, 0.20,
+   0.00, 0.00, -1.11, 0.90, -0.68, 0.90,
+   0.68, -1.15, -1.15, -0.90, 0.72, -0.10,
+   1.15, -0.10, 1.15, 0.90, 0.76, 1.19,
+   -0.20, 1.19, 1.00, -0.68, -1.10, -0.52,
+   0.00, 0.00, 1.23, 0.90, 0.84, -0.90,
+   0.84, 1.00, -0.72, 1.00, 0.76, 1.00,
+   -0.76, -1.00, -0.76, -0.90, 0.88, 0.90,
+   0.91, 0.90, -0.91, 1.00, -0.83, 1.00,
+   0.88, -1.35, -1.00, 0.91, 1.10, -0.80,
+   1.00, -0.95, -1.00, 0.95, -1.39, 1.43,
+   -1.10, -0.95, 1.10, -0.95, 1.20, -0.88,
+   -1.20, -0.88, -1.20, 0.91, -1.10, -1.03,
+   0.00, 0.00, -1.10, 1.03, 1.10, -1.03,
+   1.51, 1.10, 1.07, 1.15, -1.03, 1.20,
+   -1.07, -1.40, -1.03, -0.20, 1.75, -1.40,
+   1.07, -1.29, 1.22, -1.30, -1.23, 1.30,
+   -1.23, 1.40, -1.15, -1.30, -1.27, -1.30,
+   1.27, 1.40, 1.19, 0.00, 0.00, -1.50,
+   -1.11, -1.50, -1.11, 1.87, -1.50, -1.12,
+   -0.10, 1.87, 1.50, 1.15, 1.40, 1.27,
+   1.50, 1.19, 1.49, -1.27, -0.20, 1.95,
+   -1.40, -1.39, 1.50, 1.35, 2.03, -1.60,
+   1.27, 1.60, -1.27, -1.60, 1.27, 1.60,
+   -1.31, -1.50, 1.43, -1.60, 1.47, -1.60,
+   1.47, -1.80, 1.39, 1.90, 1.39, -2.39,
+   0.20, 2.39, 1.90, -1.47, 1.90, -1.51,
+   -2.43, 2.00, 1.43, 2.00, -1.43, 2.10,
+   1.31, 1.80, 1.71, -2.00, -1.51, 2.00,
+   1.51, -1.80, -1.83, 1.90, -1.75, -1.90,
+   -1.75, -0.20, -2.59, 2.10, -1.55, -2.10,
+   1.55, 2.10, -1.59, -2.10, 1.63, -1.90,
+   1.87, -2.00, 1.79, 2.20, -1.67, 2.20,
+   -1.79, 2.30, -1.79, 2.40, 1.67, 0.10,
+   -0.12, -0.10, 2.94, 2.40, -1.71, 2.98,
+   0.00, 0.00, 2.98, 2.20, -2.03, -2.20,
+   2.03, -2.40, -1.87, 2.20, -2.11, -2.30,
+   2.11, 0.08, -0.04, 3.05, 0.74, 2.50,
+   1.91, -2.60, -1.79, -0.04, -0.40, 3.22,
+   -2.60, 1.95, -0.40, 3.26, -2.50, -2.22,
+   3.38, 0.20, -3.50, 2.60, -2.51, 2.70,
+   -2.50, 0.00, 0.00, -2.90, 2.27, -3.74,
+   -2.80, -2.51, -0.40, 3.74, 0.20, -0.20,
+   1.20, -3.66, 3.23, 2.46, 3.00, -2.74,
+   0.20, 4.10, -0.10, -0.12, 0.30, -4.10,
+   3.30, 2.51, -3.08, 2.80, -3.30, 2.55,
+   -3.40, 2.47, 3.20, -2.90, -3.20, 2.94,
+   -3.60, -2.70, 0.10, 0.00, 0.00, 0.00,
+   -0.20, -4.57, 3.40, 3.14, 0.01, 3.36,
+   -3.30, -3.60, -3.30, 3.90, -3.06, 4.10,
+   3.10, 0.20, 0.40, 4.00, 3.30, 4.30,
+   3.06, 0.12, 0.00, 0.00, 5.30, -0.20,
+   3.90, -3.61, -3.90, -3.62, 0.04, 3.90,
+   3.66, 0.04, 3.90, -3.66, -4.30, 3.30,
+   -4.30, 3.34, 4.00, 3.70, -4.00, -3.74,
+   -0.10, 0.00, 0.00, -4.40, -3.34, -0.10,
+   0.00, 0.00, -4.50, -3.26, -0.10, 0.00,
+   0.00, -4.50, 3.26, 0.11, 0.00, 0.00,
+   4.71, 3.31, -0.11, 0.00, 0.00, -4.72,
+   3.45, 0.10, 0.00, 0.00, 4.39, -4.04,
+   0.13, 0.00, 0.00, -0.04, -0.50, -6.01,
+   0.10, 0.00, 0.00, 4.40, 4.14, 0.11,
+   0.00, 0.00, 5.07, -3.71, -0.11, 0.00,
+   0.00, -5.00, -3.82, 0.11, 0.00, 0.04,
+   5.00, -3.98, 0.14, 0.00, 0.00, 0.00,
+   -0.10, -6.40, 0.11, 0.00, 0.00, 4.80,
+   4.38, 0.01, 0.00, -0.12, 0.20, -0.16,
+   -5.40, -3.62, -0.10, -0.11, 0.00, -0.04,
+   -4.90, 4.49, -0.12, 0.00, 0.00, -5.40,
+   4.02, 0.13, 0.00, -0.04, 5.60, -3.98,
+   0.13, 0.00, 0.00, 5.60, -4.06, 0.11,
+   -0.12, 0.00, 0.00, -5.19, -4.75, 0.13,
+   0.00, 0.00, 5.70, 4.18, 0.10, 0.13,
+   0.00, 0.00, 5.70, -4.53, 0.14, 0.00,
+   0.00, 6.10, -4.22, -0.10, 0.13, 0.00,
+   0.00, 5.90, 4.50, -0.11, 0.12, 0.00,
+   0.04, 5.50, 5.13, 0.11, 0.13, 0.00,
+   0.04, 6.00, -4.81, 0.01, 0.12, 0.13,
+   0.10, 0.04, 5.60, -5.33, 0.11, -0.14,
+   0.00, 0.00, -6.40, -4.90, -0.11, 0.15,
+   0.00, -0.04, 6.60, 4.70, -0.13, -0.14,
+   0.00, -0.04, -6.10, 5.73, 0.02, 0.02,
+   -0.14, -0.12, 1.10, -1.11, -5.39, 6.32,
+   0.19, 0.00, 0.00, 0.00, -0.40, -8.47,
+   -0.12, 0.15, 0.00, 0.00, 6.90, 5.25,
+   -0.20, 0.00, 0.00, 0.00, 0.00, 9.07,
+   -0.13, -0.16, 0.00, 0.00, -7.20, 5.61,
+   -0.14, 0.15, 0.00, 0.00, 6.90, 6.32,
+   0.01, 0.14, 0.15, 0.10, 0.08, 6.90,
+   -6.48, -0.13, -0.17, 0.00, 0.00, -7.50,
+   5.85, 0.14, 0.17, 0.00, 0.04, 7.80,
+   -6.12, -0.14, 0.18, 0.00, 0.00, 8.09,
+   6.20, -0.15, 0.17, 0.00, 0.04, 7.50,
+   6.92, 0.16, -0.17, 0.00, 0.00, -7.49,
+   -6.94, 0.14, 0.19, 0.00, -0.04, 8.40,
+   -6.09, -0.17, -0.18, 0.00, -0.04, -7.90,
+   7.40, -0.25, 0.00, 0.00, 0.00, 0.20,
+   10.98, 0.25, 0.00, 0.00, 0.00, -0.20,
+   -10.98, 0.17, 0.19, 0.00, 0.00, 8.30,
+   -7.48, 0.25, 0.00, 0.00, 0.04, 0.60,
+   -11.38, 0.01, 0.17, 0.21, 0.10, 0.08,
+   9.40, -7.64, -0.17, 0.21, 0.00, 0.00,
+   9.60, 7.44, 0.18, -0.22, 0.00, -0.04,
+   -10.00, -7.84, -0.18, -0.23, 0.00, 0.00,
+   -10.20, 7.91, 0.29, 0.00, 0.00, 0.04,
+   0.70, -12.93, -0.29, 0.00, 0.00, 0.00,
+   0.00, 13.13, 0.00, 0.00, -0.19, 0.23,
+   0.00, 0.04, 10.50, 8.27, -0.30, 0.00,
+   0.00, -0.08, -1.41, 13.32, 0.19, -0.25,
+   0.00, 0.04, -11.20, -8.28, -0.01, -0.22,
+   -0.23, 0.00, -0.04, -10.40, 9.67, 0.01,
+   0.22, 0.23, 0.00, 0.04, 10.40, -9.75,
+   -0.01, -0.22, -0.24, 0.00, 0.00, -10.80,
+   10.02, -0.33, 0.00, 0.00, -0.04, -0.80,
+   14.92, 0.01, 0.23, 0.24, 0.10, 0.08,
+   10.90, -10.30, 0.21, -0.27, 0.00, 0.00,
+   -12.00, -9.19, 0.14, -0.31, 0.00, 0.00,
+   -13.80, -6.44, 0.00, 0.00, -0.20, 0.29,
+   0.00, 0.00, 12.80, 9.11, -0.01, -0.22,
+   -0.29, 0.00, 0.00, -12.80, 9.75, -0.37,
+   0.00, 0.00, -0.08, -1.71, 16.55, -0.01,
+   -0.23, 0.29, -0.10, 0.08, 13.10, 10.46,
+   -0.01, -0.23, -0.31, 0.00, 0.04, -13.81,
+   10.07, -0.01, -0.27, -0.30, 0.00, 0.04,
+   -13.38, 12.24, -0.01, -0.25, -0.32, 0.00,
+   -0.04, -14.40, 11.14, 0.01, 0.30, 0.32,
+   0.00, 0.00, 14.40, -13.29, -0.01, -0.30,
+   -0.32, -0.10, -0.04, -14.30, 13.41, -0.44,
+   0.00, 0.00, -0.08, -1.50, 19.61, -0.44,
+   0.00, 0.00, -0.08, -1.90, 19.65, -0.01,
+   -0.27, 0.36, 0.00, -0.04, 16.21, 11.98,
+   0.01, 0.32, -0.34, 0.00, 0.04, -15.31,
+   -14.10, 0.01, 0.29, -0.39, 0.00, 0.04,
+   -17.41, -12.78, -0.50, 0.00, 0.00, -0.04,
+   -0.60, 22.47, 0.30, 0.41, -0.10, -0.04,
+   18.40, -13.33, -0.32, -0.39, 0.00, -0.01,
+   -17.60, 14.47, 0.00, 0.00, 0.51, 0.00,
+   0.00, 0.04, 0.50, -22.99, -0.01, -0.35,
+   0.38, 0.00, 0.00, 17.08, 15.69, -0.01,
+   -0.32, -0.41, -0.10, -0.04, -18.50, 14.32,
+   -0.52, 0.00, 0.00, -0.12, -2.40, 23.39,
+   0.01, 0.32, 0.42, 0.00, 0.00, 18.91,
+   -14.37, -0.01, -0.37, -0.39, -0.10, -0.08,
+   -17.60, 16.39, 0.01, 0.39, 0.40, 0.00,
+   0.00, 18.10, -17.42, 0.45, 0.57, -0.04,
+   0.00, -0.08, -1.91, -25.42, 0.01, 0.35,
+   0.46, 0.00, 0.00, 20.51, -15.52, 0.59,
+   0.00, 0.00, 0.00, -0.19, -26.17, 0.60,
+   0.00, 0.00, 0.08, 1.41, -26.77, 0.01,
+   0.41, -0.45, 0.00, 0.00, -20.00, -18.42,
+   0.01, 0.37, 0.48, 0.10, 0.04, 21.60,
+   -16.75, 0.01, 0.42, 0.45, 0.00, 0.00,
+   20.11, -18.64, 0.01, 0.43, 0.46, 0.10,
+   0.08, 20.70, -19.41, -0.01, -0.40, 0.50,
+   -0.10, 0.08, 22.50, 17.74, 0.01, 0.40,
+   0.55, -0.10, -0.04, 24.40, -18.02, -0.01,
+   -0.42, 0.54, -0.10, 0.04, 24.00, 18.58,
+   0.68, 0.00, 0.00, 0.04, 0.91, -30.47,
+   -0.01, -0.48, -0.51, -0.10, -0.08, -22.80,
+   21.28, 0.01, 0.45, 0.56, 0.20, 0.12,
+   25.00, -19.97, 0.01, 0.51, -0.55, 0.10,
+   -0.08, -24.40, -22.67, -0.01, -0.44, 0.62,
+   0.10, -0.12, 27.50, 19.58, 0.02, 0.52,
+   0.56, 0.20, 0.16, 25.20, -23.47, 0.01,
+   0.53, -0.57, 0.00, 0.00, -25.31, -23.49,
+   0.78, 0.00, 0.00, 0.04, 2.89, -34.81,
+   -0.01, -0.47, -0.62, 0.00, 0.00, -27.91,
+   21.01, -0.01, -0.53, 0.58, 0.00, 0.00,
+   25.80, 23.66, -0.84, 0.00, 0.10, 0.04,
+   0.80, 37.75, 0.01, 0.52, 0.71, -0.10,
+   -0.08, 31.61, -23.28, -0.90, 0.00, 0.10,
+   -0.04, 0.40, 40.33, 0.02, 0.62, 0.66,
+   0.20, 0.20, 29.40, -27.61, 0.01, 0.63,
+   0.68, 0.00, 0.00, 30.40, -28.00, -0.01,
+   -0.63, -0.73, 0.20, -0.16, -32.55, 28.35,
+   -0.02, -0.59, 0.77, -0.10, 0.04, 34.59,
+   26.54, -0.01, -0.59, 0.83, 0.10, -0.12,
+   36.95, 26.54, -0.02, -0.64, -0.87, -0.10,
+   -0.08, -38.92, 28.50, 0.02, 0.66, -0.87,
+   0.00, 0.04, -39.11, -29.53, 1.14, 0.00,
+   -0.10, -0.12, -2.30, -51.00, -0.02, -0.73,
+   -0.94, -0.10, -0.04, -42.19, 32.43, 0.03,
+   1.19, -0.09, 0.00, -0.20, -3.91, -53.22,
+   -0.02, -0.82, -0.88, -0.10, -0.04, -39.50,
+   36.68, -0.02, -0.83, -0.89, -0.10, -0.12,
+   -39.90, 37.15, 0.02, 0.74, -0.98, -0.10,
+   0.08, -44.04, -33.22, 0.02, 0.86, 1.11,
+   0.10, 0.08, 49.59, -38.57, 0.01, -0.03,
+   -1.40, -0.11, 0.00, -0.24, -5.00, 62.65,
+   -0.01, 0.03, 0.98, 1.04, 0.40, 0.36,
+   46.50, -43.76, 0.02, 0.04, 0.91, -1.11,
+   1.00, -1.00, -49.51, -40.58, -0.02, -0.91,
+   -1.18, -0.10, -0.04, -52.69, 40.54, 0.03,
+   1.02, -1.10, 0.10, -0.12, -49.00, -45.59,
+   -0.03, -1.08, 1.16, -0.20, 0.20, 51.80,
+   48.29, -0.03, -1.15, -1.24, 0.00, 0.00,
+   -55.60, 51.32, 0.03, 1.23, -1.32, 0.20,
+   -0.08, -59.20, -54.81, 0.03, 1.24, -1.36,
+   -0.20, 0.16, -60.92, -55.66, -0.03, -1.14,
+   1.50, 0.00, 0.00, 67.25, 51.02, -0.01,
+   0.04, 1.18, 1.48, 0.40, 0.32, 66.29,
+   -52.95, 0.03, 1.17, -1.57, 0.00, 0.00,
+   -70.01, -52.27, -0.01, -0.04, -1.35, 1.45,
+   -0.40, 0.36, 64.70, 60.50, -0.04, -1.48,
+   -1.59, -0.20, -0.20, -71.00, 66.03, 0.93,
+   1.99, 0.00, 0.02, 89.10, -41.53, 0.00,
+   0.00, 0.04, 1.76, 1.91, 0.00, 0.00,
+   85.32, -78.56, 2.91, 0.00, 0.00, 0.04,
+   -0.90, -130.31, 0.01, -0.07, -2.97, -0.24,
+   0.10, -0.52, -10.77, 132.81, 0.01, -0.04,
+   -1.77, 2.40, 0.20, -0.24, 107.31, 79.03,
+   0.07, 3.01, 0.08, -0.20, 0.20, 3.51,
+   -134.81, -0.05, -1.94, -2.53, -0.20, -0.08,
+   -112.94, 86.74, 0.01, -0.06, -2.21, -2.37,
+   -0.30, -0.28, -106.20, 98.69, -0.01, -0.07,
+   -2.35, 2.52, -0.50, 0.44, 112.90, 105.29,
+   0.01, -0.04, -2.04, 2.83, 0.40, -0.40,
+   126.64, 91.31, -0.08, -3.61, 0.09, 0.20,
+   0.20, 4.03, 161.34, -0.01, -0.07, -2.51,
+   2.70, -0.30, 0.28, 120.70, 112.14, -0.01,
+   0.07, 2.56, 2.75, 0.40, 0.32, 123.20,
+   -114.49, 0.08, 3.76, -0.04, -0.20, 0.20,
+   -2.00, -168.26, -0.01, 0.08, 2.58, 2.75,
+   0.70, 0.60, 123.20, -115.40, 0.31, 0.40,
+   3.58, -1.23, 13.90, -14.04, -55.30, -160.15,
+   0.01, 0.09, 3.87, -0.18, -0.20, -0.40,
+   -8.11, -172.95, -0.06, -2.73, 2.93, 0.10,
+   -0.08, 131.04, 121.98, 1.77, 3.75, 0.00,
+   0.04, 167.90, -79.08, 0.00, 0.00, 0.01,
+   -0.09, -4.20, -0.09, 0.30, -0.24, -4.11,
+   187.95, -0.07, -3.18, -4.27, 0.10, 0.20,
+   -190.79, 142.16, 0.02, -0.13, -5.85, -0.45,
+   0.20, -0.95, -19.94, 261.54, -0.08, -3.62,
+   -4.93, 0.10, 0.24, -220.67, 161.79, 0.01,
+   0.14, 6.54, -0.11, -0.40, -0.32, -5.10,
+   -292.37, 0.34, -4.22, 6.09, 0.30, -0.12,
+   272.22, 188.95, 0.02, 0.35, -4.40, 6.08,
+   0.90, -0.84, 272.05, 196.64, -0.02, 0.14,
+   4.76, 6.02, 1.20, 0.84, 269.45, -212.82,
+   0.01, -0.14, -5.73, -6.19, -0.40, -0.28,
+   -276.81, 256.30, 0.01, 0.33, -5.14, 6.80,
+   0.50, -0.60, 304.17, 229.78, 0.27, -5.16,
+   -6.81, -0.10, 0.08, -304.46, 230.72, -0.30,
+   5.60, 7.31, 0.40, 0.08, 327.11, -250.54,
+   -0.01, -0.99, -6.35, 6.87, -0.40, 0.32,
+   307.03, 284.09, -0.02, -0.27, 5.90, 7.49,
+   1.40, 0.99, 335.24, -264.02, -0.13, 0.01,
+   -0.24, -9.81, 0.24, -0.20, -0.56, 10.47,
+   438.51, 0.02, 0.00, 0.08, 0.00, 0.01,
+   -1.01, -6.73, -7.27, -0.50, -0.44, -325.03,
+   300.99, -0.04, 0.20, 6.84, 7.30, 1.90,
+   1.75, 326.60, -305.78, -0.13, -0.12, -0.02,
+   -0.25, -9.08, 11.67, -1.50, 0.99, 522.11,
+   405.91, -0.20, -0.09, -3.71, -14.86, 0.38,
+   1.00, -0.40, 16.81, 664.57, 0.01, 0.00,
+   -0.16, -0.15, -0.06, -0.77, -11.33, 14.40,
+   -2.62, 2.54, 643.75, 506.65, 0.01, 0.01,
+   -0.17, 0.15, 0.03, -0.16, 11.46, 15.55,
+   -1.40, -1.47, 695.54, -512.37, 0.26, -0.01,
+   0.43, 19.37, -0.36, -1.30, 0.52, -16.26,
+   -866.48, -0.07, -0.09, -0.17, 0.19, -4.19,
+   3.18, 14.05, 15.32, -0.50, -0.64, 684.99,
+   -628.24, 0.01, -0.01, 0.20, 0.18, -0.01,
+   -0.08, 13.49, -17.90, 0.10, 0.44, -800.34,
+   -603.52, 0.02, 0.00, -0.21, 0.17, -0.27,
+   -0.81, 12.44, 19.06, -4.48, 3.16, 852.85,
+   -556.26, -0.31, 0.06, -0.52, -23.02, -1.25,
+   1.10, -2.63, -55.55, 1029.70, -0.35, 0.07,
+   -0.58, -26.01, -1.36, 1.30, -2.94, -60.90,
+   1163.22, 0.01, -0.01, 0.27, 0.24, -0.01,
+   -0.40, 18.18, -24.05, 0.30, 0.40, -1075.60,
+   -813.13, 0.01, 0.01, 0.31, -0.34, 1.00,
+   -0.61, -25.43, -27.59, -0.30, -0.04, -1233.89,
+   1137.48, -0.01, -0.02, -0.33, 0.37, -1.22,
+   0.74, 27.61, 29.60, 5.90, 5.21, 1323.81,
+   -1234.96, -0.01, -0.01, 0.35, 0.38, 0.00,
+   0.68, 28.89, -31.01, 0.00, 0.00, -1387.00,
+   -1292.02, -0.56, 0.02, -0.94, -42.45, 1.07,
+   2.50, -0.72, 47.70, 1898.27, -0.01, -0.02,
+   -0.41, 0.46, -1.25, 0.92, 34.30, 36.78,
+   6.80, 6.29, 1645.01, -1534.09, -0.75, 0.13,
+   -0.82, -56.37, -2.73, 2.90, -5.97, -122.28,
+   2521.07, 0.04, -0.04, 0.61, 0.54, -1.02,
+   -1.07, 40.82, -54.19, -2.00, 1.23, -2423.59,
+   -1825.49, 0.03, 0.02, -0.66, 0.61, -0.12,
+   -0.42, 45.91, 58.94, 7.80, 5.13, 2636.13,
+   -2053.16, -0.01, -0.64, -0.71, -1.24, -0.96,
+   -53.05, 57.12, -6.60, 5.93, 2554.51, 2372.58,
+   -0.05, 0.02, -0.79, -0.69, 0.16, 1.46,
+   -51.60, 70.31, 7.50, -7.52, 3143.98, 2307.58,
+   -0.04, -0.02, 0.83, -0.75, -0.01, 1.16,
+   -56.17, -74.33, -0.90, 1.07, -3323.89, 2511.85,
+   1.86, 0.15, 2.71, 139.64, -2.76, -8.20,
+   -6.68, -123.48, -6245.02, -0.02, 0.04, 1.33,
+   1.46, 3.20, 2.16, 109.81, -119.21, 0.40,
+   0.76, -5331.13, -4910.93, -0.10, -0.07, 1.73,
+   -1.52, -1.04, 2.86, -113.94, -154.91, 3.92,
+   7.19, -6918.22, 5095.50, -0.48, 0.60, 2.40,
+   2.54, 29.83, 23.87, 192.06, -214.50, -13.20,
+   4.42, -9592.72, -8584.95, -0.04, -0.06, -3.23,
+   3.57, -7.06, 5.70, 268.14, 288.49, 36.70,
+   32.46, 12902.66, -11991.74, 0.24, 0.17, -5.02,
+   4.59, 1.41, -5.77, 344.50, 448.76, 31.80,
+   15.12, 20069.50, -15406.85, 0.07, 0.01, 0.17,
+   -8.41, 0.78, -11.19, -632.54, -15.07, 35.80,
+   -34.69, -674.99, 28288.28, -1.19, -1.36, -5.61,
+   6.08, -67.30, 59.20, 459.68, 501.82, -17.40,
+   -20.84, 22438.42, -20557.78, 0.13, 0.00, 3.57,
+   -0.50, -1.83, -17.36, -28.93, -179.73, -1312.21,
+   164.33, -192.40, 470.05, 7387.02, 58707.02, 0.18,
+   0.20, 0.24, 0.47, 22.41, -24.43, 48.00,
+   -36.07, -1837.32, -2004.36, -29.05, -27.64, -89618.24,
+   82168.76, -0.20, -0.22, -0.28, -0.46, -24.46,
+   26.92, -51.26, 41.44, 2024.68, 2187.91, 137.41,
+   111.23, 97846.69, -90552.22, -0.01, 0.00, -1.16,
+   -1.27, -1.03, -2.75, -143.27, 155.74, -290.91,
+   198.97, 11714.49, 12814.01, -458.66, -544.75, 573033.42,
+   -523908.04, -0.02, -0.02, 0.11, -0.10, -1.61,
+   1.73, -15.22, -20.39, 120.56, 81.46, -2301.27,
+   2037.98, 853.32, -3309.73, 153041.79, 205833.11, 1538.18,
+   1328.67, 9205236.26, -6844318.44
+};
@@ -0,0 +1,315 @@
+#define _POSIX_C_SOURCE 200112L
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Threaded batch functions, implemented in C99 with POSIX threads.
+
+ A batch of n items is split into blocks, which run through terse_alternate_iauParallelFor on one of two executors:
+
+   - by default, a built-in work-stealing pool. Its threads are started when first needed, up to the
+     largest thread count asked for, and are kept for later batches (terse_alternate_iauPoolStop stops them). Each thread
+     taking part, the calling thread included, starts with its own contiguous share of the blocks, and takes
+     them one at a time from the front; a thread whose share runs out steals the back half of another's.
+     A batch started while the pool is busy (from another application thread, or from within a block) runs
+     on the calling thread alone, rather than waiting or starting more threads.
+   - the application's own executor, set by terse_alternate_iauSetExecutor: the library then never starts threads of its own,
+     and the blocks run wherever the application's scheduler puts them, so that it isn't oversubscribed.
+
+ A thread count of 0 means one thread per online CPU, or the executor's concurrency if it gives one.
+*/
+
+/* Don't start a thread, or make a block, for fewer items than this. */
+static const int MIN_ITEMS_PER_THREAD = 16;
+
+/* Blocks per thread, for the balancing; more blocks cost more overhead. */
+static const int BLOCKS_PER_THREAD = 8;
+
+enum { MAX_THREADS = 64 };
+
+/* The number of online CPUs, at least 1. */
+int terse_alternate_iauNumCpus(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? (int)n : 1;
+#else
+  return 1;
+#endif
+}
+
+/* The application's executor, if one is set. */
+static terse_alternate_iauEXECUTOR executor;
+static int have_executor = 0;
+
+/*
+ Run the batch functions on the application's executor (a copy of *ex is kept), or on the built-in pool
+ if ex is NULL. Not to be called while batch functions are running.
+*/
+void terse_alternate_iauSetExecutor(const terse_alternate_iauEXECUTOR *ex) {
+  if (ex != NULL) executor = *ex;
+  have_executor = (ex != NULL);
+}
+
+/*
+ A batch, as blocks of items: block b is items n*b/nblocks to n*(b+1)/nblocks - 1.
+ The reproducible mode is taken when the batch starts, so that every block runs in the same mode.
+*/
+typedef struct {
+  void (*body)(void *ctx, int begin, int end);
+  void *ctx;
+  int n, nblocks;
+  int reproducible;
+} blocks;
+
+/*
+ Call body for the items begin to end - 1. In the reproducible mode, flush-to-zero is turned off in the
+ thread for the call (terse_alternate_iauReproducible turns it off only in the thread that calls it), and then restored.
+*/
+static void call_body(void (*body)(void *ctx, int begin, int end), void *ctx, int begin, int end, int reproducible) {
+  if (!reproducible) {
+    body(ctx, begin, end);
+    return;
+  }
+  int ftz = terse_alternate_iauFtz(0);
+  body(ctx, begin, end);
+  if (ftz == 1) (void)terse_alternate_iauFtz(1);
+}
+
+static void run_block(const blocks *b, int k) {
+  call_body(b->body, b->ctx, (int)((long long)b->n * k / b->nblocks), (int)((long long)b->n * (k + 1) / b->nblocks),
+      b->reproducible);
+}
+
+/* The task of the application's executor for block i. */
+static void executor_task(void *arg, int i) {
+  run_block(arg, i);
+}
+
+/* One thread's share of the blocks of a job, [next, end), which others may steal from the back of. */
+typedef struct {
+  pthread_mutex_t lock;
+  int next, end;
+} share;
+
+typedef struct {
+  blocks b;
+  int nthreads;
+  unsigned long generation;
+  share shares[MAX_THREADS];
+} job;
+
+static struct {
+  pthread_mutex_t lock;       /* guards everything below */
+  pthread_cond_t wake;        /* the workers wait on this for a job, or to stop */
+  pthread_cond_t left;        /* the caller waits on this for the workers to finish a job */
+  pthread_t threads[MAX_THREADS];
+  int nworkers;               /* worker threads started */
+  int assigned;               /* worker numbers (1 to nworkers) taken by the workers themselves */
+  job *job;                   /* the running job, or NULL */
+  unsigned long generation;   /* counts the jobs, so that a worker takes part in each just once */
+  int pending;                /* workers still to finish the running job */
+  int stopping;
+} pool = {.lock = PTHREAD_MUTEX_INITIALIZER, .wake = PTHREAD_COND_INITIALIZER, .left = PTHREAD_COND_INITIALIZER};
+
+/* The next block of a share, or -1 if there's none left. */
+static int take_block(share *s) {
+  pthread_mutex_lock(&s->lock);
+  int k = (s->next < s->end) ? s->next++ : -1;
+  pthread_mutex_unlock(&s->lock);
+  return k;
+}
+
+/* Move the back half of another thread's share to the share of thread self. Returns 0 if all are empty. */
+static int steal_blocks(job *j, int self) {
+  for (int t = 1; t < j->nthreads; ++t) {
+    share *victim = &j->shares[(self + t) % j->nthreads];
+    int begin = -1, end = 0;
+    pthread_mutex_lock(&victim->lock);
+    int left = victim->end - victim->next;
+    if (left > 0) {
+      end = victim->end;
+      begin = end - (left + 1) / 2;
+      victim->end = begin;
+    }
+    pthread_mutex_unlock(&victim->lock);
+    if (begin >= 0) {
+      share *own = &j->shares[self];
+      pthread_mutex_lock(&own->lock);
+      own->next = begin;
+      own->end = end;
+      pthread_mutex_unlock(&own->lock);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/* Thread self's part in a job: its own share, then whatever it can steal. */
+static void run_share(job *j, int self) {
+  for (;;) {
+    int k = take_block(&j->shares[self]);
+    if (k >= 0) run_block(&j->b, k);
+    else if (!steal_blocks(j, self)) return;
+  }
+}
+
+static void *worker(void *arg) {
+  unsigned long seen = 0;
+  (void)arg;
+  pthread_mutex_lock(&pool.lock);
+  int self = ++pool.assigned;
+  for (;;) {
+    while (!pool.stopping && (pool.job == NULL || pool.job->generation == seen)) {
+      pthread_cond_wait(&pool.wake, &pool.lock);
+    }
+    if (pool.stopping) break;
+    job *j = pool.job;
+    seen = j->generation;
+    if (self < j->nthreads) {
+      pthread_mutex_unlock(&pool.lock);
+      run_share(j, self);
+      pthread_mutex_lock(&pool.lock);
+      if (--pool.pending == 0) pthread_cond_signal(&pool.left);
+    }
+  }
+  pthread_mutex_unlock(&pool.lock);
+  return NULL;
+}
+
+/* Run the blocks on the pool, with up to nthreads threads (the caller's included). */
+static void pool_run(const blocks *b, int nthreads) {
+  job j;
+  pthread_mutex_lock(&pool.lock);
+  if (pool.job != NULL || pool.stopping) {
+    pthread_mutex_unlock(&pool.lock);
+    call_body(b->body, b->ctx, 0, b->n, b->reproducible);
+    return;
+  }
+  if (nthreads > MAX_THREADS) nthreads = MAX_THREADS;
+  while (pool.nworkers < nthreads - 1) {
+    if (pthread_create(&pool.threads[pool.nworkers], NULL, worker, NULL) != 0) break;
+    ++pool.nworkers;
+  }
+  if (nthreads > pool.nworkers + 1) nthreads = pool.nworkers + 1;
+  j.b = *b;
+  j.nthreads = nthreads;
+  for (int t = 0; t < nthreads; ++t) {
+    pthread_mutex_init(&j.shares[t].lock, NULL);
+    j.shares[t].next = (int)((long long)b->nblocks * t / nthreads);
+    j.shares[t].end = (int)((long long)b->nblocks * (t + 1) / nthreads);
+  }
+  j.generation = ++pool.generation;
+  pool.job = &j;
+  pool.pending = nthreads - 1;
+  pthread_cond_broadcast(&pool.wake);
+  pthread_mutex_unlock(&pool.lock);
+
+  run_share(&j, 0);
+
+  pthread_mutex_lock(&pool.lock);
+  while (pool.pending > 0) pthread_cond_wait(&pool.left, &pool.lock);
+  pool.job = NULL;
+  pthread_mutex_unlock(&pool.lock);
+  for (int t = 0; t < nthreads; ++t) pthread_mutex_destroy(&j.shares[t].lock);
+}
+
+/* Stop the threads of the built-in pool; they're started again when next needed. Not to be called during a batch. */
+void terse_alternate_iauPoolStop(void) {
+  pthread_mutex_lock(&pool.lock);
+  pool.stopping = 1;
+  pthread_cond_broadcast(&pool.wake);
+  int n = pool.nworkers;
+  pthread_mutex_unlock(&pool.lock);
+  for (int t = 0; t < n; ++t) pthread_join(pool.threads[t], NULL);
+  pthread_mutex_lock(&pool.lock);
+  pool.nworkers = pool.assigned = pool.stopping = 0;
+  pthread_mutex_unlock(&pool.lock);
+}
+
+/*
+ Call body(ctx, begin, end) for contiguous blocks that together cover the items 0..n-1, using up to
+ nthreads threads (0 for one per CPU, or the executor's concurrency), on the application's executor if
+ one is set, otherwise on the built-in pool. Returns when every block is done.
+*/
+void terse_alternate_iauParallelFor(int n, int nthreads, void (*body)(void *ctx, int begin, int end), void *ctx) {
+  if (nthreads <= 0) nthreads = (have_executor && executor.concurrency > 0) ? executor.concurrency : terse_alternate_iauNumCpus();
+  if (nthreads > n / MIN_ITEMS_PER_THREAD) nthreads = n / MIN_ITEMS_PER_THREAD;
+  if (nthreads <= 1) {
+    if (n > 0) call_body(body, ctx, 0, n, terse_alternate_iauIsReproducible());
+    return;
+  }
+  int nblocks = nthreads * BLOCKS_PER_THREAD;
+  if (nblocks > n / MIN_ITEMS_PER_THREAD) nblocks = n / MIN_ITEMS_PER_THREAD;
+  blocks b = {body, ctx, n, nblocks, terse_alternate_iauIsReproducible()};
+  if (have_executor) executor.run(executor.executor, nblocks, executor_task, &b);
+  else pool_run(&b, nthreads);
+}
+
+typedef struct {
+  const terse_alternate_iauEPOCHS *tt;
+  double *dpsi;
+  double *deps;
+} nut00av_args;
+
+static void nut00av_fresh(nut00av_args *a, int begin, int end) {
+  for (int i = begin; i < end; ++i) {
+    double d1, d2;
+    terse_alternate_iauEpochAt(a->tt, i, &d1, &d2);
+    terse_alternate_iauNut00aPacked(d1, d2, &a->dpsi[i], &a->deps[i]);
+  }
+}
+
+static void nut00av_block(void *ctx, int begin, int end) {
+  nut00av_args *a = ctx;
+  terse_alternate_iauNUTSTEP *ns = terse_alternate_iauIsReproducible() ? NULL : malloc(sizeof *ns);
+  if (ns == NULL) {
+    nut00av_fresh(a, begin, end);
+    return;
+  }
+  terse_alternate_iauNutStepInit(ns, a->tt->date1, a->tt->date2 + begin * a->tt->step, a->tt->step, 0);
+  for (int i = begin; i < end; ++i) {
+    terse_alternate_iauNutStep(ns, &a->dpsi[i], &a->deps[i]);
+  }
+  free(ns);
+}
+
+/*
+ iauNut00a, for each epoch in a range of TT, using up to nthreads threads (0 for one per CPU).
+ Normally each block of epochs runs a nutation stepper; the results then differ from iauNut00a by about
+ 1e-17 radians, in a way that depends on how the epochs are split among threads.
+ In the reproducible mode, every epoch is computed afresh, and the results are identical to iauNut00a.
+*/
+void terse_alternate_iauNut00av(const terse_alternate_iauEPOCHS *tt, int nthreads, double dpsi[], double deps[]) {
+  nut00av_args args = { tt, dpsi, deps };
+  terse_alternate_iauParallelFor(tt->n, nthreads, nut00av_block, &args);
+}
+
+typedef struct {
+  const double *rc, *dc, *pr, *pd, *px, *rv;
+  iauASTROM *astrom;
+  double *ri, *di;
+} atciqv_args;
+
+static void atciqv_block(void *ctx, int begin, int end) {
+  atciqv_args *a = ctx;
+  for (int i = begin; i < end; ++i) {
+    iauAtciq(a->rc[i], a->dc[i], a->pr ? a->pr[i] : 0.0, a->pd ? a->pd[i] : 0.0,
+        a->px ? a->px[i] : 0.0, a->rv ? a->rv[i] : 0.0, a->astrom, &a->ri[i], &a->di[i]);
+  }
+}
+
+/*
+ iauAtciq, for n stars, using up to nthreads threads (0 for one per CPU).
+ The proper motion, parallax and radial velocity arrays may be NULL, meaning zero for every star.
+ Each star is computed by iauAtciq itself, so the results are always identical to iauAtciq.
+*/
+void terse_alternate_iauAtciqv(int n, int nthreads, const double rc[], const double dc[],
+    const double pr[], const double pd[], const double px[], const double rv[],
+    iauASTROM *astrom, double ri[], double di[]) {
+  atciqv_args args = { rc, dc, pr, pd, px, rv, astrom, ri, di };
+  terse_alternate_iauParallelFor(n, nthreads, atciqv_block, &args);
+}
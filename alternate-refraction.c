@@ -0,0 +1,129 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Refraction at many wavelengths and many field positions, for atmospheric dispersion correctors and
+ fiber positioners, implemented in C99.
+
+ terse_alternate_iauRefcov gives the refraction constants of iauRefco for an array of wavelengths. The pow() of the water
+ vapour pressure, and the rest of the meteorological part, are computed once for all of them; the results
+ are identical to those of iauRefco.
+
+ terse_alternate_iauRefzv gives the refraction, at each of an array of wavelengths (as refraction constants), for each of an
+ array of zenith distances: the unrefracted (topocentric) zenith distance less the observed one, by exactly
+ the treatment of iauAtioq (the A tan(z) + B tan^3(z) model with its Newton-Raphson correction, applied to
+ the vector, and the same precautions near the horizon). The sin and cos of each zenith distance are computed
+ once for all wavelengths; the rest is plain arithmetic, in loops the compiler can vectorize. The refraction is
+ found directly as an angle, rather than as the difference of two zenith distances, so it loses no precision.
+ With a reference wavelength, the results are differential: the refraction less that at the reference.
+*/
+
+enum { BLOCK = 256 };
+
+/* Minimum cos(alt) and sin(alt) for refraction purposes (the same values as iauAtioq). */
+static const double CELMIN = 1e-6;
+static const double SELMIN = 0.05;
+
+/* Beyond this ratio, the arctangent series isn't exact to double precision (0.02^11/11 < 2e-20). */
+static const double SERIES_LIMIT = 0.02;
+
+/*
+ iauRefco for n wavelengths wl[] (micrometers), with the same pressure phpa (hPa), temperature tc (deg C)
+ and relative humidity rh (0-1). Returned refa[], refb[] (radians), identical to iauRefco's.
+*/
+void terse_alternate_iauRefcov(double phpa, double tc, double rh, int n, const double wl[], double refa[], double refb[]) {
+  //the meteorological part, as in iauRefco
+  double t = gmin(gmax(tc, -150.0), 200.0);
+  double p = gmin(gmax(phpa, 0.0), 10000.0);
+  double r = gmin(gmax(rh, 0.0), 1.0);
+  double pw = 0.0;
+  if (p > 0.0) {
+    double ps = pow(10.0, (0.7859 + 0.03477*t) / (1.0 + 0.00412*t)) * (1.0 + p * (4.5e-6 + 6e-10*t*t));
+    pw = r * ps / (1.0 - (1.0-r)*ps/p);
+  }
+  double tk = t + 273.15;
+  double beta_optic = 4.4474e-6 * tk;
+  double beta_radio = beta_optic - 0.0074 * pw * beta_optic;
+  double gamma_radio = (77.6890e-6*p - (6.3938e-6 - 0.375463/tk) * pw) / tk;
+
+  for (int i = 0; i < n; ++i) {
+    double gamma, beta;
+    if (wl[i] <= 100.0) {
+      double w = gmax(wl[i], 0.1);
+      double wlsq = w * w;
+      gamma = ((77.53484e-6 + (4.39108e-7 + 3.666e-9/wlsq) / wlsq) * p - 11.2684e-6*pw) / tk;
+      beta = beta_optic;
+    } else {
+      gamma = gamma_radio;
+      beta = beta_radio;
+    }
+    refa[i] = gamma * (1.0 - beta);
+    refb[i] = - gamma * (beta - gamma / 2.0);
+  }
+}
+
+/*
+ iauAtioq's refraction of the direction at zenith distance zt (sin s, cos c) by the constants a, b:
+ the sin and cos (times the same factor) of the angle from the unrefracted direction to the observed one.
+*/
+static inline void refraction_angle(double a, double b, double s, double c, double *y, double *x) {
+  double r = s > CELMIN ? s : CELMIN;
+  double z = c > SELMIN ? c : SELMIN;
+  double tz = r / z;
+  double w = b * tz * tz;
+  double del = (a + w) * tz / (1.0 + (a + 3.0 * w) / (z * z));
+  double cosdel = 1.0 - del * del / 2.0;
+  double f = fabs(cosdel - del * z / r);
+  //the observed direction, unnormalized, as (sin, cos) of its zenith distance
+  double sin_obs = f * s, cos_obs = cosdel * c + del * r;
+  *y = s * cos_obs - c * sin_obs;
+  *x = c * cos_obs + s * sin_obs;
+}
+
+/* The refraction (radians) for count zenith distances with sin s[] and cos c[], and the constants a, b. */
+static void refract_block(double a, double b, int count, const double s[], const double c[], double dz[]) {
+  int num_large = 0;
+  for (int i = 0; i < count; ++i) {
+    double y, x;
+    refraction_angle(a, b, s[i], c[i], &y, &x);
+    double u = y / x, u2 = u * u;
+    dz[i] = u * (1.0 - u2 * (1.0/3.0 - u2 * (1.0/5.0 - u2 * (1.0/7.0 - u2 * (1.0/9.0)))));
+    num_large += !(fabs(u) <= SERIES_LIMIT);
+  }
+  //low altitudes, beyond the series
+  for (int i = 0; num_large > 0 && i < count; ++i) {
+    double y, x;
+    refraction_angle(a, b, s[i], c[i], &y, &x);
+    if (!(fabs(y / x) <= SERIES_LIMIT)) {
+      dz[i] = atan2(y, x);
+      --num_large;
+    }
+  }
+}
+
+/*
+ The refraction for nwl sets of refraction constants refa[], refb[] (as from terse_alternate_iauRefcov) and n unrefracted
+ zenith distances zt[] (radians, 0 to pi): dz[k*n + i] = zt[i] - the observed zenith distance, for constants k,
+ as in iauAtioq. If iref is a valid index (0 to nwl-1), the results are differential: the refraction
+ less that for the constants iref (whose own results are then 0).
+*/
+void terse_alternate_iauRefzv(int nwl, const double refa[], const double refb[], int iref, int n, const double zt[], double dz[]) {
+  int differential = (iref >= 0 && iref < nwl);
+  for (int start = 0; start < n; start += BLOCK) {
+    int count = (n - start < BLOCK) ? n - start : BLOCK;
+    double s[BLOCK], c[BLOCK], reference[BLOCK];
+    for (int i = 0; i < count; ++i) {
+      s[i] = sin(zt[start + i]);
+      c[i] = cos(zt[start + i]);
+    }
+    if (differential) refract_block(refa[iref], refb[iref], count, s, c, reference);
+    for (int k = 0; k < nwl; ++k) {
+      double *out = dz + (size_t)k * n + start;
+      refract_block(refa[k], refb[k], count, s, c, out);
+      if (differential) {
+        for (int i = 0; i < count; ++i) out[i] -= reference[i];
+      }
+    }
+  }
+}
@@ -0,0 +1,69 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ A bitwise-reproducible mode for the batch, stepping and threaded functions, implemented in C99.
+
+ Regulated data products must come out bit-identical on every host, and for every thread count.
+ In this mode, the functions that honour it (listed below; no others) give results identical to the
+ scalar SOFA functions, whatever the number of threads:
+   - every sum is done in the same order as in the scalar function; no sum is ever split between threads.
+   - shortcuts and approximations, like the nutation stepper or the incremental Earth rotation angle,
+     aren't used.
+   - the CPU's flush-to-zero mode is turned off (see terse_alternate_iauFtz), in the thread that turns the mode on, and in
+     every thread while it runs a block of a batch. Turning the mode off restores that thread's previous
+     flush-to-zero state; turn it on and off in the same thread.
+   - a batch takes the mode as it is when the batch starts, for all of its blocks.
+
+ The other requirement is at build time: the compiler must not contract a*b + c into a fused
+ multiply-add, which rounds once instead of twice. GCC doesn't contract in the ISO modes (-std=c99),
+ but does by default in the GNU modes (-std=gnu99), when the target has FMA instructions.
+ Build with -ffp-contract=off to be sure; terse_alternate_iauReproducible reports a build that contracts.
+ (-ffast-math must never be used: it lets the compiler reorder sums, which vectorised loops then do.)
+
+ Honoured by: terse_alternate_iauNut00av, terse_alternate_iauAtciqv (in alternate-parallel.c), terse_alternate_iauIcrs2gv, terse_alternate_iauG2icrsv (alternate-galactic.c),
+ terse_alternate_iauPnm06av, terse_alternate_iauEpv00v, terse_alternate_iauC2t06av (alternate-epoch-range.c), terse_alternate_iauC2t06aDotv (alternate-c2t-rate.c).
+ Not terse_alternate_iauItrs2aev (alternate-topocentric.c), which no scalar SOFA function matches; see there.
+*/
+
+/* Only through the __atomic builtins: pool workers read it. */
+static int reproducible = 0;
+
+/* The flush-to-zero state before the mode was turned on, from terse_alternate_iauFtz; restored when it's turned off. */
+static int saved_ftz = -1;
+
+/* Inputs for the check, in volatile variables so that the compiler can't fold the expression. */
+static volatile double fma_a = 1.0 + 0x1p-30;
+static volatile double fma_b = 1.0 - 0x1p-30;
+static volatile double fma_c = -1.0;
+
+/* Returns 1 if this build contracts a*b + c into a fused multiply-add. */
+static int contracts_multiply_add(void) {
+  double a = fma_a, b = fma_b, c = fma_c;
+  //exactly, a*b + c = -2^-60; rounding a*b first gives 0
+  return (a * b + c) != 0.0;
+}
+
+/*
+ Turn the reproducible mode on (1) or off (0).
+ Returns the previous setting, or -1 if the mode is asked for, but this build contracts multiply-adds
+ (the mode is still turned on, but the results may differ from those of other builds).
+*/
+int terse_alternate_iauReproducible(int on) {
+  int previous = __atomic_exchange_n(&reproducible, on ? 1 : 0, __ATOMIC_ACQ_REL);
+  if (on) {
+    int ftz = terse_alternate_iauFtz(0);
+    if (!previous) saved_ftz = ftz;
+    if (contracts_multiply_add()) return -1;
+  } else if (previous) {
+    if (saved_ftz == 1) (void)terse_alternate_iauFtz(1);
+    saved_ftz = -1;
+  }
+  return previous;
+}
+
+/* Returns 1 if the reproducible mode is on, otherwise 0. */
+int terse_alternate_iauIsReproducible(void) {
+  return __atomic_load_n(&reproducible, __ATOMIC_ACQUIRE);
+}
@@ -1,7 +1,12 @@
+#define _POSIX_C_SOURCE 199309L
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <time.h>
+#include <pthread.h>
 #include "sofa.h"
+#include "sofam.h"
 #include "alternate-headers.h"
 
 /*
@@ -11,7 +16,7 @@
  Implemented in C99.
 
  An example of running the tests in PowerShell on Windows, in the current directory:
-   gcc $(Get-ChildItem -Path *.c -Name) -std=c99 -Wall -Werror -Wpedantic -o run_tests.exe
+   gcc $(Get-ChildItem -Path *.c -Name) -std=c99 -Wall -Werror -Wpedantic -pthread -o run_tests.exe
    ./run_tests.exe 
 */
 
@@ -40,7 +45,7 @@ static void check_date_to_jd(double expected, double result, const char *source,
 /* Output the result of checking expected-result versus actual-result. */
 static void check_jd_to_date(int expected_y, int expected_m, int expected_d, double expected_fd, 
     int result_y, int result_m, int result_d, double result_fd, const char *source, const int report){
-    short ok_fd = abs(expected_fd - result_fd) < __FLT_EPSILON__;
+    short ok_fd = fabs(expected_fd - result_fd) < __FLT_EPSILON__;
     short ok = (expected_y == result_y) &&  (expected_m == result_m) && (expected_d == result_d) && ok_fd;
     const char* message_a = ok ? SUCCESS : FAILURE;
     !ok ? ++num_errors : ++num_successful;
@@ -54,6 +59,13 @@ static void check_jd_to_date(int expected_y, int expected_m, int expected_d, dou
     }
 }
 
+/* Output the result of checking an expected-result versus an actual-result, within a tolerance. */
+static void check_near(const char *label, double expected, double result, double tolerance){
+    short ok = fabs(expected - result) <= tolerance;
+    !ok ? ++num_errors : ++num_successful;
+    printf("%s %s Expected: %.15g Result: %.15g\n", label, ok ? SUCCESS : FAILURE, expected, result);
+}
+
 static void report_error(int status){
     if (status != 0){
       printf("Error status: %d\n", status);
@@ -279,8 +291,1645 @@ static void add_timing (void (*func)(void)){
   printf("\nElapsed time: %d milliseconds.\n", (int)elapsed);
 }
 
-/* I have renamed the 'main' function found in t_sofa_c.c, in order to replace it with this 'main'.  */
-int main(void){
+/* The site, date and weather used in SOFA's test of iauAtco13. */
+static const double T_UTC1 = 2456384.5, T_UTC2 = 0.969254051, T_DUT1 = 0.1550675;
+static const double T_ELONG = -0.527800806, T_PHI = -1.2345856, T_HM = 2738.0;
+static const double T_XP = 2.47230737e-7, T_YP = 1.82640464e-6;
+static const double T_PHPA = 731.0, T_TC = 12.8, T_RH = 0.59, T_WL = 0.55;
+
+static void noop_for_latency(void *ctx, int i){
+    (void)ctx;
+    (void)i;
+}
+
+/* The absolute difference between two angles, after reduction into -pi..+pi. */
+static double angle_diff(double a, double b){
+    return fabs(iauAnpm(a - b));
+}
+
+/* The deterministic-time variants must agree with SOFA, and must stay finite at the zenith and the pole. */
+static void test_deterministic_time_mode(void){
+    printf("\nDeterministic-time mode versus iauAtco13, iauAtoiq.\n");
+    double worst = 0.0;
+    for (int i = 0; i < 200; ++i){
+        double rc = 0.0314 * i + 0.01;
+        double dc = asin(-0.99 + 0.0099 * i);
+        double a1, z1, h1, d1, r1, eo1, a2, z2, h2, d2, r2, eo2;
+        iauAtco13(rc, dc, 1e-5, 5e-6, 0.1, 55.0, T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, 
+            T_PHPA, T_TC, T_RH, T_WL, &a1, &z1, &h1, &d1, &r1, &eo1);
+        terse_alternate_iauAtco13d(rc, dc, 1e-5, 5e-6, 0.1, 55.0, T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, 
+            T_PHPA, T_TC, T_RH, T_WL, &a2, &z2, &h2, &d2, &r2, &eo2);
+        double diffs[] = {angle_diff(a1, a2), angle_diff(z1, z2), angle_diff(h1, h2), angle_diff(d1, d2), angle_diff(r1, r2)};
+        for (int k = 0; k < 5; ++k) {
+            if (diffs[k] > worst) worst = diffs[k];
+        }
+    }
+    check_near("ATCO13D max diff", 0.0, worst, 1e-12);
+
+    iauASTROM astrom;
+    double eo, ri, di, ri_d, di_d;
+    iauApco13(T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, T_PHPA, T_TC, T_RH, T_WL, &astrom, &eo);
+    iauAtoiq("A", 0.3, 0.7, &astrom, &ri, &di);
+    terse_alternate_iauAtoiqd("A", 0.3, 0.7, &astrom, &ri_d, &di_d);
+    check_near("ATOIQD ri", ri, ri_d, 1e-12);
+    check_near("ATOIQD di", di, di_d, 1e-12);
+
+    //a huge angle gives the same result as the reduced angle
+    terse_alternate_iauAtoiqd("A", 0.3 + 2e5 * D2PI, 0.7, &astrom, &ri_d, &di_d);
+    check_near("ATOIQD huge az", ri, ri_d, 1e-9);
+
+    //the zenith, with a subnormal offset
+    double aob, zob, hob, dob, rob;
+    iauAtoiq("A", 0.0, 0.0, &astrom, &ri, &di);
+    terse_alternate_iauAtioqd(ri, di, &astrom, &aob, &zob, &hob, &dob, &rob);
+    check_near("ATIOQD zenith zd", 0.0, zob, 1e-9);
+    terse_alternate_iauAtioqd(ri, di + 1e-310, &astrom, &aob, &zob, &hob, &dob, &rob);
+    check_near("ATIOQD subnormal zd", 0.0, zob, 1e-9);
+
+    //the latency harness returns ordered statistics
+    terse_alternate_iauLATENCY latency;
+    double scratch[100];
+    terse_alternate_latency_profile(noop_for_latency, NULL, 100, scratch, &latency);
+    short ordered = latency.p50 <= latency.p99 && latency.p99 <= latency.p9999 && latency.p9999 <= latency.max;
+    check_near("LATENCY ordered", 1.0, ordered, 0.0);
+}
+
+/* The output-selective variants must return exactly what iauAtioq and iauAtco13 return, for the selected outputs. */
+static void test_output_mask(void){
+    printf("\nOutput-selective ICRS-observed functions.\n");
+    double aob, zob, hob, dob, rob, eo;
+    double a, z, h, d, r, eo_m;
+    iauAtco13(2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, 
+        T_PHPA, T_TC, T_RH, T_WL, &aob, &zob, &hob, &dob, &rob, &eo);
+
+    terse_alternate_iauAtco13m(IAU_OBS_AZZD, 2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, 
+        T_PHPA, T_TC, T_RH, T_WL, &a, &z, NULL, NULL, NULL, &eo_m);
+    check_near("ATCO13M azzd aob", aob, a, 0.0);
+    check_near("ATCO13M azzd zob", zob, z, 0.0);
+    check_near("ATCO13M eo", eo, eo_m, 0.0);
+
+    terse_alternate_iauAtco13m(IAU_OBS_HADEC, 2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, 
+        T_PHPA, T_TC, T_RH, T_WL, NULL, NULL, &h, &d, NULL, &eo_m);
+    check_near("ATCO13M hadec hob", hob, h, 0.0);
+    check_near("ATCO13M hadec dob", dob, d, 0.0);
+
+    terse_alternate_iauAtco13m(IAU_OBS_RA, 2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, 
+        T_PHPA, T_TC, T_RH, T_WL, NULL, NULL, NULL, NULL, &r, &eo_m);
+    check_near("ATCO13M ra rob", rob, r, 0.0);
+
+    //batch, versus one-at-a-time
+    enum { N = 50 };
+    double rc[N], dc[N], az[N], zd[N], ha[N], dec[N];
+    for (int i = 0; i < N; ++i){
+        rc[i] = 0.12 * i;
+        dc[i] = -1.2 + 0.05 * i;
+    }
+    terse_alternate_iauAtco13mv(IAU_OBS_AZZD | IAU_OBS_HADEC, N, rc, dc, NULL, NULL, NULL, NULL, T_UTC1, T_UTC2, T_DUT1, 
+        T_ELONG, T_PHI, T_HM, T_XP, T_YP, T_PHPA, T_TC, T_RH, T_WL, az, zd, ha, dec, NULL, &eo_m);
+    int num_same = 0;
+    for (int i = 0; i < N; ++i){
+        iauAtco13(rc[i], dc[i], 0.0, 0.0, 0.0, 0.0, T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, 
+            T_PHPA, T_TC, T_RH, T_WL, &aob, &zob, &hob, &dob, &rob, &eo);
+        num_same += (aob == az[i] && zob == zd[i] && hob == ha[i] && dob == dec[i]);
+    }
+    check_near("ATCO13MV batch", N, num_same, 0.0);
+
+    iauASTROM astrom;
+    double ri[N], di[N];
+    iauApco13(T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, T_PHPA, T_TC, T_RH, T_WL, &astrom, &eo);
+    for (int i = 0; i < N; ++i){
+        iauAtciq(rc[i], dc[i], 0.0, 0.0, 0.0, 0.0, &astrom, &ri[i], &di[i]);
+    }
+    terse_alternate_iauAtioqmv(IAU_OBS_ZD, N, ri, di, &astrom, NULL, zd, NULL, NULL, NULL);
+    iauAtioq(ri[7], di[7], &astrom, &aob, &zob, &hob, &dob, &rob);
+    check_near("ATIOQMV zd", zob, zd[7], 0.0);
+}
+
+/* The largest absolute difference between the elements of two 3x3 matrices. */
+static double matrix_diff(double a[3][3], double b[3][3]){
+    double worst = 0.0;
+    for (int i = 0; i < 3; ++i){
+        for (int j = 0; j < 3; ++j){
+            double d = fabs(a[i][j] - b[i][j]);
+            if (d > worst) worst = d;
+        }
+    }
+    return worst;
+}
+
+/* The batch functions over a range of epochs must agree with the one-at-a-time SOFA functions. */
+static void test_epoch_range(void){
+    printf("\nBatch functions over a range of epochs.\n");
+    enum { N = 400 };
+    static double rbpn[N][3][3], pvh[N][2][3], pvb[N][2][3], rc2t[N][3][3];
+    terse_alternate_iauEPOCHS tt = {2460000.5, 0.25, 61.0 / 86400.0, N};
+    terse_alternate_iauEPOCHS ut1 = {2460000.5, 0.25 - 69.184 / 86400.0, 61.0 / 86400.0, N};
+
+    double d1, d2;
+    terse_alternate_iauEpochAt(&tt, 3, &d1, &d2);
+    check_near("EPOCHAT", 2460000.5 + 0.25 + 183.0 / 86400.0, d1 + d2, 1e-9);
+
+    terse_alternate_iauPnm06av(&tt, 0, rbpn);
+    int status = terse_alternate_iauEpv00v(&tt, 0, pvh, pvb);
+    check_near("EPV00V status", 0, status, 0);
+    terse_alternate_iauEPOCHS late = {2488500.5, 0.0, 1.0, 100};
+    check_near("EPV00V status after 2100", 1, terse_alternate_iauEpv00v(&late, 0, pvh, pvb), 0);
+    status = terse_alternate_iauEpv00v(&tt, 0, pvh, pvb);
+    terse_alternate_iauC2t06av(&tt, &ut1, 2.55060238e-7, 1.860359247e-6, rc2t);
+
+    double worst_pnm = 0.0, worst_pv = 0.0, worst_c2t = 0.0;
+    for (int i = 0; i < N; i += 7){
+        double r[3][3], h[2][3], b[2][3], c[3][3], u1, u2;
+        terse_alternate_iauEpochAt(&tt, i, &d1, &d2);
+        terse_alternate_iauEpochAt(&ut1, i, &u1, &u2);
+        iauPnm06a(d1, d2, r);
+        iauEpv00(d1, d2, h, b);
+        iauC2t06a(d1, d2, u1, u2, 2.55060238e-7, 1.860359247e-6, c);
+        if (matrix_diff(r, rbpn[i]) > worst_pnm) worst_pnm = matrix_diff(r, rbpn[i]);
+        double dpv = fabs(h[0][0] - pvh[i][0][0]) + fabs(b[1][2] - pvb[i][1][2]);
+        if (dpv > worst_pv) worst_pv = dpv;
+        if (matrix_diff(c, rc2t[i]) > worst_c2t) worst_c2t = matrix_diff(c, rc2t[i]);
+    }
+    check_near("PNM06AV max diff", 0.0, worst_pnm, 0.0);
+    check_near("EPV00V max diff", 0.0, worst_pv, 0.0);
+    check_near("C2T06AV max diff", 0.0, worst_c2t, 1e-12);
+}
+
+/* A constant source of Earth orientation parameters, for testing. */
+static void test_eop(void *ctx, double utc1, double utc2, double *dut1, double *xp, double *yp){
+    (void)ctx;
+    (void)utc1;
+    (void)utc2;
+    *dut1 = T_DUT1;
+    *xp = T_XP;
+    *yp = T_YP;
+}
+
+/* UT1-UTC that jumps by a second at the leap second at the end of 2016, as in the real series. */
+static void leap_eop(void *ctx, double utc1, double utc2, double *dut1, double *xp, double *yp){
+    (void)ctx;
+    *dut1 = (utc1 + utc2 < 2457754.5) ? -0.4086 : 0.5914;
+    *xp = T_XP;
+    *yp = T_YP;
+}
+
+/* The largest error of the almanac's Earth rotation angle within a day of the leap second at the end of 2016. */
+static double almanac_leap_error(terse_alternate_iauEOPFUNC eop){
+    const char *path = "test-almanac-leap.bin";
+    terse_alternate_iauALMANAC almanac;
+    double worst = 0.0;
+    if (terse_alternate_iauAlmanacWrite(path, 2457752.5, 0.0, 0.25, 16, eop, NULL) != 0 || terse_alternate_iauAlmanacOpen(path, 0, &almanac) != 0) return 1.0;
+    for (double utc2 = -1.0; utc2 < 1.0; utc2 += 0.0731){
+        double dut1 = 0.0, xp, yp, eo;
+        iauASTROM astrom, astrom_alm;
+        if (eop != NULL) eop(NULL, 2457754.5, utc2, &dut1, &xp, &yp);
+        iauApco13(2457754.5, utc2, dut1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, T_PHPA, T_TC, T_RH, T_WL, &astrom, &eo);
+        terse_alternate_iauAlmanacApco(&almanac, 2457754.5, utc2, NULL, T_ELONG, T_PHI, T_HM, T_PHPA, T_TC, T_RH, T_WL, &astrom_alm, &eo);
+        worst = fmax(worst, fabs(iauAnpm(astrom.eral - astrom_alm.eral)));
+    }
+    terse_alternate_iauAlmanacClose(&almanac);
+    remove(path);
+    return worst;
+}
+
+/* Observed places from the almanac must agree with those from iauApci13 and iauApco13. */
+static void test_almanac(void){
+    printf("\nMemory-mapped almanac.\n");
+    const char *path = "test-almanac.bin";
+    int status = terse_alternate_iauAlmanacWrite(path, 2456370.5, 0.0, 0.25, 121, test_eop, NULL);
+    check_near("ALMANAC write", 0, status, 0);
+    terse_alternate_iauALMANAC almanac;
+    status = terse_alternate_iauAlmanacOpen(path, 1, &almanac);
+    check_near("ALMANAC open", 0, status, 0);
+
+    double worst_ci = 0.0, worst_co = 0.0;
+    for (int i = 0; i < 40; ++i){
+        double utc2 = 0.0137 + 0.371 * i - 10.0, tai1, tai2, tt1, tt2, eo, eo_alm;
+        iauASTROM astrom, astrom_alm;
+        iauUtctai(T_UTC1, utc2, &tai1, &tai2);
+        iauTaitt(tai1, tai2, &tt1, &tt2);
+
+        double ri, di, ri_alm, di_alm;
+        iauApci13(tt1, tt2, &astrom, &eo);
+        terse_alternate_iauAlmanacApci(&almanac, tt1, tt2, &astrom_alm, &eo_alm);
+        iauAtciq(2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, &astrom, &ri, &di);
+        iauAtciq(2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, &astrom_alm, &ri_alm, &di_alm);
+        double d = fabs(ri - ri_alm) + fabs(di - di_alm) + fabs(eo - eo_alm);
+        if (d > worst_ci) worst_ci = d;
+
+        double a1, z1, h1, d1, r1, a2, z2, h2, d2, r2;
+        iauApco13(T_UTC1, utc2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, T_PHPA, T_TC, T_RH, T_WL, &astrom, &eo);
+        terse_alternate_iauAlmanacApco(&almanac, T_UTC1, utc2, NULL, T_ELONG, T_PHI, T_HM, T_PHPA, T_TC, T_RH, T_WL, &astrom_alm, &eo_alm);
+        iauAtciq(2.71, 0.174, 0.0, 0.0, 0.0, 0.0, &astrom, &ri, &di);
+        iauAtioq(ri, di, &astrom, &a1, &z1, &h1, &d1, &r1);
+        iauAtciq(2.71, 0.174, 0.0, 0.0, 0.0, 0.0, &astrom_alm, &ri, &di);
+        iauAtioq(ri, di, &astrom_alm, &a2, &z2, &h2, &d2, &r2);
+        d = angle_diff(a1, a2) + fabs(z1 - z2) + fabs(eo - eo_alm);
+        if (d > worst_co) worst_co = d;
+    }
+    check_near("ALMANAC apci max diff", 0.0, worst_ci, 5e-11);
+    check_near("ALMANAC apco max diff", 0.0, worst_co, 5e-11);
+
+    iauASTROM astrom, astrom_alm;
+    double eo, eo_alm, eop[3] = { -0.2174, 3.1e-6, 1.7e-6 };
+    iauApco13(T_UTC1, -5.37, eop[0], T_ELONG, T_PHI, T_HM, eop[1], eop[2], T_PHPA, T_TC, T_RH, T_WL, &astrom, &eo);
+    terse_alternate_iauAlmanacApco(&almanac, T_UTC1, -5.37, eop, T_ELONG, T_PHI, T_HM, T_PHPA, T_TC, T_RH, T_WL, &astrom_alm, &eo_alm);
+    check_near("ALMANAC apco EOP override, ERA", astrom.eral, astrom_alm.eral, 1e-11);
+    check_near("ALMANAC apco EOP override, polar motion", astrom.xpl + astrom.ypl, astrom_alm.xpl + astrom_alm.ypl, 1e-14);
+    status = terse_alternate_iauAlmanacApci(&almanac, 2456300.5, 0.0, &astrom, &eo);
+    check_near("ALMANAC out of range", -1, status, 0);
+    terse_alternate_iauAlmanacClose(&almanac);
+
+    //UT1-UTC isn't interpolated across a leap second, whether or not it jumps there
+    check_near("ALMANAC ERA across leap second, no EOP", 0.0, almanac_leap_error(NULL), 1e-11);
+    check_near("ALMANAC ERA across leap second, EOP", 0.0, almanac_leap_error(leap_eop), 1e-11);
+
+    //a file from a host with the other byte order: the byte-order mark, after the magic and 3 ints, is reversed
+    FILE *file = fopen(path, "r+b");
+    unsigned char mark[4], reversed[4];
+    fseek(file, 20, SEEK_SET);
+    if (fread(mark, 1, 4, file) != 4) mark[0] = mark[1] = mark[2] = mark[3] = 0;
+    for (int i = 0; i < 4; ++i) reversed[i] = mark[3 - i];
+    fseek(file, 20, SEEK_SET);
+    fwrite(reversed, 1, 4, file);
+    fclose(file);
+    check_near("ALMANAC other byte order", -2, terse_alternate_iauAlmanacOpen(path, 0, &almanac), 0);
+    file = fopen(path, "r+b");
+    fseek(file, 20, SEEK_SET);
+    fwrite(mark, 1, 4, file);
+    fclose(file);
+
+    //corrupt one byte of the records
+    file = fopen(path, "r+b");
+    fseek(file, 1000, SEEK_SET);
+    fputc(0x5a, file);
+    fclose(file);
+    status = terse_alternate_iauAlmanacOpen(path, 1, &almanac);
+    check_near("ALMANAC bad checksum", -3, status, 0);
+
+    //the header is checksummed too: a different step, at offset 40
+    double step = 0.5;
+    terse_alternate_iauAlmanacWrite(path, 2456370.5, 0.0, 0.25, 8, NULL, NULL);
+    file = fopen(path, "r+b");
+    fseek(file, 40, SEEK_SET);
+    fwrite(&step, sizeof step, 1, file);
+    fclose(file);
+    check_near("ALMANAC bad header checksum", -3, terse_alternate_iauAlmanacOpen(path, 1, &almanac), 0);
+    remove(path);
+
+    //the tool, with Earth orientation from an IERS finals file, across the leap second at the end of 2016
+    const char *finals_path = "test-finals.data";
+    const char *dates[] = { "161229", "161230", "161231", "170101", "170102", "170103" };
+    file = fopen(finals_path, "w");
+    for (int day = 0; day < 6; ++day){
+        double dut1 = (day < 3) ? -0.4080 - 0.0003 * day : 0.5910 - 0.0003 * day;
+        fprintf(file, "%s %8.2f I %9.6f%9.6f %9.6f%9.6f  I%10.7f\n", dates[day], 57751.0 + day,
+            0.05 + 0.001 * day, 0.0001, 0.28 - 0.002 * day, 0.0001, dut1);
+    }
+    fclose(file);
+    char *argv_tool[] = { "run_tests", "almanac", (char *)path, "2457752.5", "3", "0.25", (char *)finals_path };
+    check_near("ALMANAC tool with finals file", 0, terse_alternate_run_almanac_tool(7, argv_tool), 0);
+    //at the nodes, the UT1-UTC and polar motion are those interpolated from the file at the node's UTC
+    double record[ALMANAC_RECORD_SIZE], utc1, utc2, tai1, tai2;
+    terse_alternate_iauAlmanacOpen(path, 1, &almanac);
+    terse_alternate_iauAlmanacInterp(&almanac, 2457753.5, -0.25, record);
+    iauTttai(2457753.5, -0.25, &tai1, &tai2);
+    iauTaiutc(tai1, tai2, &utc1, &utc2);
+    double f = (utc1 - 2457753.5) + utc2;
+    check_near("ALMANAC finals UT1-UTC before leap", -0.4086 - 0.0003 * f, record[13], 1e-9);
+    check_near("ALMANAC finals xp", (0.052 + 0.001 * f) * DAS2R, record[14], 1e-15);
+    terse_alternate_iauAlmanacInterp(&almanac, 2457754.5, 0.25, record);
+    iauTttai(2457754.5, 0.25, &tai1, &tai2);
+    iauTaiutc(tai1, tai2, &utc1, &utc2);
+    f = (utc1 - 2457754.5) + utc2;
+    check_near("ALMANAC finals UT1-UTC after leap", 0.5901 - 0.0003 * f, record[13], 1e-9);
+    terse_alternate_iauAlmanacClose(&almanac);
+    argv_tool[4] = "20";
+    check_near("ALMANAC tool past the end of the finals file", 1, terse_alternate_run_almanac_tool(7, argv_tool), 0);
+    remove(finals_path);
+    remove(path);
+}
+
+/* The evaluators that read the packed tables must give bit-identical results. */
+static void test_packed_tables(void){
+    printf("\nPacked series tables.\n");
+    int num_same_nut = 0, num_same_xy = 0, num = 0;
+    for (double d2 = -200000.0; d2 <= 200000.0; d2 += 3917.3, ++num){
+        double dpsi1, deps1, dpsi2, deps2, x1, y1, x2, y2;
+        iauNut00a(2451545.0, d2, &dpsi1, &deps1);
+        terse_alternate_iauNut00aPacked(2451545.0, d2, &dpsi2, &deps2);
+        iauXy06(2451545.0, d2, &x1, &y1);
+        terse_alternate_iauXy06Packed(2451545.0, d2, &x2, &y2);
+        num_same_nut += (dpsi1 == dpsi2 && deps1 == deps2);
+        num_same_xy += (x1 == x2 && y1 == y2);
+    }
+    check_near("NUT00APACKED identical", num, num_same_nut, 0.0);
+    check_near("XY06PACKED identical", num, num_same_xy, 0.0);
+}
+
+/* The largest difference between the nutation stepper and iauNut00a, over n epochs. */
+static double nutation_stepper_error(double step, int n){
+    static terse_alternate_iauNUTSTEP ns;
+    double worst = 0.0;
+    terse_alternate_iauNutStepInit(&ns, 2451545.0, 8123.25, step, 0);
+    for (int i = 0; i < n; ++i){
+        double dpsi1, deps1, dpsi2, deps2;
+        iauNut00a(2451545.0, 8123.25 + i * step, &dpsi1, &deps1);
+        terse_alternate_iauNutStep(&ns, &dpsi2, &deps2);
+        worst = fmax(worst, fmax(fabs(dpsi1 - dpsi2), fabs(deps1 - deps2)));
+    }
+    return worst;
+}
+
+/* The stepper's accuracy versus fresh evaluation, for a range of step sizes, across several refreshes. */
+static void test_nutation_stepper(void){
+    printf("\nNutation stepper.\n");
+    check_near("NUTSTEP 1 s", 0.0, nutation_stepper_error(1.0 / 86400.0, 1000), 1e-16);
+    check_near("NUTSTEP 1 min", 0.0, nutation_stepper_error(1.0 / 1440.0, 1000), 1e-16);
+    check_near("NUTSTEP 1 h", 0.0, nutation_stepper_error(1.0 / 24.0, 1000), 1e-15);
+    check_near("NUTSTEP 1 d", 0.0, nutation_stepper_error(1.0, 1000), 1e-12);
+}
+
+/* In the reproducible mode, the threaded batches must be identical to the scalar functions, for any number of threads. */
+/* Marks the items whose block ran with flush-to-zero on, by a product that would be subnormal. */
+static volatile double smallest_normal = 0x1p-1022;
+static int flushed[2000];
+
+static void mark_flushed(void *ctx, int begin, int end){
+    (void)ctx;
+    for (int i = begin; i < end; ++i) flushed[i] = (smallest_normal * 0.5 == 0.0);
+}
+
+static void test_reproducible_mode(void){
+    printf("\nReproducible mode.\n");
+    enum { N = 700 };
+    static double dpsi[N], deps[N], ri[N], di[N], rc[N], dc[N], pr[N], pd[N];
+    terse_alternate_iauEPOCHS tt = {2451545.0, 9000.125, 1.0 / 86400.0, N};
+    iauASTROM astrom;
+    double eo;
+    iauApci13(2456165.5, 0.401182685, &astrom, &eo);
+    for (int i = 0; i < N; ++i){
+        rc[i] = 0.009 * i;
+        dc[i] = -1.2 + 0.0035 * i;
+        pr[i] = 1e-7 * (i % 11);
+        pd[i] = -2e-7 * (i % 7);
+    }
+
+    check_near("REPRODUCIBLE contraction", 0, terse_alternate_iauReproducible(1), 0.0);
+    int threads[] = {1, 3, 8};
+    for (int k = 0; k < 3; ++k){
+        int num_identical = 0;
+        terse_alternate_iauNut00av(&tt, threads[k], dpsi, deps);
+        terse_alternate_iauAtciqv(N, threads[k], rc, dc, pr, pd, NULL, NULL, &astrom, ri, di);
+        for (int i = 0; i < N; ++i){
+            double dpsi1, deps1, ri1, di1, d1, d2;
+            terse_alternate_iauEpochAt(&tt, i, &d1, &d2);
+            iauNut00a(d1, d2, &dpsi1, &deps1);
+            iauAtciq(rc[i], dc[i], pr[i], pd[i], 0.0, 0.0, &astrom, &ri1, &di1);
+            num_identical += (dpsi[i] == dpsi1 && deps[i] == deps1 && ri[i] == ri1 && di[i] == di1);
+        }
+        char label[64];
+        sprintf(label, "REPRODUCIBLE %d threads identical", threads[k]);
+        check_near(label, N, num_identical, 0.0);
+    }
+
+    //the Earth rotation angle is computed afresh at each epoch
+    static double rc2t[N][3][3], rc2t1[N][3][3], rc2tdot[N][3][3];
+    terse_alternate_iauEPOCHS ut1 = {2451545.0, 9000.125 - 64.0 / 86400.0, 1.0 / 86400.0, N};
+    terse_alternate_iauC2t06av(&tt, &ut1, 2.55060238e-7, 1.860359247e-6, rc2t);
+    terse_alternate_iauC2t06aDotv(&tt, &ut1, 2.55060238e-7, 1.860359247e-6, 1e-9, -2e-9, rc2t1, rc2tdot);
+    int num_c2t = 0, num_c2tdot = 0;
+    for (int i = 0; i < N; ++i){
+        double d1, d2, u1, u2, c[3][3], c1[3][3], cdot[3][3];
+        terse_alternate_iauEpochAt(&tt, i, &d1, &d2);
+        terse_alternate_iauEpochAt(&ut1, i, &u1, &u2);
+        iauC2t06a(d1, d2, u1, u2, 2.55060238e-7, 1.860359247e-6, c);
+        num_c2t += !memcmp(c, rc2t[i], sizeof c);
+        terse_alternate_iauC2t06aDot(d1, d2, u1, u2, 2.55060238e-7, 1.860359247e-6, 1e-9, -2e-9, c1, cdot);
+        num_c2tdot += !memcmp(c1, rc2t1[i], sizeof c1) && !memcmp(cdot, rc2tdot[i], sizeof cdot);
+    }
+    check_near("REPRODUCIBLE C2T06AV identical", N, num_c2t, 0.0);
+    check_near("REPRODUCIBLE C2T06ADOTV identical", N, num_c2tdot, 0.0);
+    terse_alternate_iauReproducible(0);
+
+    //flush-to-zero is off in the pool's threads too, even those started with it on
+    if (terse_alternate_iauFtz(1) >= 0){
+        terse_alternate_iauPoolStop();
+        terse_alternate_iauParallelFor(2000, 4, mark_flushed, NULL);
+        int num_flushed = 0;
+        for (int i = 0; i < 2000; ++i) num_flushed += flushed[i];
+        check_near("REPRODUCIBLE flush-to-zero on outside the mode", 2000, num_flushed, 0.0);
+        terse_alternate_iauReproducible(1);
+        terse_alternate_iauParallelFor(2000, 4, mark_flushed, NULL);
+        num_flushed = 0;
+        for (int i = 0; i < 2000; ++i) num_flushed += flushed[i];
+        check_near("REPRODUCIBLE flush-to-zero off in the threads", 0, num_flushed, 0.0);
+        terse_alternate_iauReproducible(0);
+        check_near("REPRODUCIBLE flush-to-zero restored", 1, terse_alternate_iauFtz(0), 0.0);
+        terse_alternate_iauPoolStop();
+    }
+
+    //outside the mode, the stepper is used, and the results are close but not identical
+    terse_alternate_iauNut00av(&tt, 3, dpsi, deps);
+    double worst = 0.0;
+    for (int i = 0; i < N; ++i){
+        double dpsi1, deps1, d1, d2;
+        terse_alternate_iauEpochAt(&tt, i, &d1, &d2);
+        iauNut00a(d1, d2, &dpsi1, &deps1);
+        worst = fmax(worst, fmax(fabs(dpsi[i] - dpsi1), fabs(deps[i] - deps1)));
+    }
+    check_near("NUT00AV stepper", 0.0, worst, 1e-16);
+}
+
+/* POSIX time to TAI the slow way, through calendar fields, as the conversions in alternate-timestamps.c replace. */
+static int unix_to_tai_by_calendar(long long unix_ns, double *tai1, double *tai2){
+    long long s = unix_ns / 1000000000LL;
+    long long ns = unix_ns % 1000000000LL;
+    if (ns < 0){ ns += 1000000000LL; --s; }
+    long long day = s / 86400 - (s % 86400 < 0 ? 1 : 0);
+    long long sod = s - day * 86400;
+    int iy, im, id, j;
+    double fd, utc1, utc2;
+    iauJd2cal(2440587.5 + day, 0.0, &iy, &im, &id, &fd);
+    j = iauDtf2d("UTC", iy, im, id, (int)(sod / 3600), (int)(sod / 60 % 60), (sod % 60) + ns * 1e-9, &utc1, &utc2);
+    if (j < 0) return j;
+    return iauUtctai(utc1, utc2, tai1, tai2);
+}
+
+static void test_timestamps(void){
+    printf("\nPOSIX and GNSS timestamps.\n");
+    double worst = 0.0, tai1, tai2, tai1_slow, tai2_slow, tt1, tt2;
+    int num_round_trips = 0, num = 0;
+    //from 1972 to 2035, in steps of a little more than 11 days
+    for (long long t = 63072000LL * 1000000000LL; t < 2051222400LL * 1000000000LL; t += 987654321012345LL, ++num){
+        terse_alternate_iauUnixToTai(t, &tai1, &tai2);
+        unix_to_tai_by_calendar(t, &tai1_slow, &tai2_slow);
+        worst = fmax(worst, fabs((tai1 - tai1_slow) + (tai2 - tai2_slow)) * 86400.0);
+        long long back;
+        terse_alternate_iauTaiToUnix(tai1, tai2, &back);
+        num_round_trips += (back == t);
+    }
+    check_near("UNIXTOTAI max diff from calendar (s)", 0.0, worst, 1e-6);
+    check_near("TAITOUNIX round trips", num, num_round_trips, 0.0);
+
+    //across the leap second at the end of 2016: 23:59:59.5 and 00:00:00.5 UTC are 2 s apart in TAI
+    long long before = 1483228799500000000LL, after = 1483228800500000000LL, back = 0;
+    double tai1_after, tai2_after;
+    terse_alternate_iauUnixToTai(before, &tai1, &tai2);
+    terse_alternate_iauUnixToTai(after, &tai1_after, &tai2_after);
+    check_near("UNIXTOTAI leap second", 2.0, ((tai1_after - tai1) + (tai2_after - tai2)) * 86400.0, 1e-9);
+    terse_alternate_iauTaiToUnix(tai1, tai2 + 1.0 / 86400.0, &back); //23:59:60.5 repeats 23:59:59.5
+    check_near("TAITOUNIX during leap second", (double)before, (double)back, 0.0);
+    check_near("UNIXTOTAI status 2016", 0, terse_alternate_iauUnixToTai(after, &tai1, &tai2), 0.0);
+    check_near("UNIXTOTAI status 1970", -1, terse_alternate_iauUnixToTai(0, &tai1, &tai2), 0.0);
+
+    //TT
+    terse_alternate_iauUnixToTt(after, &tt1, &tt2);
+    check_near("UNIXTOTT TT-TAI (s)", 32.184, ((tt1 - tai1_after) + (tt2 - tai2_after)) * 86400.0, 1e-9);
+    terse_alternate_iauTtToUnix(tt1, tt2, &back);
+    check_near("TTTOUNIX", (double)after, (double)back, 0.0);
+
+    //GNSS: GPS week 0 starts at 1980 January 6 0h UTC, when TAI-UTC was 19 s
+    int week;
+    double sow;
+    terse_alternate_iauGnssToTai(IAU_GNSS_GPS, 0, 0.0, &tai1, &tai2);
+    check_near("GNSSTOTAI GPS epoch (s)", 19.0, ((tai1 - 2444244.5) + tai2) * 86400.0, 1e-9);
+    terse_alternate_iauGnssToTai(IAU_GNSS_GALILEO, 3, 1234.5, &tai1_slow, &tai2_slow);
+    terse_alternate_iauGnssToTai(IAU_GNSS_GPS, 1027, 1234.5, &tai1, &tai2);
+    check_near("GNSSTOTAI Galileo", 0.0, ((tai1 - tai1_slow) + (tai2 - tai2_slow)) * 86400.0, 0.0);
+    terse_alternate_iauGnssToTai(IAU_GNSS_BEIDOU, 0, 0.0, &tai1_slow, &tai2_slow);
+    terse_alternate_iauGnssToTai(IAU_GNSS_GPS, 1356, 14.0, &tai1, &tai2);
+    check_near("GNSSTOTAI BeiDou", 0.0, ((tai1 - tai1_slow) + (tai2 - tai2_slow)) * 86400.0, 0.0);
+    terse_alternate_iauGnssToTai(IAU_GNSS_GPS, 2345, 345600.123456789, &tai1, &tai2);
+    terse_alternate_iauTaiToGnss(IAU_GNSS_GPS, tai1, tai2, &week, &sow);
+    check_near("TAITOGNSS week", 2345, week, 0.0);
+    check_near("TAITOGNSS sow", 345600.123456789, sow, 1e-9);
+    check_near("GNSSTOTAI bad system", -1, terse_alternate_iauGnssToTai(7, 0, 0.0, &tai1, &tai2), 0.0);
+
+    //the batch forms agree with the single forms
+    long long stamps[5] = {before, after, after + 1, 1700000000123456789LL, 1500000000000000000LL};
+    double b1[5], b2[5];
+    long long b_back[5];
+    int num_same = 0;
+    terse_alternate_iauUnixToTtv(5, stamps, b1, b2);
+    for (int i = 0; i < 5; ++i){
+        terse_alternate_iauUnixToTt(stamps[i], &tt1, &tt2);
+        num_same += (tt1 == b1[i] && tt2 == b2[i]);
+    }
+    terse_alternate_iauUnixToTaiv(5, stamps, b1, b2);
+    terse_alternate_iauTaiToUnixv(5, b1, b2, b_back);
+    for (int i = 0; i < 5; ++i){
+        num_same += (b_back[i] == stamps[i]);
+    }
+    check_near("UNIXTOTTV, UNIXTOTAIV, TAITOUNIXV", 10, num_same, 0.0);
+}
+
+/* UTC differences and sums agree with going through iauUtctai and iauTaiutc, including across leap seconds. */
+static void test_utc_intervals(void){
+    printf("\nUTC interval arithmetic.\n");
+    enum { N = 4000 };
+    static double a1[N], a2[N], b1[N], b2[N], dt[N], c1[N], c2[N];
+    srand(86);
+    for (int i = 0; i < N; ++i){
+        //from 1962 to 2030; half of the pairs are close together, the others up to 3 years apart
+        a1[i] = 2437665.5 + floor(24800.0 * rand() / RAND_MAX);
+        a2[i] = (double)rand() / RAND_MAX;
+        b1[i] = a1[i] + floor((i % 2 ? 1000.0 : 2.0) * rand() / RAND_MAX);
+        b2[i] = (double)rand() / RAND_MAX;
+    }
+    //the leap second at the end of 2016: 23:59:59 to 00:00:00, and 23:59:60.5
+    iauDtf2d("UTC", 2016, 12, 31, 23, 59, 59.0, &a1[0], &a2[0]);
+    iauDtf2d("UTC", 2017, 1, 1, 0, 0, 0.0, &b1[0], &b2[0]);
+    iauDtf2d("UTC", 2016, 12, 31, 23, 59, 60.5, &b1[1], &b2[1]);
+    a1[1] = a1[0]; a2[1] = a2[0];
+
+    //the dates run past the end of the iauDat table, so the status may be +1
+    check_near("UTCDIFFV status not an error", 0, terse_alternate_iauUtcDiffv(N, a1, a2, b1, b2, dt) < 0, 0.0);
+    check_near("UTCDIFFV across leap second", 2.0, dt[0], 1e-9);
+    double worst = 0.0;
+    for (int i = 0; i < N; ++i){
+        double ta1, ta2, tb1, tb2;
+        iauUtctai(a1[i], a2[i], &ta1, &ta2);
+        iauUtctai(b1[i], b2[i], &tb1, &tb2);
+        worst = fmax(worst, fabs(((tb1 - ta1) + (tb2 - ta2)) * 86400.0 - dt[i]));
+    }
+    check_near("UTCDIFFV max diff from iauUtctai (s)", 0.0, worst, 1e-6);
+
+    //adding the differences back gives b again
+    terse_alternate_iauUtcAddv(N, a1, a2, dt, c1, c2);
+    worst = 0.0;
+    for (int i = 0; i < N; ++i){
+        worst = fmax(worst, fabs((c1[i] - b1[i]) + (c2[i] - b2[i])) * 86400.0);
+    }
+    check_near("UTCADDV max diff (s)", 0.0, worst, 1e-6);
+    double one = 1.5, e1, e2;
+    terse_alternate_iauUtcAddv(1, &a1[0], &a2[0], &one, &c1[0], &c2[0]);
+    iauDtf2d("UTC", 2016, 12, 31, 23, 59, 60.5, &e1, &e2);
+    check_near("UTCADDV into leap second (s)", 0.0, ((c1[0] - e1) + (c2[0] - e2)) * 86400.0, 1e-9);
+}
+
+/* The current epoch agrees with the system clock converted by terse_alternate_iauUnixToTai, and UT1 with the EOP. */
+static void test_now(void){
+    printf("\nCurrent epoch.\n");
+    terse_alternate_iauCLOCK clock;
+    double tai1, tai2, tt1, tt2, ut11, ut12, check1, check2, dut1, xp, yp;
+    terse_alternate_iauClockInit(&clock, test_eop, NULL);
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    int status = terse_alternate_iauNow(&clock, &tai1, &tai2, &tt1, &tt2, &ut11, &ut12);
+    terse_alternate_iauUnixToTai((long long)ts.tv_sec * 1000000000LL + ts.tv_nsec, &check1, &check2);
+    check_near("NOW status", 0, status, 0.0);
+    check_near("NOW TAI vs clock (s)", 0.0, ((tai1 - check1) + (tai2 - check2)) * 86400.0, 0.01);
+    check_near("NOW TT-TAI (s)", 32.184, ((tt1 - tai1) + (tt2 - tai2)) * 86400.0, 1e-6);
+    test_eop(NULL, tai1, tai2, &dut1, &xp, &yp);
+    double utc1, utc2;
+    iauTaiutc(tai1, tai2, &utc1, &utc2);
+    check_near("NOW UT1-UTC (s)", dut1, ((ut11 - utc1) + (ut12 - utc2)) * 86400.0, 1e-6);
+    check_near("NOW without outputs", 0, terse_alternate_iauNow(&clock, NULL, NULL, NULL, NULL, NULL, NULL), 0.0);
+}
+
+/* Gaia-like standard deviations, in the units of iauStarpm: 0.1 mas, 0.1 mas/yr, 0.1 mas, 1 km/s. */
+static const double GAIA_SIGMA[6] = {4.8e-10, 4.8e-10, 4.8e-10, 4.8e-10, 1e-4, 1.0};
+
+/*
+ Propagate a Gaia-like covariance with the analytic Jacobian, and with one from central differences of
+ iauStarpm (or iauPmsafe, if safe). Returns the largest difference between the two, in units of the
+ propagated standard deviations.
+*/
+static double starpm_covariance_error(const double star[6], double years, int safe){
+    static const double h[6] = {1e-7, 1e-7, 1e-10, 1e-10, 1e-6, 1e-3};
+    double out[6], jac[6][6], numeric[6][6], plus[6], minus[6], cov[6][6], cov_a[6][6], cov_n[6][6];
+    (safe ? terse_alternate_iauPmsafeJac : terse_alternate_iauStarpmJac)(star[0], star[1], star[2], star[3], star[4], star[5], 2457389.0, 0.0,
+        2457389.0, years * DJY, &out[0], &out[1], &out[2], &out[3], &out[4], &out[5], jac);
+    for (int k = 0; k < 6; ++k){
+        double a[6], b[6];
+        memcpy(a, star, sizeof a);
+        memcpy(b, star, sizeof b);
+        a[k] += h[k];
+        b[k] -= h[k];
+        (safe ? iauPmsafe : iauStarpm)(a[0], a[1], a[2], a[3], a[4], a[5], 2457389.0, 0.0, 2457389.0, years * DJY,
+            &plus[0], &plus[1], &plus[2], &plus[3], &plus[4], &plus[5]);
+        (safe ? iauPmsafe : iauStarpm)(b[0], b[1], b[2], b[3], b[4], b[5], 2457389.0, 0.0, 2457389.0, years * DJY,
+            &minus[0], &minus[1], &minus[2], &minus[3], &minus[4], &minus[5]);
+        for (int i = 0; i < 6; ++i){
+            numeric[i][k] = (i == 0 ? iauAnpm(plus[i] - minus[i]) : plus[i] - minus[i]) / (2.0 * h[k]);
+        }
+    }
+    for (int i = 0; i < 6; ++i){
+        for (int k = 0; k < 6; ++k){
+            //with a correlation between the positions and proper motions
+            cov[i][k] = (i == k) ? GAIA_SIGMA[i] * GAIA_SIGMA[i] : (abs(i - k) == 2 && i < 4 && k < 4) ? 0.3 * GAIA_SIGMA[i] * GAIA_SIGMA[k] : 0.0;
+        }
+    }
+    terse_alternate_iauCovProp(jac, cov, cov_a);
+    terse_alternate_iauCovProp(numeric, cov, cov_n);
+    double worst = 0.0;
+    for (int i = 0; i < 6; ++i){
+        for (int k = 0; k < 6; ++k){
+            worst = fmax(worst, fabs(cov_a[i][k] - cov_n[i][k]) / sqrt(cov_n[i][i] * cov_n[k][k]));
+        }
+    }
+    return worst;
+}
+
+static void test_epoch_propagation(void){
+    printf("\nEpoch propagation with covariances.\n");
+    //Barnard's star, a distant star, and a star near the pole
+    double stars[3][6] = {
+        {4.702667, 0.08292, -3.88e-6, 4.99e-5, 0.547, -110.6},
+        {1.234, -0.5, 2e-9, -1e-9, 0.0012, 25.0},
+        {0.3, 1.55, 1e-7, 3e-8, 0.02, -15.0}};
+    double worst = 0.0;
+    for (int i = 0; i < 3; ++i){
+        worst = fmax(worst, starpm_covariance_error(stars[i], 30.0, 0));
+        worst = fmax(worst, starpm_covariance_error(stars[i], -100.0, 0));
+    }
+    //about v/c for Barnard's star; 1e-5 for the others
+    check_near("STARPMJAC covariance vs differences (sigmas)", 0.0, worst, 1e-3);
+
+    //a parallax clamped to the minimum has no derivatives
+    double out_c[6], jac_c[6][6], clamped = 0.0;
+    terse_alternate_iauStarpmJac(1.234, -0.5, 2e-9, -1e-9, 0.0, 25.0, 2457389.0, 0.0, 2451545.0, 0.0,
+        &out_c[0], &out_c[1], &out_c[2], &out_c[3], &out_c[4], &out_c[5], jac_c);
+    for (int i = 0; i < 6; ++i) clamped = fmax(clamped, fabs(jac_c[i][4]));
+    check_near("STARPMJAC clamped parallax", 0.0, clamped, 0.0);
+
+    //iauPmsafe: a parallax overridden by the proper motion (negative, as in Gaia, so that the differences
+    //stay clear of where the override begins), and one left alone
+    double safe_stars[2][6] = {
+        {1.234, -0.5, 2e-8, -1e-8, -1e-5, 25.0},
+        {4.702667, 0.08292, -3.88e-6, 4.99e-5, 0.547, -110.6}};
+    worst = 0.0;
+    for (int i = 0; i < 2; ++i){
+        worst = fmax(worst, starpm_covariance_error(safe_stars[i], 30.0, 1));
+        worst = fmax(worst, starpm_covariance_error(safe_stars[i], -100.0, 1));
+    }
+    check_near("PMSAFEJAC covariance vs differences (sigmas)", 0.0, worst, 1e-3);
+    //and one overridden by the minimum, which leaves no derivatives with respect to the parallax given
+    terse_alternate_iauPmsafeJac(0.3, 1.2, 1e-12, 3e-13, -1e-5, -15.0, 2457389.0, 0.0, 2451545.0, 0.0,
+        &out_c[0], &out_c[1], &out_c[2], &out_c[3], &out_c[4], &out_c[5], jac_c);
+    clamped = 0.0;
+    for (int i = 0; i < 6; ++i) clamped = fmax(clamped, fabs(jac_c[i][4]));
+    check_near("PMSAFEJAC minimum parallax", 0.0, clamped, 0.0);
+    double out_s[6], jac_s[6][6];
+    int safe_status = terse_alternate_iauPmsafeJac(safe_stars[0][0], safe_stars[0][1], safe_stars[0][2], safe_stars[0][3], safe_stars[0][4],
+        safe_stars[0][5], 2457389.0, 0.0, 2451545.0, 0.0, &out_s[0], &out_s[1], &out_s[2], &out_s[3], &out_s[4], &out_s[5], jac_s);
+    double expected[6];
+    check_near("PMSAFEJAC status", iauPmsafe(safe_stars[0][0], safe_stars[0][1], safe_stars[0][2], safe_stars[0][3],
+        safe_stars[0][4], safe_stars[0][5], 2457389.0, 0.0, 2451545.0, 0.0, &expected[0], &expected[1], &expected[2],
+        &expected[3], &expected[4], &expected[5]), safe_status, 0.0);
+    check_near("PMSAFEJAC same parameters", 0, memcmp(out_s, expected, sizeof out_s), 0.0);
+
+    //the batch gives the same as one star at a time
+    enum { N = 40 };
+    static double ra[N], dec[N], pmr[N], pmd[N], px[N], rv[N], ra2[N], dec2[N], pmr2[N], pmd2[N], px2[N], rv2[N];
+    static double cov1[N][6][6], cov2[N][6][6];
+    int status[N];
+    for (int i = 0; i < N; ++i){
+        ra[i] = 0.15 * i;
+        dec[i] = -1.4 + 0.07 * i;
+        pmr[i] = 1e-8 * (i % 7);
+        pmd[i] = -2e-8 * (i % 5);
+        px[i] = 0.001 + 0.002 * i;
+        rv[i] = -30.0 + 1.5 * i;
+        memset(cov1[i], 0, sizeof cov1[i]);
+        for (int k = 0; k < 6; ++k) cov1[i][k][k] = GAIA_SIGMA[k] * GAIA_SIGMA[k];
+    }
+    terse_alternate_iauCSTARS in = {N, ra, dec, pmr, pmd, px, rv};
+    terse_alternate_iauSTARS out = {N, ra2, dec2, pmr2, pmd2, px2, rv2};
+    check_near("STARPMCOVV status", 0, terse_alternate_iauStarpmCovv(&in, 2457389.0, 0.0, 2451545.0, 0.0, cov1, &out, cov2, status, 3), 0.0);
+    int num_same = 0;
+    for (int i = 0; i < N; ++i){
+        double r[6], jac[6][6], c[6][6];
+        terse_alternate_iauStarpmJac(ra[i], dec[i], pmr[i], pmd[i], px[i], rv[i], 2457389.0, 0.0, 2451545.0, 0.0,
+            &r[0], &r[1], &r[2], &r[3], &r[4], &r[5], jac);
+        terse_alternate_iauCovProp(jac, cov1[i], c);
+        num_same += (r[0] == ra2[i] && r[3] == pmd2[i] && r[5] == rv2[i] && memcmp(c, cov2[i], sizeof c) == 0);
+    }
+    check_near("STARPMCOVV same as STARPMJAC", N, num_same, 0.0);
+}
+
+static void test_ecliptic_batches(void){
+    printf("\nBatch ecliptic conversions.\n");
+    enum { N = 600 };
+    static double lon[N], lat[N], date1[N], date2[N], epj[N], ra[N], dec[N], back_lon[N], back_lat[N];
+    for (int i = 0; i < N; ++i){
+        lon[i] = 0.0107 * i;
+        lat[i] = -1.5 + 0.005 * i;
+        //groups of epochs, as from a survey, and one lone epoch
+        date1[i] = 2400000.5;
+        date2[i] = 60000.0 + (i / 100) * 0.25 + (i == 333 ? 0.1 : 0.0);
+        epj[i] = 1900.0 + 50.0 * (i / 200);
+    }
+    lat[0] = DPI / 2.0; //the pole of the ecliptic
+
+    double worst = 0.0, roundtrip = 0.0;
+    terse_alternate_iauEceq06v(2451545.0, 3000.25, N, lon, lat, ra, dec);
+    terse_alternate_iauEqec06v(2451545.0, 3000.25, N, ra, dec, back_lon, back_lat);
+    for (int i = 0; i < N; ++i){
+        double r, d, l, b;
+        iauEceq06(2451545.0, 3000.25, lon[i], lat[i], &r, &d);
+        iauEqec06(2451545.0, 3000.25, ra[i], dec[i], &l, &b);
+        worst = fmax(worst, fmax(fabs(r - ra[i]), fabs(d - dec[i])));
+        worst = fmax(worst, fmax(fabs(l - back_lon[i]), fabs(b - back_lat[i])));
+        if (i > 0) roundtrip = fmax(roundtrip, fmax(fabs(iauAnpm(back_lon[i] - lon[i])) * cos(lat[i]), fabs(back_lat[i] - lat[i])));
+    }
+    check_near("ECEQ06V, EQEC06V vs SOFA", 0.0, worst, 1e-15);
+    check_near("ECEQ06V round trip", 0.0, roundtrip, 1e-14);
+
+    worst = 0.0;
+    terse_alternate_iauLteceqv(2150.0, N, lon, lat, ra, dec);
+    terse_alternate_iauLteqecv(2150.0, N, lon, lat, back_lon, back_lat);
+    for (int i = 0; i < N; ++i){
+        double r, d, l, b;
+        iauLteceq(2150.0, lon[i], lat[i], &r, &d);
+        iauLteqec(2150.0, lon[i], lat[i], &l, &b);
+        worst = fmax(worst, fmax(fabs(r - ra[i]), fabs(d - dec[i])));
+        worst = fmax(worst, fmax(fabs(l - back_lon[i]), fabs(b - back_lat[i])));
+    }
+    check_near("LTECEQV, LTEQECV vs SOFA", 0.0, worst, 1e-15);
+
+    worst = 0.0;
+    terse_alternate_iauEceq06ev(N, date1, date2, lon, lat, ra, dec);
+    terse_alternate_iauEqec06ev(N, date1, date2, lon, lat, back_lon, back_lat);
+    for (int i = 0; i < N; ++i){
+        double r, d, l, b;
+        iauEceq06(date1[i], date2[i], lon[i], lat[i], &r, &d);
+        iauEqec06(date1[i], date2[i], lon[i], lat[i], &l, &b);
+        worst = fmax(worst, fmax(fabs(r - ra[i]), fabs(d - dec[i])));
+        worst = fmax(worst, fmax(fabs(l - back_lon[i]), fabs(b - back_lat[i])));
+    }
+    check_near("ECEQ06EV, EQEC06EV vs SOFA", 0.0, worst, 1e-15);
+
+    worst = 0.0;
+    terse_alternate_iauLteceqev(N, epj, lon, lat, ra, dec);
+    //in place
+    memcpy(back_lon, lon, sizeof lon);
+    memcpy(back_lat, lat, sizeof lat);
+    terse_alternate_iauLteqecev(N, epj, back_lon, back_lat, back_lon, back_lat);
+    for (int i = 0; i < N; ++i){
+        double r, d, l, b;
+        iauLteceq(epj[i], lon[i], lat[i], &r, &d);
+        iauLteqec(epj[i], lon[i], lat[i], &l, &b);
+        worst = fmax(worst, fmax(fabs(r - ra[i]), fabs(d - dec[i])));
+        worst = fmax(worst, fmax(fabs(l - back_lon[i]), fabs(b - back_lat[i])));
+    }
+    check_near("LTECEQEV, LTEQECEV vs SOFA", 0.0, worst, 1e-15);
+}
+
+static void test_galactic_batches(void){
+    printf("\nBatch galactic conversions.\n");
+    enum { N = 20000 };
+    static double ra[N], dec[N], lon[N], lat[N], lon1[N], lat1[N], back_ra[N], back_dec[N];
+    for (int i = 0; i < N; ++i){
+        ra[i] = -7.0 + 0.00071 * i;
+        dec[i] = -1.5707963267948966 + 0.000157 * i;
+    }
+    //the poles, zeros, the galactic pole, a large angle, and angles to be passed to SOFA
+    ra[0] = 0.0; dec[0] = 0.0;
+    ra[1] = 1.0; dec[1] = 1.5707963267948966;
+    ra[2] = 3.366033268750003; dec[2] = 0.4734773249532947;
+    ra[3] = 1e5; dec[3] = -0.3;
+    ra[4] = 2e7; dec[4] = 0.2;
+    ra[5] = 0.5; dec[5] = -3e8;
+
+    terse_alternate_iauIcrs2gv(N, 1, ra, dec, lon1, lat1);
+    terse_alternate_iauIcrs2gv(N, 4, ra, dec, lon, lat);
+    check_near("ICRS2GV threads same as one", 0, memcmp(lon, lon1, sizeof lon) || memcmp(lat, lat1, sizeof lat), 0.0);
+    terse_alternate_iauG2icrsv(N, 4, lon, lat, back_ra, back_dec);
+
+    double worst = 0.0, worst_back = 0.0;
+    for (int i = 0; i < N; ++i){
+        double l, b, r, d;
+        iauIcrs2g(ra[i], dec[i], &l, &b);
+        iauG2icrs(lon[i], lat[i], &r, &d);
+        //longitudes near the galactic pole are meaningless, as in the SOFA tests
+        worst = fmax(worst, fmax(fabs(iauAnpm(l - lon[i])) * cos(b), fabs(b - lat[i])));
+        worst_back = fmax(worst_back, fmax(fabs(iauAnpm(r - back_ra[i])) * cos(d), fabs(d - back_dec[i])));
+    }
+    check_near("ICRS2GV vs ICRS2G", 0.0, worst, 1e-14);
+    check_near("G2ICRSV vs G2ICRS", 0.0, worst_back, 1e-14);
+
+    //bit-identical to the scalar functions in the reproducible mode
+    terse_alternate_iauReproducible(1);
+    terse_alternate_iauIcrs2gv(N, 4, ra, dec, lon, lat);
+    terse_alternate_iauG2icrsv(N, 4, lon, lat, back_ra, back_dec);
+    terse_alternate_iauReproducible(0);
+    int num_differ = 0;
+    for (int i = 0; i < N; ++i){
+        double l, b, r, d;
+        iauIcrs2g(ra[i], dec[i], &l, &b);
+        iauG2icrs(lon[i], lat[i], &r, &d);
+        num_differ += (l != lon[i] || b != lat[i] || r != back_ra[i] || d != back_dec[i]);
+    }
+    check_near("ICRS2GV, G2ICRSV reproducible", 0, num_differ, 0.0);
+
+    //the test case of t_sofa_c.c, in place
+    double l[1] = {5.9338074302227188048671}, b[1] = {-1.1784870613579944551541};
+    terse_alternate_iauIcrs2gv(1, 1, l, b, l, b);
+    check_near("ICRS2GV L", 5.5850536063818546461558, l[0], 1e-14);
+    check_near("ICRS2GV B", -0.7853981633974483096157, b[0], 1e-14);
+}
+
+/* The text of iauA2tf or iauA2af fields, as terse_alternate_iauA2tfv and terse_alternate_iauA2afv should write them. */
+static void sprint_fields(char *out, int ndp, int lead, char sep, char sign, const int f[4]){
+    if (ndp > 0){
+        sprintf(out, "%c%0*d%c%02d%c%02d.%0*d", sign, lead, f[0], sep, f[1], sep, f[2], ndp, f[3]);
+    } else {
+        sprintf(out, "%c%0*d%c%02d%c%02d", sign, lead, f[0], sep, f[1], sep, f[2]);
+    }
+}
+
+static void test_sexagesimal_batches(void){
+    printf("\nBatch sexagesimal formatting and parsing.\n");
+    enum { N = 5000, STRIDE = 24 };
+    static double angle[N], back[N];
+    static char text[N * STRIDE];
+    static int status[N];
+    for (int i = 0; i < N; ++i){
+        angle[i] = -7.0 + 14.0 * i / N + 1e-9 * (i % 13);
+    }
+    //a value that rounds up to 24 hours, and one just under a rounding boundary
+    angle[0] = D2PI - 1e-12;
+    angle[1] = 0.5 * DS2R;
+
+    int num_different = 0, width = 0;
+    for (int ndp = -7; ndp <= 9; ++ndp){
+        memset(text, 0, sizeof text);
+        int overflows = terse_alternate_iauA2tfv(ndp, ':', N, angle, text, STRIDE, &width);
+        for (int i = 0; i < N; ++i){
+            char sign, expected[40];
+            int f[4];
+            iauA2tf(ndp, angle[i], &sign, f);
+            sprint_fields(expected, ndp, 2, ':', sign, f);
+            num_different += (int)strlen(expected) != width || memcmp(expected, text + i * STRIDE, width) != 0;
+        }
+        num_different += overflows != 0;
+        terse_alternate_iauA2afv(ndp, ' ', N, angle, text, STRIDE, &width);
+        for (int i = 0; i < N; ++i){
+            char sign, expected[40];
+            int f[4];
+            iauA2af(ndp, angle[i], &sign, f);
+            sprint_fields(expected, ndp, 3, ' ', sign, f);
+            num_different += memcmp(expected, text + i * STRIDE, width) != 0;
+        }
+    }
+    check_near("A2TFV, A2AFV different from A2TF, A2AF", 0, num_different, 0.0);
+    check_near("A2TFV bad ndp", -1, terse_alternate_iauA2tfv(10, ':', N, angle, text, STRIDE, &width), 0.0);
+
+    //100 hours doesn't fit
+    double days[2] = {4.2, -0.75};
+    memset(text, 0, sizeof text);
+    check_near("D2TFV overflows", 1, terse_alternate_iauD2tfv(3, ':', 2, days, text, STRIDE, &width), 0.0);
+    check_near("D2TFV overflow text", 0, strcmp(text, "*************"), 0.0);
+    check_near("D2TFV text", 0, strcmp(text + STRIDE, "-18:00:00.000"), 0.0);
+
+    //round trips, to the resolution
+    terse_alternate_iauA2tfv(6, ':', N, angle, text, STRIDE, &width);
+    for (int i = 0; i < N; ++i) text[i * STRIDE + width] = '\0';
+    check_near("TF2AV status", 1, terse_alternate_iauTf2av(N, text, STRIDE, back, status), 0.0);
+    double worst = 0.0;
+    for (int i = 0; i < N; ++i){
+        worst = fmax(worst, fabs(back[i] - angle[i]) / DS2R);
+    }
+    check_near("TF2AV round trip (s)", 0.0, worst, 0.5e-6 + 1e-9);
+    terse_alternate_iauA2afv(7, ' ', N, angle, text, STRIDE, &width);
+    terse_alternate_iauAf2av(N, text, STRIDE, back, status);
+    worst = 0.0;
+    for (int i = 0; i < N; ++i){
+        worst = fmax(worst, fabs(back[i] - angle[i]) / DAS2R);
+    }
+    check_near("AF2AV round trip (as)", 0.0, worst, 0.5e-7 + 1e-9);
+
+    //the same as sscanf and the SOFA functions, including the status of each record
+    const char *records[8] = {" -12:34:56.789", "+01 02 03", "23h", "05:60:00.5", "-00:00:00.000001",
+        "359 : 59 : 59.99999999999999", "24:00:00", "12:30:"};
+    int expected_status[8] = {0, 0, -1, 2, 0, 1, 1, -1};
+    static char small[8][32];
+    memset(small, 0, sizeof small);
+    for (int i = 0; i < 8; ++i) strcpy(small[i], records[i]);
+    double hours[8], deg[8], d[8];
+    int st[8], st_deg[8], st_d[8];
+    check_near("TF2AV worst status", -1, terse_alternate_iauTf2av(8, small[0], 32, hours, st), 0.0);
+    terse_alternate_iauAf2av(8, small[0], 32, deg, st_deg);
+    terse_alternate_iauTf2dv(8, small[0], 32, d, st_d);
+    num_different = 0;
+    for (int i = 0; i < 8; ++i){
+        char sign = '+', buf[32];
+        int h, m;
+        double sec, r = 0.0, ra = 0.0, rd = 0.0;
+        strcpy(buf, records[i]);
+        for (char *c = buf; *c; ++c) if (*c == ':') *c = ' ';
+        char *p = buf;
+        while (*p == ' ') ++p;
+        if (*p == '+' || *p == '-') sign = *p++;
+        int sa = -1, sb = -1, sc = -1;
+        if (sscanf(p, "%d %d %lf", &h, &m, &sec) == 3){
+            sa = iauTf2a(sign, h, m, sec, &r);
+            sb = iauAf2a(sign, h, m, sec, &ra);
+            sc = iauTf2d(sign, h, m, sec, &rd);
+        }
+        num_different += st[i] != expected_status[i] || st[i] != sa || st_deg[i] != sb || st_d[i] != sc;
+        num_different += hours[i] != r || deg[i] != ra || d[i] != rd;
+    }
+    check_near("TF2AV, AF2AV, TF2DV different from sscanf", 0, num_different, 0.0);
+}
+
+static void test_catalog(void){
+    printf("\nColumnar memory-mapped catalog.\n");
+    const char *text_path = "test-catalog.txt", *path = "test-catalog.bin";
+    enum { N = 3000 };
+    FILE *text = fopen(text_path, "w");
+    fprintf(text, "# ra dec pmr pmd px rv\n\n");
+    for (int i = 0; i < N; ++i){
+        fprintf(text, "%.17g %.17g %.17g %.17g %.17g %.17g\n", fmod(2.39996 * i, D2PI), asin(-1.0 + 2.0 * (i + 0.5) / N),
+            1e-8 * (i % 11 - 5), 2e-8 * (i % 7 - 3), 0.001 * (i % 50), 0.5 * (i % 90) - 20.0);
+    }
+    fclose(text);
+    check_near("CATALOG import", N, terse_alternate_iauCatalogImport(text_path, path, 100, IAU_CATALOG_UNIT_VECTORS | IAU_CATALOG_SORT), 0.0);
+
+    terse_alternate_iauCATALOG catalog;
+    check_near("CATALOG open", 0, terse_alternate_iauCatalogOpen(path, 1, &catalog), 0.0);
+    check_near("CATALOG blocks", 30, catalog.num_blocks, 0.0);
+    int num_different = 0, aligned = 1;
+    for (int i = 0; i < N; ++i){
+        double u[3];
+        long long row = catalog.index[i];
+        iauS2c(catalog.ra[i], catalog.dec[i], u);
+        num_different += catalog.ra[i] != fmod(2.39996 * row, D2PI) || catalog.rv[i] != 0.5 * (row % 90) - 20.0;
+        num_different += u[0] != catalog.u[0][i] || u[1] != catalog.u[1][i] || u[2] != catalog.u[2][i];
+    }
+    const double *columns[7] = {catalog.ra, catalog.dec, catalog.pmr, catalog.pmd, catalog.px, catalog.rv, catalog.u[0]};
+    for (int c = 0; c < 7; ++c) aligned &= ((size_t)columns[c] % 64 == 0);
+    check_near("CATALOG columns", 0, num_different, 0.0);
+    check_near("CATALOG columns aligned", 1, aligned, 0.0);
+
+    //a cone search must find every star in the cone: near the poles, and across RA 0, too
+    double cones[4][3] = {{1.0, 0.6, 0.2}, {0.0, 1.5, 0.1}, {3.0, -1.55, 0.05}, {6.2, 0.01, 0.15}};
+    int blocks[30], missed = 0, num_in_cones = 0, num_blocks = 0;
+    for (int c = 0; c < 4; ++c){
+        int count = terse_alternate_iauCatalogCone(&catalog, cones[c][0], cones[c][1], cones[c][2], blocks);
+        if (c == 0) num_blocks = count;
+        for (int i = 0; i < N; ++i){
+            if (iauSeps(cones[c][0], cones[c][1], catalog.ra[i], catalog.dec[i]) > cones[c][2]) continue;
+            ++num_in_cones;
+            int found = 0;
+            for (int k = 0; k < count; ++k) found |= (i / catalog.block_size == blocks[k]);
+            missed += !found;
+        }
+    }
+    check_near("CATALOG cone stars missed", 0, num_in_cones == 0 || missed != 0, 0.0);
+    //in far fewer blocks than all of them
+    check_near("CATALOG cone blocks", 1, num_blocks > 0 && num_blocks <= 6, 0.0);
+
+    //the batch functions read the columns in place
+    terse_alternate_iauCSTARS stars;
+    terse_alternate_iauSTARS out;
+    static double ra[N], dec[N], pmr[N], pmd[N], px[N], rv[N];
+    static int status[N];
+    terse_alternate_iauCatalogStars(&catalog, 0, N, &stars);
+    out = (terse_alternate_iauSTARS){N, ra, dec, pmr, pmd, px, rv};
+    terse_alternate_iauStarpmCovv(&stars, 2457389.0, 0.0, 2451545.0, 0.0, NULL, &out, NULL, status, 2);
+    double r, d, pr, pd, p, v;
+    iauStarpm(catalog.ra[1234], catalog.dec[1234], catalog.pmr[1234], catalog.pmd[1234], catalog.px[1234],
+        catalog.rv[1234], 2457389.0, 0.0, 2451545.0, 0.0, &r, &d, &pr, &pd, &p, &v);
+    check_near("CATALOG in place STARPM", 0, r != ra[1234] || d != dec[1234], 0.0);
+    terse_alternate_iauCatalogClose(&catalog);
+
+    //corrupt one byte of the columns
+    FILE *file = fopen(path, "r+b");
+    fseek(file, 1000, SEEK_SET);
+    fputc(0x5a, file);
+    fclose(file);
+    check_near("CATALOG bad checksum", -3, terse_alternate_iauCatalogOpen(path, 1, &catalog), 0.0);
+
+    //the header is checksummed too: the reserved int, at offset 28, is otherwise unchecked
+    check_near("CATALOG import again", N, terse_alternate_iauCatalogImport(text_path, path, 100, IAU_CATALOG_SORT), 0.0);
+    check_near("CATALOG open again", 0, terse_alternate_iauCatalogOpen(path, 1, &catalog), 0.0);
+    terse_alternate_iauCatalogClose(&catalog);
+    file = fopen(path, "r+b");
+    fseek(file, 28, SEEK_SET);
+    fputc(0x01, file);
+    fclose(file);
+    check_near("CATALOG bad header checksum", -3, terse_alternate_iauCatalogOpen(path, 1, &catalog), 0.0);
+
+    text = fopen(text_path, "w");
+    fprintf(text, "1 2 3 4 5 6\n1 2 3 x\n");
+    fclose(text);
+    check_near("CATALOG bad line", -4, terse_alternate_iauCatalogImport(text_path, path, 0, 0), 0.0);
+    remove(text_path);
+    remove(path);
+}
+
+/* The largest error of the tracker, and the largest ratio of the error to the estimate, from t0 to t1 s. */
+static void tracker_errors(terse_alternate_iauTRACKER *tracker, double t0, double t1, double *worst, double *worst_ratio, int *num_waits){
+    for (double t = t0; t <= t1; t += 0.37){
+        double az, zd, pa, err, aob, zob, hob, dob, rob, eo;
+        int status;
+        //wait for the background thread, if it's behind
+        for (int tries = 0; (status = terse_alternate_iauTrackerGet(tracker, T_UTC1, T_UTC2 + t / DAYSEC, &az, &zd, &pa, &err)) == 1 && tries < 5000; ++tries){
+            struct timespec pause = {0, 1000000};
+            nanosleep(&pause, NULL);
+            ++*num_waits;
+        }
+        iauAtco13(2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, T_UTC1, T_UTC2 + t / DAYSEC, T_DUT1, T_ELONG, T_PHI, T_HM,
+            T_XP, T_YP, T_PHPA, T_TC, T_RH, T_WL, &aob, &zob, &hob, &dob, &rob, &eo);
+        double on_sky = sqrt(pow(iauAnpm(az - aob) * sin(zob), 2) + pow(zd - zob, 2));
+        double d = fmax(on_sky, fabs(iauAnpm(pa - iauHd2pa(hob, dob, T_PHI))));
+        *worst = fmax(*worst, d);
+        *worst_ratio = fmax(*worst_ratio, d / fmax(err, 1e-13));
+    }
+}
+
+static void test_tracker(void){
+    printf("\nTracking interpolator.\n");
+    terse_alternate_iauTRACKTARGET target = {2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP,
+        T_PHPA, T_TC, T_RH, T_WL};
+    terse_alternate_iauTRACKER *tracker;
+    check_near("TRACKER start", 0, terse_alternate_iauTrackerStart(&target, T_UTC1, T_UTC2, 5.0, &tracker), 0.0);
+    double worst = 0.0, worst_ratio = 0.0;
+    int num_waits = 0;
+    //the nodes computed at the start, then those from the background thread
+    tracker_errors(tracker, 0.0, 20.0, &worst, &worst_ratio, &num_waits);
+    check_near("TRACKER no waits at start", 0, num_waits, 0.0);
+    tracker_errors(tracker, 20.0, 300.0, &worst, &worst_ratio, &num_waits);
+    check_near("TRACKER max error (mas)", 0.0, worst / DMAS2R, 0.05);
+    check_near("TRACKER error within 2x estimate", 1, worst_ratio < 2.0, 0.0);
+
+    //ahead of the nodes: extrapolated, with an estimate that bounds the error and grows with the distance
+    double ahead[] = {330.0, 420.0, 780.0, 3600.0}, last_err = 0.0;
+    int num_extrapolated = 0, num_bounded = 0, num_growing = 0;
+    for (int i = 0; i < 4; ++i){
+        double az, zd, pa, err, aob, zob, hob, dob, rob, eo, t = ahead[i];
+        num_extrapolated += terse_alternate_iauTrackerGet(tracker, T_UTC1, T_UTC2 + t / DAYSEC, &az, &zd, &pa, &err);
+        iauAtco13(2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, T_UTC1, T_UTC2 + t / DAYSEC, T_DUT1, T_ELONG, T_PHI, T_HM,
+            T_XP, T_YP, T_PHPA, T_TC, T_RH, T_WL, &aob, &zob, &hob, &dob, &rob, &eo);
+        double on_sky = sqrt(pow(iauAnpm(az - aob) * sin(zob), 2) + pow(zd - zob, 2));
+        double d = fmax(on_sky, fabs(iauAnpm(pa - iauHd2pa(hob, dob, T_PHI))));
+        num_bounded += (err >= d);
+        num_growing += (err >= last_err);
+        last_err = err;
+    }
+    check_near("TRACKER extrapolated", 4, num_extrapolated, 0.0);
+    check_near("TRACKER extrapolated error within estimate", 4, num_bounded, 0.0);
+    check_near("TRACKER extrapolated estimate grows", 4, num_growing, 0.0);
+    terse_alternate_iauTrackerStop(tracker);
+
+    target.phi = 0.0;
+    check_near("TRACKER bad date", -1, terse_alternate_iauTrackerStart(&target, 2400000.5, -1e9, 5.0, &tracker), 0.0);
+}
+
+/* The largest errors of a profile against the full models, from 1995 to 2050: on the sky, and in sidereal time. */
+static void accuracy_errors(const terse_alternate_iauACCURACY *acc, double *sky, double *gst){
+    *sky = *gst = 0.0;
+    for (int k = 0; k < 400; ++k){
+        double utc2 = -1826.5 + k * (20089.0 / 400) + 0.123;    //days from J2000, over 1995-2050
+        double rc = 0.7 * k, dc = asin(0.99 * sin(1.3 * k)), phi = 0.4 * (k % 5 - 2);
+        double a1, z1, h1, d1, r1, eo1, a2, z2, h2, d2, r2, eo2;
+        iauAtco13(rc, dc, 1e-5, 5e-6, 0.1, 55.0, DJ00, utc2, T_DUT1, T_ELONG, phi, T_HM, T_XP, T_YP,
+            T_PHPA, T_TC, T_RH, T_WL, &a1, &z1, &h1, &d1, &r1, &eo1);
+        terse_alternate_iauAtco13p(acc, rc, dc, 1e-5, 5e-6, 0.1, 55.0, DJ00, utc2, T_DUT1, T_ELONG, phi, T_HM, T_XP, T_YP,
+            T_PHPA, T_TC, T_RH, T_WL, &a2, &z2, &h2, &d2, &r2, &eo2);
+        if (z1 < 1.4) *sky = fmax(*sky, iauSeps(a1, DPI / 2 - z1, a2, DPI / 2 - z2));
+        *sky = fmax(*sky, iauSeps(r1, d1, r2, d2));
+        *gst = fmax(*gst, fabs(iauAnpm(eo1 - eo2)));
+
+        iauASTROM astrom1, astrom2;
+        double ri1, di1, ri2, di2;
+        iauApci13(DJ00, utc2, &astrom1, &eo1);
+        terse_alternate_iauApci13p(acc, DJ00, utc2, &astrom2, &eo2);
+        iauAtciq(rc, dc, 0.0, 0.0, 0.0, 0.0, &astrom1, &ri1, &di1);
+        iauAtciq(rc, dc, 0.0, 0.0, 0.0, 0.0, &astrom2, &ri2, &di2);
+        *sky = fmax(*sky, iauSeps(ri1, di1, ri2, di2));
+        *gst = fmax(*gst, fabs(iauAnpm(eo1 - eo2)));
+        *gst = fmax(*gst, fabs(iauAnpm(iauGst06a(DJ00, utc2, DJ00, utc2 + 8e-4) - terse_alternate_iauGstp(acc, DJ00, utc2, DJ00, utc2 + 8e-4))));
+    }
+}
+
+static void test_accuracy_profiles(void){
+    printf("\nAccuracy profiles.\n");
+    terse_alternate_iauACCURACY acc;
+    terse_alternate_iauAccuracyInit(1e-3 * DMAS2R, &acc);
+    check_near("ACCURACY 1 uas", IAU_ACCURACY_FULL, acc.profile, 0.0);
+    terse_alternate_iauAccuracyInit(DMAS2R, &acc);
+    check_near("ACCURACY 1 mas", IAU_ACCURACY_MAS, acc.profile, 0.0);
+    check_near("ACCURACY 1 mas sidereal time", IAU_ACCURACY_FULL, acc.gst_profile, 0.0);
+    terse_alternate_iauAccuracyInit(DAS2R, &acc);
+    check_near("ACCURACY 1 arcsec", IAU_ACCURACY_ARCSEC, acc.profile, 0.0);
+    terse_alternate_iauAccuracyInit(60.0 * DAS2R, &acc);
+    check_near("ACCURACY 1 arcmin", IAU_ACCURACY_ARCMIN, acc.gst_profile, 0.0);
+
+    //each profile against its published errors; the full one is SOFA itself
+    for (int p = 0; p < IAU_ACCURACY_PROFILES; ++p){
+        terse_alternate_iauACCURACY forced = {0.0, p, p};
+        double sky, gst;
+        char label[64];
+        accuracy_errors(&forced, &sky, &gst);
+        snprintf(label, sizeof label, "ACCURACY %s on the sky", terse_alternate_iauAccuracyProfiles[p].name);
+        check_near(label, 1, sky <= terse_alternate_iauAccuracyProfiles[p].sky_error, 0.0);
+        snprintf(label, sizeof label, "ACCURACY %s sidereal time", terse_alternate_iauAccuracyProfiles[p].name);
+        check_near(label, 1, gst <= terse_alternate_iauAccuracyProfiles[p].gst_error, 0.0);
+    }
+}
+
+static void test_refraction(void){
+    printf("\nRefraction at many wavelengths.\n");
+    double wl[6] = {0.35, 0.55, 0.9, 2.2, 100.0, 2e5}, refa[6], refb[6];
+    double worst = 0.0;
+    for (int m = 0; m < 3; ++m){
+        double phpa = (m == 2) ? 0.0 : T_PHPA, rh = (m == 1) ? 1.0 : T_RH;
+        terse_alternate_iauRefcov(phpa, T_TC, rh, 6, wl, refa, refb);
+        for (int k = 0; k < 6; ++k){
+            double a, b;
+            iauRefco(phpa, T_TC, rh, wl[k], &a, &b);
+            worst = fmax(worst, fmax(fabs(refa[k] - a), fabs(refb[k] - b)));
+        }
+    }
+    check_near("REFCOV as iauRefco", 0.0, worst, 0.0);
+
+    //iauAtioq without refraction gives the unrefracted zenith distance; with it, the observed one
+    enum { N = 50 };
+    double zt[N], zob[N], dz[6 * N];
+    iauASTROM astrom;
+    double eo;
+    iauApco13(T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP, 0.0, T_TC, T_RH, T_WL, &astrom, &eo);
+    terse_alternate_iauRefcov(T_PHPA, T_TC, T_RH, 6, wl, refa, refb);
+    worst = 0.0;
+    double worst_differential = 0.0;
+    for (int k = 0; k < 6; ++k){
+        for (int i = 0; i < N; ++i){
+            double ri = astrom.eral + 0.3 * i, di = -1.5 + 0.06 * i, aob, hob, dob, rob;
+            astrom.refa = astrom.refb = 0.0;
+            iauAtioq(ri, di, &astrom, &aob, &zt[i], &hob, &dob, &rob);
+            astrom.refa = refa[k];
+            astrom.refb = refb[k];
+            iauAtioq(ri, di, &astrom, &aob, &zob[i], &hob, &dob, &rob);
+        }
+        terse_alternate_iauRefzv(6, refa, refb, -1, N, zt, dz);
+        for (int i = 0; i < N; ++i) worst = fmax(worst, fabs(dz[k * N + i] - (zt[i] - zob[i])));
+    }
+    check_near("REFZV as iauAtioq", 0.0, worst, 1e-15);
+    double differential[6 * N];
+    terse_alternate_iauRefzv(6, refa, refb, 1, N, zt, differential);
+    for (int k = 0; k < 6; ++k){
+        for (int i = 0; i < N; ++i){
+            worst_differential = fmax(worst_differential, fabs(differential[k * N + i] - (dz[k * N + i] - dz[N + i])));
+        }
+    }
+    check_near("REFZV differential", 0.0, worst_differential, 1e-18);
+}
+
+/* iauAtco13 at (rc, dc), t seconds after the test time: aob, zob, hob, dob, rob. */
+static void atco13_at(double rc, double dc, double t, double out[5]){
+    double eo;
+    iauAtco13(rc, dc, 1e-5, 5e-6, 0.1, 55.0, T_UTC1, T_UTC2 + t / DAYSEC, T_DUT1, T_ELONG, T_PHI, T_HM,
+        T_XP, T_YP, T_PHPA, T_TC, T_RH, T_WL, &out[0], &out[1], &out[2], &out[3], &out[4], &eo);
+}
+
+/* iauAtoc13 at (ob1, ob2), t seconds after the test time: rc, dc. */
+static void atoc13_at(const char *type, double ob1, double ob2, double t, double out[2]){
+    iauAtoc13(type, ob1, ob2, T_UTC1, T_UTC2 + t / DAYSEC, T_DUT1, T_ELONG, T_PHI, T_HM,
+        T_XP, T_YP, T_PHPA, T_TC, T_RH, T_WL, &out[0], &out[1]);
+}
+
+static void test_jacobians(void){
+    printf("\nJacobians of the ICRS <-> observed transformations.\n");
+    const double rc = 2.71, dc = 0.174, h[3] = {1e-6, 1e-6, 0.1};
+    double out[5], jac[5][3], value[5], plus[5], minus[5], eo;
+    check_near("ATCO13J status", 0, terse_alternate_iauAtco13J(rc, dc, 1e-5, 5e-6, 0.1, 55.0, T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI,
+        T_HM, T_XP, T_YP, T_PHPA, T_TC, T_RH, T_WL, &out[0], &out[1], &out[2], &out[3], &out[4], &eo, jac), 0.0);
+    atco13_at(rc, dc, 0.0, value);
+    double worst_value = 0.0, worst = 0.0;
+    for (int i = 0; i < 5; ++i) worst_value = fmax(worst_value, fabs(out[i] - value[i]));
+    for (int k = 0; k < 3; ++k){
+        atco13_at(rc + (k == 0) * h[k], dc + (k == 1) * h[k], (k == 2) * h[k], plus);
+        atco13_at(rc - (k == 0) * h[k], dc - (k == 1) * h[k], -(k == 2) * h[k], minus);
+        for (int i = 0; i < 5; ++i) worst = fmax(worst, fabs(jac[i][k] - iauAnpm(plus[i] - minus[i]) / (2.0 * h[k])));
+    }
+    check_near("ATCO13J values", 0.0, worst_value, 0.0);
+    check_near("ATCO13J against differences", 0.0, worst, 1e-8);
+
+    //observed to ICRS, for each type of coordinates
+    static const char *types[3] = {"A", "H", "R"};
+    const double ob[3][2] = {{value[0], value[1]}, {value[2], value[3]}, {value[4], value[3]}};
+    worst_value = worst = 0.0;
+    for (int m = 0; m < 3; ++m){
+        double jac2[2][3];
+        terse_alternate_iauAtoc13J(types[m], ob[m][0], ob[m][1], T_UTC1, T_UTC2, T_DUT1, T_ELONG, T_PHI, T_HM, T_XP, T_YP,
+            T_PHPA, T_TC, T_RH, T_WL, &out[0], &out[1], jac2);
+        atoc13_at(types[m], ob[m][0], ob[m][1], 0.0, value);
+        for (int i = 0; i < 2; ++i) worst_value = fmax(worst_value, fabs(out[i] - value[i]));
+        for (int k = 0; k < 3; ++k){
+            atoc13_at(types[m], ob[m][0] + (k == 0) * h[k], ob[m][1] + (k == 1) * h[k], (k == 2) * h[k], plus);
+            atoc13_at(types[m], ob[m][0] - (k == 0) * h[k], ob[m][1] - (k == 1) * h[k], -(k == 2) * h[k], minus);
+            for (int i = 0; i < 2; ++i) worst = fmax(worst, fabs(jac2[i][k] - iauAnpm(plus[i] - minus[i]) / (2.0 * h[k])));
+        }
+    }
+    check_near("ATOC13J values", 0.0, worst_value, 0.0);
+    check_near("ATOC13J against differences", 0.0, worst, 1e-8);
+}
+
+/* The rates of the celestial-to-terrestrial matrix must match central differences of the SOFA functions. */
+static void test_c2t_rates(void){
+    printf("\nThe celestial-to-terrestrial matrix with its rate.\n");
+    const double xp = 2.55060238e-7, yp = 1.860359247e-6, xpdot = 1.2e-9, ypdot = -0.8e-9;
+    double worst_nut = 0.0, worst_nutdot = 0.0, worst_c2t = 0.0, worst_c2tdot = 0.0;
+    for (int year = 1995; year <= 2050; year += 5){
+        double tt = DJ00 + (year - 2000) * 365.25 + 0.3, ut = tt - 69.184 / 86400.0;
+        double dpsi, deps, dpsidot, depsdot, dp0, de0, dpp, dep, dpm, dem;
+        terse_alternate_iauNut00aDot(tt, 0.0, &dpsi, &deps, &dpsidot, &depsdot);
+        iauNut00a(tt, 0.0, &dp0, &de0);
+        iauNut00a(tt, 0.0005, &dpp, &dep);
+        iauNut00a(tt, -0.0005, &dpm, &dem);
+        worst_nut = fmax(worst_nut, fmax(fabs(dpsi - dp0), fabs(deps - de0)));
+        worst_nutdot = fmax(worst_nutdot, fmax(fabs(dpsidot - (dpp - dpm) / 0.001), fabs(depsdot - (dep - dem) / 0.001)));
+
+        //the full matrix, against iauC2t06a with the polar motion moved linearly: iauEra00 rounds to 5e-14 late
+        //in the range, so the differences take a long step, with Richardson extrapolation
+        const double h = 1e-3;
+        double r[3][3], rdot[3][3], c[3][3], diff[2][3][3];
+        terse_alternate_iauC2t06aDot(tt, 0.0, ut, 0.0, xp, yp, xpdot, ypdot, r, rdot);
+        iauC2t06a(tt, 0.0, ut, 0.0, xp, yp, c);
+        for (int m = 0; m < 2; ++m){
+            double step = h / (1 + m), cp[3][3], cm[3][3];
+            iauC2t06a(tt, step, ut, step, xp + step * xpdot, yp + step * ypdot, cp);
+            iauC2t06a(tt, -step, ut, -step, xp - step * xpdot, yp - step * ypdot, cm);
+            for (int i = 0; i < 3; ++i){
+                for (int k = 0; k < 3; ++k) diff[m][i][k] = (cp[i][k] - cm[i][k]) / (2.0 * step);
+            }
+        }
+        worst_c2t = fmax(worst_c2t, matrix_diff(r, c));
+        for (int i = 0; i < 3; ++i){
+            for (int k = 0; k < 3; ++k){
+                double richardson = (4.0 * diff[1][i][k] - diff[0][i][k]) / 3.0;
+                worst_c2tdot = fmax(worst_c2tdot, fabs(rdot[i][k] - richardson));
+            }
+        }
+    }
+    check_near("NUT00ADOT values", 0.0, worst_nut, 0.0);
+    check_near("NUT00ADOT rates", 0.0, worst_nutdot, 3e-14);
+    check_near("C2T06ADOT matrix", 0.0, worst_c2t, 0.0);
+    check_near("C2T06ADOT rate", 0.0, worst_c2tdot, 1e-9);
+
+    //the slow part alone, whose rate is lost in the differences of the full matrix
+    double rc2i[3][3], rc2idot[3][3], cp[3][3], cm[3][3], worst_c2i = 0.0;
+    terse_alternate_iauC2i06aDot(2460000.5, 0.3, rc2i, rc2idot);
+    iauC2i06a(2460000.5, 0.301, cp);
+    iauC2i06a(2460000.5, 0.299, cm);
+    for (int i = 0; i < 3; ++i){
+        for (int k = 0; k < 3; ++k) worst_c2i = fmax(worst_c2i, fabs(rc2idot[i][k] - (cp[i][k] - cm[i][k]) / 0.002));
+    }
+    check_near("C2I06ADOT rate", 0.0, worst_c2i, 3e-13);
+
+    double rpom[3][3], rpomdot[3][3], pom[3][3];
+    terse_alternate_iauPom00Dot(xp, yp, -1e-11, xpdot, ypdot, -6.3e-16, rpom, rpomdot);
+    iauPom00(xp, yp, -1e-11, pom);
+    check_near("POM00DOT matrix", 0.0, matrix_diff(rpom, pom), 0.0);
+    //the polar motion is slow: a long step, for precision
+    iauPom00(xp + 1e3 * xpdot, yp + 1e3 * ypdot, -1e-11 - 1e3 * 6.3e-16, cp);
+    iauPom00(xp - 1e3 * xpdot, yp - 1e3 * ypdot, -1e-11 + 1e3 * 6.3e-16, cm);
+    double worst_pom = 0.0;
+    for (int i = 0; i < 3; ++i){
+        for (int k = 0; k < 3; ++k) worst_pom = fmax(worst_pom, fabs(rpomdot[i][k] - (cp[i][k] - cm[i][k]) / 2e3));
+    }
+    check_near("POM00DOT rate", 0.0, worst_pom, 1e-15);
+
+    //the batch form against the single epochs
+    enum { N = 50 };
+    static double rc2t[N][3][3], rc2tdot[N][3][3];
+    terse_alternate_iauEPOCHS tte = {2460000.5, 0.25, 0.37, N};
+    terse_alternate_iauEPOCHS ut1 = {2460000.5, 0.25 - 69.184 / 86400.0, 0.37, N};
+    terse_alternate_iauC2t06aDotv(&tte, &ut1, xp, yp, xpdot, ypdot, rc2t, rc2tdot);
+    double worst_v = 0.0;
+    for (int i = 0; i < N; ++i){
+        double d1, d2, u1, u2, r[3][3], rdot[3][3];
+        terse_alternate_iauEpochAt(&tte, i, &d1, &d2);
+        terse_alternate_iauEpochAt(&ut1, i, &u1, &u2);
+        terse_alternate_iauC2t06aDot(d1, d2, u1, u2, xp, yp, xpdot, ypdot, r, rdot);
+        worst_v = fmax(worst_v, fmax(matrix_diff(r, rc2t[i]), matrix_diff(rdot, rc2tdot[i])));
+    }
+    check_near("C2T06ADOTV against C2T06ADOT", 0.0, worst_v, 1e-12);
+}
+
+/* The batch topocentric engine must agree with the per-point route of iauGd2gc and iauHd2ae. */
+static void test_topocentric(void){
+    printf("\nBatch topocentric azimuth, elevation and range.\n");
+    enum { NSTA = 5, N = 700 };
+    static const double site[NSTA][3] = {
+        {T_ELONG, T_PHI, T_HM}, {0.3, 0.9, 120.0}, {-2.0, -0.6, 0.0}, {1.0, 1.5707963267948966, 2800.0}, {2.5, 0.01, -40.0}};
+    static double x[N], y[N], z[N], az[NSTA * N], el[NSTA * N], range[NSTA * N], az1[NSTA * N], el1[NSTA * N];
+    terse_alternate_iauTOPOSTATION station[NSTA];
+    double refa, refb;
+    iauRefco(T_PHPA, T_TC, T_RH, T_WL, &refa, &refb);
+    for (int k = 0; k < NSTA; ++k){
+        check_near("TOPOSTATION status", 0, terse_alternate_iauTopoStation(WGS84, site[k][0], site[k][1], site[k][2],
+            (k % 2) ? refa : 0.0, (k % 2) ? refb : 0.0, &station[k]), 0);
+    }
+    check_near("TOPOSTATION bad ellipsoid", -1, terse_alternate_iauTopoStation(0, 0.0, 0.0, 0.0, 0.0, 0.0, &station[0]), 0);
+    terse_alternate_iauTopoStation(WGS84, site[0][0], site[0][1], site[0][2], 0.0, 0.0, &station[0]);
+    //low and high orbits in all directions, and one position at a station
+    for (int i = 0; i < N; ++i){
+        double r = (i % 3 == 0) ? 42164e3 : 6378e3 + 400e3 + 10e3 * (i % 50);
+        double lon = 0.0377 * i, lat = asin(-1.0 + 2.0 * (i + 0.5) / N);
+        x[i] = r * cos(lat) * cos(lon);
+        y[i] = r * cos(lat) * sin(lon);
+        z[i] = r * sin(lat);
+    }
+    x[7] = station[2].pos[0]; y[7] = station[2].pos[1]; z[7] = station[2].pos[2];
+
+    terse_alternate_iauItrs2aev(NSTA, station, N, x, y, z, 1, az1, el1, NULL);
+    terse_alternate_iauItrs2aev(NSTA, station, N, x, y, z, 4, az, el, range);
+    check_near("ITRS2AEV threads same as one", 0, memcmp(az, az1, sizeof az) || memcmp(el, el1, sizeof el), 0.0);
+
+    double worst_angle = 0.0, worst_range = 0.0;
+    for (int k = 0; k < NSTA; ++k){
+        double pos[3];
+        iauGd2gc(WGS84, site[k][0], site[k][1], site[k][2], pos);
+        for (int i = 0; i < N; ++i){
+            double p[3] = {x[i], y[i], z[i]}, d[3], theta, phi, a, e;
+            iauPmp(p, pos, d);
+            double rho = iauPm(d);
+            if (rho == 0.0) continue;
+            iauC2s(d, &theta, &phi);
+            iauHd2ae(site[k][0] - theta, phi, site[k][1], &a, &e);
+            if (k % 2){
+                double zt = DPI / 2.0 - e, dz;
+                terse_alternate_iauRefzv(1, &refa, &refb, -1, 1, &zt, &dz);
+                e += dz;
+            }
+            //azimuths at the pole and at the zenith are meaningless
+            double weight = (fabs(site[k][1]) < 1.5 && fabs(e) < 1.5) ? cos(e) : 0.0;
+            worst_angle = fmax(worst_angle, fmax(fabs(iauAnpm(a - az[k * N + i])) * weight, fabs(e - el[k * N + i])));
+            worst_range = fmax(worst_range, fabs(rho - range[k * N + i]));
+        }
+    }
+    check_near("ITRS2AEV angles", 0.0, worst_angle, 1e-14);
+    check_near("ITRS2AEV ranges", 0.0, worst_range, 3e-8);
+    check_near("ITRS2AEV at the station", 0.0, fabs(az[2 * N + 7]) + fabs(el[2 * N + 7]) + range[2 * N + 7], 0.0);
+}
+
+/* A serial executor that runs the tasks backwards, and counts its calls. */
+static int executor_calls = 0;
+
+static void run_backwards(void *executor, int ntasks, void (*task)(void *arg, int i), void *arg){
+    (void)executor;
+    ++executor_calls;
+    for (int i = ntasks - 1; i >= 0; --i) task(arg, i);
+}
+
+/* Counts how many times each item is visited, and runs a nested batch from within the first block. */
+static int visits[5000], nested_visits[100];
+
+static void count_nested(void *ctx, int begin, int end){
+    (void)ctx;
+    for (int i = begin; i < end; ++i) ++nested_visits[i];
+}
+
+static void count_visits(void *ctx, int begin, int end){
+    (void)ctx;
+    if (begin == 0) terse_alternate_iauParallelFor(100, 4, count_nested, NULL);
+    for (int i = begin; i < end; ++i) ++visits[i];
+}
+
+/* The batch functions must give the same results on the built-in pool and on an application's executor. */
+static void test_executor(void){
+    printf("\nExecutors.\n");
+    enum { N = 500 };
+    static double rbpn[N][3][3], rbpn1[N][3][3], ri[N], di[N], ri1[N], di1[N], rc[N], dc[N];
+    terse_alternate_iauEPOCHS tt = {2460000.5, 0.25, 0.01, N};
+    iauASTROM astrom;
+    double eo;
+    iauApci13(2456165.5, 0.401182685, &astrom, &eo);
+    for (int i = 0; i < N; ++i){
+        rc[i] = 0.0125 * i;
+        dc[i] = -1.3 + 0.005 * i;
+    }
+    terse_alternate_iauPnm06av(&tt, 4, rbpn);
+    terse_alternate_iauAtciqv(N, 4, rc, dc, NULL, NULL, NULL, NULL, &astrom, ri, di);
+
+    terse_alternate_iauEXECUTOR backwards = {run_backwards, NULL, 3};
+    terse_alternate_iauSetExecutor(&backwards);
+    terse_alternate_iauPnm06av(&tt, 0, rbpn1);
+    terse_alternate_iauAtciqv(N, 4, rc, dc, NULL, NULL, NULL, NULL, &astrom, ri1, di1);
+    terse_alternate_iauSetExecutor(NULL);
+    check_near("EXECUTOR calls", 2, executor_calls, 0);
+    int num_identical = 0;
+    for (int i = 0; i < N; ++i){
+        num_identical += (matrix_diff(rbpn[i], rbpn1[i]) == 0.0 && ri[i] == ri1[i] && di[i] == di1[i]);
+    }
+    check_near("EXECUTOR identical", N, num_identical, 0);
+
+    //every item exactly once, with a batch nested in a block, before and after the pool is stopped
+    for (int pass = 0; pass < 2; ++pass){
+        memset(visits, 0, sizeof visits);
+        memset(nested_visits, 0, sizeof nested_visits);
+        terse_alternate_iauParallelFor(5000, 8, count_visits, NULL);
+        int num_once = 0;
+        for (int i = 0; i < 5000; ++i) num_once += (visits[i] == 1);
+        for (int i = 0; i < 100; ++i) num_once += (nested_visits[i] == 1);
+        check_near(pass ? "POOL after stop" : "POOL nested", 5100, num_once, 0);
+        terse_alternate_iauPoolStop();
+    }
+}
+
+/* The observed place of a star, through a context. */
+static void observe(iauASTROM *astrom, double *aob, double *zob){
+    double ri, di, hob, dob, rob;
+    iauAtciq(2.71, 0.174, 1e-5, 5e-6, 0.1, 55.0, astrom, &ri, &di);
+    iauAtioq(ri, di, astrom, aob, zob, &hob, &dob, &rob);
+}
+
+/* Threads asking for the same contexts at once. */
+typedef struct {
+    terse_alternate_iauASTROMCACHE *cache;
+    double eral[50];
+} cache_thread;
+
+static void *ask_cache(void *arg){
+    cache_thread *t = arg;
+    for (int i = 0; i < 50; ++i){
+        iauASTROM astrom;
+        double eo;
+        terse_alternate_iauAstromCacheApco13(t->cache, 2456384.5, 0.969254051 + i / 86400.0, 0.1550675, -0.527800806, -1.2345856,
+            2738.0, 2.47230737e-7, 1.82640464e-6, 731.0, 12.8, 0.59, 0.55, &astrom, &eo);
+        t->eral[i] = astrom.eral;
+    }
+    return NULL;
+}
+
+/* The cache's contexts must be close to iauApco13's, built once each, and evicted oldest first. */
+static void test_astrom_cache(void){
+    printf("\nAstrometry context cache.\n");
+    terse_alternate_iauASTROMCACHE *cache;
+    terse_alternate_iauASTROMCACHESTATS stats;
+    iauASTROM astrom, exact;
+    double eo, eo1, aob, zob, aob1, zob1;
+    check_near("CACHE new", 0, terse_alternate_iauAstromCacheNew(256, 1.0, &cache), 0);
+
+    //0.4 s from the rounded time, twice: a miss, then a hit
+    for (int pass = 0; pass < 2; ++pass){
+        double utc2 = (83743.0 + 0.4 + 0.05 * pass) / 86400.0;
+        int j = terse_alternate_iauAstromCacheApco13(cache, 2456384.5, utc2, 0.1550675, -0.527800806, -1.2345856, 2738.0,
+            2.47230737e-7, 1.82640464e-6, 731.0, 12.8, 0.59, 0.55, &astrom, &eo);
+        iauApco13(2456384.5, utc2, 0.1550675, -0.527800806, -1.2345856, 2738.0,
+            2.47230737e-7, 1.82640464e-6, 731.0, 12.8, 0.59, 0.55, &exact, &eo1);
+        check_near("CACHE APCO13 status", 0, j, 0);
+        check_near("CACHE APCO13 eral", exact.eral, astrom.eral, 1e-10);
+        check_near("CACHE APCO13 eo", eo1, eo, 1e-11);
+        observe(&astrom, &aob, &zob);
+        observe(&exact, &aob1, &zob1);
+        check_near("CACHE APCO13 place", 0.0, iauSeps(aob, DPI / 2 - zob, aob1, DPI / 2 - zob1), 20e-6 * DAS2R);
+    }
+    terse_alternate_iauAstromCacheApci13(cache, 2456165.5, (34662.0 + 0.4) / 86400.0, &astrom, &eo);
+    iauApci13(2456165.5, (34662.0 + 0.4) / 86400.0, &exact, &eo1);
+    double ri, di, ri1, di1;
+    iauAtciq(5.85, -0.174, 1e-5, 5e-6, 0.1, 55.0, &astrom, &ri, &di);
+    iauAtciq(5.85, -0.174, 1e-5, 5e-6, 0.1, 55.0, &exact, &ri1, &di1);
+    check_near("CACHE APCI13 place", 0.0, iauSeps(ri, di, ri1, di1), 3e-6 * DAS2R);
+    terse_alternate_iauAstromCacheStats(cache, &stats);
+    check_near("CACHE hits", 1, stats.hits, 0);
+    check_near("CACHE misses", 2, stats.misses, 0);
+    terse_alternate_iauAstromCacheFree(cache);
+
+    //four threads, the same 50 epochs: each built once, and the same for every thread
+    static cache_thread threads[4];
+    pthread_t id[4];
+    terse_alternate_iauAstromCacheNew(256, 1.0, &cache);
+    for (int t = 0; t < 4; ++t){
+        threads[t].cache = cache;
+        pthread_create(&id[t], NULL, ask_cache, &threads[t]);
+    }
+    int num_same = 0;
+    for (int t = 0; t < 4; ++t){
+        pthread_join(id[t], NULL);
+        for (int i = 0; i < 50; ++i) num_same += (threads[t].eral[i] == threads[0].eral[i]);
+    }
+    terse_alternate_iauAstromCacheStats(cache, &stats);
+    check_near("CACHE threads same", 200, num_same, 0);
+    check_near("CACHE threads misses", 50, stats.misses, 0);
+    check_near("CACHE threads hits", 150, stats.hits, 0);
+    terse_alternate_iauAstromCacheFree(cache);
+
+    //8 slots, 100 epochs forward in time: the recent stay, the old go
+    terse_alternate_iauAstromCacheNew(8, 60.0, &cache);
+    for (int i = 0; i < 100; ++i) terse_alternate_iauAstromCacheApci13(cache, 2460000.5, i * 60.0 / 86400.0, &astrom, &eo);
+    terse_alternate_iauAstromCacheApci13(cache, 2460000.5, 99 * 60.0 / 86400.0, &astrom, &eo);
+    terse_alternate_iauAstromCacheStats(cache, &stats);
+    check_near("CACHE evictions", 92, stats.evictions, 0);
+    check_near("CACHE recent hit", 1, stats.hits, 0);
+    terse_alternate_iauAstromCacheApci13(cache, 2460000.5, 0.0, &astrom, &eo);
+    terse_alternate_iauAstromCacheStats(cache, &stats);
+    check_near("CACHE old miss", 101, stats.misses, 0);
+    terse_alternate_iauAstromCacheFree(cache);
+}
+
+/* Eclipses of 2017-2023 against the NASA canon (times TT), and a search ten thousand years ago. */
+static void test_eclipses(void){
+    printf("\nEclipse search.\n");
+    static terse_alternate_iauECLIPSE found[64], found4[64], past[200];
+    int n = terse_alternate_iauEclipseSearch(2457754.5, 0.0, 2557.0, IAU_ECLIPSE_SOLAR | IAU_ECLIPSE_LUNAR, 1, 64, found);
+    check_near("ECLIPSES 2017-2023", 32, n, 0);
+    int num_solar = 0, num_ordered = 0;
+    for (int i = 0; i < n; ++i){
+        num_solar += (found[i].type == IAU_ECLIPSE_SOLAR);
+        num_ordered += (i == 0 || found[i].tt1 + found[i].tt2 > found[i - 1].tt1 + found[i - 1].tt2);
+    }
+    check_near("ECLIPSES solar", 16, num_solar, 0);
+    check_near("ECLIPSES ordered", n, num_ordered, 0);
+
+    //2017 August 21, total solar, greatest at 18:26:40 TT; 2023 April 20, hybrid; 2022 November 8, total lunar at 11:00:20 TT
+    terse_alternate_iauECLIPSE *e = &found[3];
+    check_near("ECLIPSE 2017 kind", IAU_ECLIPSE_TOTAL, e->kind, 0);
+    check_near("ECLIPSE 2017 date", 20170821, e->iy * 10000 + e->im * 100 + e->id, 0);
+    check_near("ECLIPSE 2017 greatest", 2457987.268519, e->tt1 + e->tt2, 60.0 / DAYSEC);
+    check_near("ECLIPSE 2017 gamma", 0.4367, e->gamma, 0.002);
+    check_near("ECLIPSE 2017 magnitude", 1.0306, e->magnitude, 0.001);
+    check_near("ECLIPSE 2017 duration", 0.2, e->contacts[5] - e->contacts[0], 0.03);
+    check_near("ECLIPSE 2023 hybrid", IAU_ECLIPSE_HYBRID, found[28].kind, 0);
+    e = &found[27];
+    check_near("ECLIPSE 2022 lunar", IAU_ECLIPSE_LUNAR * 10 + IAU_ECLIPSE_TOTAL, e->type * 10 + e->kind, 0);
+    check_near("ECLIPSE 2022 greatest", 2459891.958565, e->tt1 + e->tt2, 60.0 / DAYSEC);
+    check_near("ECLIPSE 2022 gamma", 0.2570, e->gamma, 0.002);
+    check_near("ECLIPSE 2022 totality", 0, e->contacts[2] >= 0.0 || e->contacts[3] <= 0.0, 0);
+
+    //the same with threads
+    terse_alternate_iauEclipseSearch(2457754.5, 0.0, 2557.0, IAU_ECLIPSE_SOLAR | IAU_ECLIPSE_LUNAR, 4, 64, found4);
+    int num_identical = 0;
+    for (int i = 0; i < n; ++i){
+        num_identical += (found4[i].tt2 == found[i].tt2 && found4[i].kind == found[i].kind
+            && found4[i].magnitude == found[i].magnitude && found4[i].contacts[0] == found[i].contacts[0]);
+    }
+    check_near("ECLIPSES threads identical", n, num_identical, 0);
+
+    //from -9000 January 1, for 10 years: 4 to 7 eclipses a year, in the right years of the calendar
+    double djm0, djm;
+    terse_alternate_iauCal2jd(-9000, 1, 1, &djm0, &djm);
+    n = terse_alternate_iauEclipseSearch(djm0, djm, 3652.0, IAU_ECLIPSE_SOLAR | IAU_ECLIPSE_LUNAR, 0, 200, past);
+    int per_year[10] = {0}, num_in_years = 0, num_plausible = 0;
+    for (int i = 0; i < n; ++i){
+        if (past[i].iy >= -9000 && past[i].iy < -8990){
+            ++per_year[past[i].iy + 9000];
+            ++num_in_years;
+        }
+    }
+    for (int y = 0; y < 10; ++y) num_plausible += (per_year[y] >= 4 && per_year[y] <= 7);
+    check_near("ECLIPSES -9000 years", n, num_in_years, 0);
+    check_near("ECLIPSES -9000 per year", 10, num_plausible, 0);
+    check_near("ECLIPSES bad arguments", -1, terse_alternate_iauEclipseSearch(2451545.0, 0.0, 100.0, 0, 1, 0, NULL), 0);
+}
+
+/* Tests for the additions to SOFA made in this project, beyond the Julian date. */
+static void run_tests_for_additions(void){
+    int errors_before = num_errors;
+    test_deterministic_time_mode();
+    test_output_mask();
+    test_epoch_range();
+    test_almanac();
+    test_packed_tables();
+    test_nutation_stepper();
+    test_reproducible_mode();
+    test_timestamps();
+    test_now();
+    test_utc_intervals();
+    test_epoch_propagation();
+    test_ecliptic_batches();
+    test_galactic_batches();
+    test_sexagesimal_batches();
+    test_catalog();
+    test_tracker();
+    test_accuracy_profiles();
+    test_refraction();
+    test_jacobians();
+    test_c2t_rates();
+    test_topocentric();
+    test_executor();
+    test_astrom_cache();
+    test_eclipses();
+    printf("\nNum failed tests (additions): %d\n", num_errors - errors_before);
+    printf("Num successful tests (total): %d\n", num_successful);
+}
+
+/* 
+ I have renamed the 'main' function found in t_sofa_c.c, in order to replace it with this 'main'.
+ Passing 'latency' runs the latency profiles instead of the tests, 'bench' runs the benchmarks, 'almanac' runs the almanac tool,
+ and 'catalog' runs the catalog importer.
+*/
+int main(int argc, char *argv[]){
+  if (argc > 1 && strcmp(argv[1], "latency") == 0){
+    terse_alternate_run_latency_profiles();
+    return 0;
+  }
+  if (argc > 1 && strcmp(argv[1], "bench") == 0){
+    terse_alternate_run_benchmarks();
+    return 0;
+  }
+  if (argc > 1 && strcmp(argv[1], "almanac") == 0){
+    return terse_alternate_run_almanac_tool(argc, argv);
+  }
+  if (argc > 1 && strcmp(argv[1], "catalog") == 0){
+    return terse_alternate_run_catalog_tool(argc, argv);
+  }
   add_timing(run_tests_for_both_old_and_new_algorithms);
-  return 0;
-}
\ No newline at end of file
+  add_timing(run_tests_for_additions);
+  return num_errors == 0 ? 0 : 1;
+}
@@ -0,0 +1,216 @@
+#include <string.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Batch sexagesimal formatting and parsing, straight between text and radians (or days), implemented in C99.
+
+ Going through iauA2tf and sprintf, or sscanf and iauTf2a, costs far more in the text handling than in the
+ conversions. Here, the fields are written and read a digit at a time, with no calls into the C library.
+
+ The text is in fixed-stride records: record i starts at text + i*stride.
+ Formatting writes fixed-width fields, without a terminating NUL, as
+   +HH:MM:SS.fff    (terse_alternate_iauA2tfv, terse_alternate_iauD2tfv)
+   +DDD:MM:SS.fff   (terse_alternate_iauA2afv)
+ with the separator given, and ndp digits after the decimal point (none, and no point, for ndp <= 0).
+ The rounding is that of iauD2tf, for ndp from -7 to 9; the fields are the same as from iauA2tf, iauA2af
+ and iauD2tf. A value whose leading field doesn't fit (100 hours, 1000 degrees, or more) is written as '*'s.
+
+ Parsing reads, from the start of each record, optional spaces and sign, then three fields separated by ':'
+ or by spaces (or both), the last with an optional fraction; it stops at the first character that can't
+ belong to the seconds, or at the end of the record. The numbers are converted with iauTf2a, iauAf2a or
+ iauTf2d, so the results and the status of each record are theirs, with -1 for a record that can't be read
+ (and the value set to 0). The seconds are read exactly, to 15 significant digits.
+*/
+
+static const double POWERS_OF_10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+    1e13, 1e14, 1e15};
+
+/* Write value as exactly width decimal digits, with leading zeros. */
+static char *put_digits(char *out, long long value, int width) {
+  for (int i = width - 1; i >= 0; --i) {
+    out[i] = (char)('0' + value % 10);
+    value /= 10;
+  }
+  return out + width;
+}
+
+/* The width of a formatted field, with lead digits in the first field. */
+static int field_width(int ndp, int lead) {
+  return 1 + lead + 1 + 2 + 1 + 2 + (ndp > 0 ? 1 + ndp : 0);
+}
+
+/* What the values to be formatted are, and how they're scaled to days, exactly as in iauA2tf and iauA2af. */
+enum { RADIANS_TO_HOURS, RADIANS_TO_DEGREES, DAYS };
+
+/*
+ Format n values as hours (or degrees), minutes, seconds and fraction.
+ Returns the number that didn't fit, or -1 if ndp is out of range.
+*/
+static int format_fields(int ndp, int kind, int lead, char sep, int n, const double value[],
+    char *text, size_t stride, int *width) {
+  if (ndp < -7 || ndp > 9) return -1;
+  *width = field_width(ndp, lead);
+
+  //iauD2tf's units: the coarse rounding for ndp < 0, and the resolution units of each field
+  long long coarse = 1;
+  for (int k = 1; k <= -ndp; ++k) coarse *= (k == 2 || k == 4) ? 6 : 10;
+  long long rs = 1;
+  for (int k = 1; k <= ndp; ++k) rs *= 10;
+  long long rm = rs * 60, rh = rm * 60, limit = (lead == 2) ? 100 : 1000;
+
+  int num_overflows = 0;
+  for (int i = 0; i < n; ++i) {
+    char *out = text + (size_t)i * stride;
+    double days = (kind == RADIANS_TO_HOURS) ? value[i] / D2PI
+        : (kind == RADIANS_TO_DEGREES) ? value[i] * (15.0 / D2PI) : value[i];
+    double a = DAYSEC * fabs(days);
+    if (ndp < 0) a = coarse * dnint(a / coarse);
+    a = dnint(rs * a);
+    if (!(a < limit * (double)rh)) {
+      memset(out, '*', *width);
+      ++num_overflows;
+      continue;
+    }
+    //the fields, from the integer number of resolution units
+    long long units = (long long)a;
+    long long h = units / rh;
+    units -= h * rh;
+    long long m = units / rm;
+    units -= m * rm;
+    long long s = units / rs;
+    long long f = units - s * rs;
+
+    *out++ = (days >= 0.0) ? '+' : '-';
+    out = put_digits(out, h, lead);
+    *out++ = sep;
+    out = put_digits(out, m, 2);
+    *out++ = sep;
+    out = put_digits(out, s, 2);
+    if (ndp > 0) {
+      *out++ = '.';
+      put_digits(out, f, ndp);
+    }
+  }
+  return num_overflows;
+}
+
+/*
+ Format n angles (radians) as +HH:MM:SS.fff at text + i*stride, with the separator sep and ndp decimals.
+ The field width goes into *width. Returns the number of angles of 100 hours or more (written as '*'s),
+ or -1 if ndp is outside the range -7 to 9.
+*/
+int terse_alternate_iauA2tfv(int ndp, char sep, int n, const double angle[], char *text, size_t stride, int *width) {
+  return format_fields(ndp, RADIANS_TO_HOURS, 2, sep, n, angle, text, stride, width);
+}
+
+/* Like terse_alternate_iauA2tfv, as +DDD:MM:SS.fff; angles of 1000 degrees or more are written as '*'s. */
+int terse_alternate_iauA2afv(int ndp, char sep, int n, const double angle[], char *text, size_t stride, int *width) {
+  return format_fields(ndp, RADIANS_TO_DEGREES, 3, sep, n, angle, text, stride, width);
+}
+
+/* Like terse_alternate_iauA2tfv, for intervals in days. */
+int terse_alternate_iauD2tfv(int ndp, char sep, int n, const double days[], char *text, size_t stride, int *width) {
+  return format_fields(ndp, DAYS, 2, sep, n, days, text, stride, width);
+}
+
+/* Read an unsigned integer of up to 9 digits. Returns the number of digits read. */
+static int get_int(const char **p, const char *end, int *value) {
+  int digits = 0, v = 0;
+  while (*p < end && **p >= '0' && **p <= '9' && digits < 9) {
+    v = v * 10 + (**p - '0');
+    ++*p;
+    ++digits;
+  }
+  *value = v;
+  return digits;
+}
+
+/* Skip a separator: ':' or spaces, or both. Returns 0 if there's none. */
+static int skip_separator(const char **p, const char *end) {
+  const char *start = *p;
+  while (*p < end && **p == ' ') ++*p;
+  if (*p < end && **p == ':') ++*p;
+  while (*p < end && **p == ' ') ++*p;
+  return *p != start;
+}
+
+/* Read [spaces][sign]int sep int sep seconds[.fraction] from a record. Returns 0, or -1 if it can't. */
+static int parse_fields(const char *p, const char *end, char *sign, int *i1, int *i2, double *sec) {
+  while (p < end && *p == ' ') ++p;
+  *sign = '+';
+  if (p < end && (*p == '+' || *p == '-')) *sign = *p++;
+  if (get_int(&p, end, i1) == 0 || !skip_separator(&p, end)) return -1;
+  if (get_int(&p, end, i2) == 0 || !skip_separator(&p, end)) return -1;
+
+  //all the digits of the seconds as one integer, scaled once: exact to 15 digits
+  long long mantissa = 0;
+  int digits = 0, decimals = 0, any = 0;
+  while (p < end && *p >= '0' && *p <= '9') {
+    if (digits < 15) {
+      mantissa = mantissa * 10 + (*p - '0');
+      digits += (mantissa != 0);
+    } else {
+      --decimals;
+    }
+    ++p;
+    any = 1;
+  }
+  if (p < end && *p == '.') {
+    ++p;
+    while (p < end && *p >= '0' && *p <= '9') {
+      if (digits < 15 && decimals < 15) {
+        mantissa = mantissa * 10 + (*p - '0');
+        digits += (mantissa != 0);
+        ++decimals;
+      }
+      ++p;
+      any = 1;
+    }
+  }
+  if (!any || decimals < -15) return -1;
+  *sec = (decimals >= 0) ? (double)mantissa / POWERS_OF_10[decimals] : (double)mantissa * POWERS_OF_10[-decimals];
+  return 0;
+}
+
+/*
+ Parse n records. Returns -1 if any record can't be read, else the largest status from the
+ SOFA conversion (as for terse_alternate_iauStarpmCovv); the status of each record goes into status[].
+*/
+static int parse_records(int (*convert)(char s, int i1, int i2, double sec, double *out),
+    int n, const char *text, size_t stride, double value[], int status[]) {
+  int worst = 0;
+  for (int i = 0; i < n; ++i) {
+    const char *record = text + (size_t)i * stride;
+    const char *end = record;
+    while ((size_t)(end - record) < stride && *end != '\0') ++end;
+    char sign;
+    int i1, i2;
+    double sec;
+    if (parse_fields(record, end, &sign, &i1, &i2, &sec) == 0) {
+      status[i] = convert(sign, i1, i2, sec, &value[i]);
+    } else {
+      status[i] = -1;
+      value[i] = 0.0;
+    }
+    if (status[i] < 0) worst = -1;
+    else if (worst >= 0 && status[i] > worst) worst = status[i];
+  }
+  return worst;
+}
+
+/* Parse n records of hours, minutes and seconds, into radians, as iauTf2a. */
+int terse_alternate_iauTf2av(int n, const char *text, size_t stride, double rad[], int status[]) {
+  return parse_records(iauTf2a, n, text, stride, rad, status);
+}
+
+/* Parse n records of degrees, arcminutes and arcseconds, into radians, as iauAf2a. */
+int terse_alternate_iauAf2av(int n, const char *text, size_t stride, double rad[], int status[]) {
+  return parse_records(iauAf2a, n, text, stride, rad, status);
+}
+
+/* Parse n records of hours, minutes and seconds, into days, as iauTf2d. */
+int terse_alternate_iauTf2dv(int n, const char *text, size_t stride, double days[], int status[]) {
+  return parse_records(iauTf2d, n, text, stride, days, status);
+}
@@ -0,0 +1,417 @@
+#define _POSIX_C_SOURCE 200112L
+#include <pthread.h>
+#include <limits.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Direct conversions between machine timestamps and TAI/TT two-part Julian dates, implemented in C99.
+
+ Sensors give time as POSIX (Unix) time in nanoseconds, or as GNSS week and seconds of week.
+ Going through calendar fields (iauCal2jd, iauDtf2d, iauUtctai) costs far more than needed.
+ Here, the conversions use integer arithmetic on nanoseconds, and a table of leap seconds indexed by POSIX time:
+ no calendar decomposition is done.
+
+ The leap-second table is built once, on first use, by probing iauDat at the start of every month
+ from 1972 to 2100. So it has the same leap seconds as the SOFA release it's built with.
+
+ POSIX time counts 86400 seconds per day, so it can't represent a leap second (23:59:60).
+ Converting from TAI, a time during a leap second gives the POSIX time of 23:59:59 again, as POSIX clocks do.
+ Converting to TAI, the results are the same as those of iauDtf2d and iauUtctai, to well below a microsecond.
+
+ The GNSS time scales all run at a fixed offset from TAI, from their own epochs:
+   GPS time, from 1980 January 6 0h UTC: TAI - 19 s
+   Galileo system time, from 1999 August 22 0h UTC (GPS week 1024): TAI - 19 s
+   BeiDou time, from 2006 January 1 0h UTC: TAI - 33 s
+
+ Status, as for iauUtctai: +1 for a date after the years covered by the iauDat table (the result is
+ computed anyway), 0 for OK, -1 for a date before 1972 (when TAI-UTC wasn't a whole number of seconds),
+ or for an unknown GNSS system.
+*/
+
+#define LEAP_TABLE_MAX 1600
+
+static const long long NS_PER_SEC = 1000000000LL;
+static const long long SEC_PER_DAY = 86400LL;
+static const long long NS_PER_DAY = 86400LL * 1000000000LL;
+static const long long TT_MINUS_TAI_NS = 32184000000LL;
+static const double UNIX_EPOCH_JD = 2440587.5; //1970 January 1 0h
+static const long long UNIX_EPOCH_MJD = 40587;
+static const long long SEC_PER_WEEK = 604800LL;
+
+/* The table of TAI-UTC: from POSIX time unix_start[i] (s) onward, TAI-UTC is dat[i] (s). */
+static long long unix_start[LEAP_TABLE_MAX];
+static long long tai_start[LEAP_TABLE_MAX]; //from this TAI (s since JD 2440587.5 TAI) onward, dat[i] gives POSIX time
+static int dat[LEAP_TABLE_MAX];
+static int num_leap = 0;
+static long long dubious_start; //the POSIX time from which iauDat warns that its table may be out of date
+static pthread_once_t leap_table_once = PTHREAD_ONCE_INIT;
+
+/* Floor division, for negative numerators. */
+static long long floor_div(long long a, long long b) {
+  long long q = a / b;
+  return (a % b != 0 && ((a < 0) != (b < 0))) ? q - 1 : q;
+}
+
+static void build_leap_table(void) {
+  dubious_start = 0;
+  for (int y = 1972; y <= 2100; ++y) {
+    for (int m = 1; m <= 12; ++m) {
+      double djm0, djm, d;
+      int status = iauDat(y, m, 1, 0.0, &d);
+      iauCal2jd(y, m, 1, &djm0, &djm);
+      long long start = ((long long)djm - UNIX_EPOCH_MJD) * SEC_PER_DAY;
+      if (status == 1 && dubious_start == 0) dubious_start = start;
+      if (num_leap == 0 || (int)d != dat[num_leap - 1]) {
+        unix_start[num_leap] = start;
+        dat[num_leap] = (int)d;
+        //a leap second repeats the last POSIX second of the day before, so it goes with the new entry
+        tai_start[num_leap] = start + (num_leap == 0 ? (int)d : dat[num_leap - 1]);
+        ++num_leap;
+      }
+    }
+  }
+}
+
+static void init_leap_table(void) {
+  pthread_once(&leap_table_once, build_leap_table);
+}
+
+/*
+ The index of the last entry of a table of start times that's in force at time x: the hint, if it's still
+ in force, else by binary search. -1 if x is before the first entry.
+*/
+static int leap_index(const long long start[], long long x, int hint) {
+  if (x < start[0]) return -1;
+  if (hint >= 0 && hint < num_leap && start[hint] <= x && (hint + 1 == num_leap || x < start[hint + 1])) return hint;
+  int lo = 0, hi = num_leap - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (start[mid] <= x) lo = mid;
+    else hi = mid - 1;
+  }
+  return lo;
+}
+
+/* Nanoseconds since JD 2440587.5, in some time scale, to a two-part JD in the same time scale. */
+void terse_alternate_ns_to_jd(long long ns, double *d1, double *d2) {
+  long long day = floor_div(ns, NS_PER_DAY);
+  *d1 = UNIX_EPOCH_JD + (double)day;
+  *d2 = (double)(ns - day * NS_PER_DAY) / (double)NS_PER_DAY;
+}
+
+/* A two-part JD to nanoseconds since JD 2440587.5, in the same time scale. */
+static long long jd_to_ns(double d1, double d2) {
+  double whole1 = floor(d1 - UNIX_EPOCH_JD);
+  double f = (d1 - UNIX_EPOCH_JD - whole1) + d2;
+  double whole2 = floor(f);
+  f -= whole2;
+  long long ns = llround(f * (double)NS_PER_DAY);
+  return ((long long)whole1 + (long long)whole2) * NS_PER_DAY + ns;
+}
+
+/*
+ TAI-UTC (s) at the POSIX time (s), and the POSIX times of the start and end of the period for which it
+ holds (the end is LLONG_MAX for the last period). Returns the same status as terse_alternate_iauUnixToTai.
+*/
+int terse_alternate_leap_table_dat(long long unix_s, int *tai_utc, long long *from, long long *until) {
+  init_leap_table();
+  int i = leap_index(unix_start, unix_s, -1);
+  if (i < 0) return -1;
+  *tai_utc = dat[i];
+  *from = unix_start[i];
+  *until = (i + 1 < num_leap) ? unix_start[i + 1] : LLONG_MAX;
+  return unix_s >= dubious_start ? 1 : 0;
+}
+
+/* POSIX time (ns) to TAI (ns since JD 2440587.5 TAI), using and updating the hint. */
+static int unix_to_tai_ns(long long unix_ns, int *hint, long long *tai_ns) {
+  long long unix_s = floor_div(unix_ns, NS_PER_SEC);
+  int i = leap_index(unix_start, unix_s, *hint);
+  if (i < 0) return -1;
+  *hint = i;
+  *tai_ns = unix_ns + dat[i] * NS_PER_SEC;
+  return unix_s >= dubious_start ? 1 : 0;
+}
+
+/* POSIX time in nanoseconds to TAI, as a two-part JD. */
+int terse_alternate_iauUnixToTai(long long unix_ns, double *tai1, double *tai2) {
+  long long tai_ns;
+  int hint = -1;
+  init_leap_table();
+  int j = unix_to_tai_ns(unix_ns, &hint, &tai_ns);
+  if (j < 0) return j;
+  terse_alternate_ns_to_jd(tai_ns, tai1, tai2);
+  return j;
+}
+
+/* POSIX time in nanoseconds to TT, as a two-part JD. */
+int terse_alternate_iauUnixToTt(long long unix_ns, double *tt1, double *tt2) {
+  long long tai_ns;
+  int hint = -1;
+  init_leap_table();
+  int j = unix_to_tai_ns(unix_ns, &hint, &tai_ns);
+  if (j < 0) return j;
+  terse_alternate_ns_to_jd(tai_ns + TT_MINUS_TAI_NS, tt1, tt2);
+  return j;
+}
+
+/* TAI as a two-part JD to POSIX time in nanoseconds. */
+int terse_alternate_iauTaiToUnix(double tai1, double tai2, long long *unix_ns) {
+  init_leap_table();
+  long long tai_ns = jd_to_ns(tai1, tai2);
+  int i = leap_index(tai_start, floor_div(tai_ns, NS_PER_SEC), -1);
+  if (i < 0) return -1;
+  *unix_ns = tai_ns - dat[i] * NS_PER_SEC;
+  return floor_div(*unix_ns, NS_PER_SEC) >= dubious_start ? 1 : 0;
+}
+
+/* TT as a two-part JD to POSIX time in nanoseconds. */
+int terse_alternate_iauTtToUnix(double tt1, double tt2, long long *unix_ns) {
+  return terse_alternate_iauTaiToUnix(tt1, tt2 - (double)TT_MINUS_TAI_NS / (double)NS_PER_DAY, unix_ns);
+}
+
+/* The start of week 0 of a GNSS time scale, in TAI ns since JD 2440587.5 TAI. Returns -1 for an unknown system. */
+static int gnss_epoch_tai_ns(int system, long long *epoch) {
+  switch (system) {
+    case IAU_GNSS_GPS: *epoch = (315964800LL + 19) * NS_PER_SEC; return 0;
+    case IAU_GNSS_GALILEO: *epoch = (315964800LL + 1024 * SEC_PER_WEEK + 19) * NS_PER_SEC; return 0;
+    case IAU_GNSS_BEIDOU: *epoch = (1136073600LL + 33) * NS_PER_SEC; return 0;
+    default: return -1;
+  }
+}
+
+/* A GNSS week number and seconds of week (one of the IAU_GNSS_* systems) to TAI, as a two-part JD. */
+int terse_alternate_iauGnssToTai(int system, int week, double sow, double *tai1, double *tai2) {
+  long long epoch;
+  if (gnss_epoch_tai_ns(system, &epoch) != 0) return -1;
+  terse_alternate_ns_to_jd(epoch + week * SEC_PER_WEEK * NS_PER_SEC + llround(sow * NS_PER_SEC), tai1, tai2);
+  return 0;
+}
+
+/* A GNSS week number and seconds of week (one of the IAU_GNSS_* systems) to TT, as a two-part JD. */
+int terse_alternate_iauGnssToTt(int system, int week, double sow, double *tt1, double *tt2) {
+  long long epoch;
+  if (gnss_epoch_tai_ns(system, &epoch) != 0) return -1;
+  terse_alternate_ns_to_jd(epoch + week * SEC_PER_WEEK * NS_PER_SEC + llround(sow * NS_PER_SEC) + TT_MINUS_TAI_NS, tt1, tt2);
+  return 0;
+}
+
+/* TAI as a two-part JD to a GNSS week number and seconds of week (one of the IAU_GNSS_* systems). */
+int terse_alternate_iauTaiToGnss(int system, double tai1, double tai2, int *week, double *sow) {
+  long long epoch;
+  if (gnss_epoch_tai_ns(system, &epoch) != 0) return -1;
+  long long ns = jd_to_ns(tai1, tai2) - epoch;
+  long long w = floor_div(ns, SEC_PER_WEEK * NS_PER_SEC);
+  *week = (int)w;
+  *sow = (double)(ns - w * SEC_PER_WEEK * NS_PER_SEC) / (double)NS_PER_SEC;
+  return 0;
+}
+
+/*
+ terse_alternate_iauUnixToTai, for n timestamps. Timestamps are usually close together, so each lookup in the leap-second
+ table first tries the entry found for the previous one. Returns the worst status (-1 if any is before 1972).
+*/
+int terse_alternate_iauUnixToTaiv(int n, const long long unix_ns[], double tai1[], double tai2[]) {
+  int status = 0, hint = -1;
+  init_leap_table();
+  for (int i = 0; i < n; ++i) {
+    long long tai_ns;
+    int j = unix_to_tai_ns(unix_ns[i], &hint, &tai_ns);
+    if (j < 0) {
+      tai1[i] = tai2[i] = 0.0;
+      status = -1;
+      continue;
+    }
+    if (j > status && status >= 0) status = j;
+    terse_alternate_ns_to_jd(tai_ns, &tai1[i], &tai2[i]);
+  }
+  return status;
+}
+
+/* terse_alternate_iauUnixToTt, for n timestamps. As for terse_alternate_iauUnixToTaiv. */
+int terse_alternate_iauUnixToTtv(int n, const long long unix_ns[], double tt1[], double tt2[]) {
+  int status = 0, hint = -1;
+  init_leap_table();
+  for (int i = 0; i < n; ++i) {
+    long long tai_ns;
+    int j = unix_to_tai_ns(unix_ns[i], &hint, &tai_ns);
+    if (j < 0) {
+      tt1[i] = tt2[i] = 0.0;
+      status = -1;
+      continue;
+    }
+    if (j > status && status >= 0) status = j;
+    terse_alternate_ns_to_jd(tai_ns + TT_MINUS_TAI_NS, &tt1[i], &tt2[i]);
+  }
+  return status;
+}
+
+/* terse_alternate_iauTaiToUnix, for n epochs. Returns the worst status, as for terse_alternate_iauUnixToTaiv. */
+int terse_alternate_iauTaiToUnixv(int n, const double tai1[], const double tai2[], long long unix_ns[]) {
+  int status = 0, hint = -1;
+  init_leap_table();
+  for (int i = 0; i < n; ++i) {
+    long long tai_ns = jd_to_ns(tai1[i], tai2[i]);
+    int k = leap_index(tai_start, floor_div(tai_ns, NS_PER_SEC), hint);
+    if (k < 0) {
+      unix_ns[i] = 0;
+      status = -1;
+      continue;
+    }
+    hint = k;
+    unix_ns[i] = tai_ns - dat[k] * NS_PER_SEC;
+    if (status == 0 && floor_div(unix_ns[i], NS_PER_SEC) >= dubious_start) status = 1;
+  }
+  return status;
+}
+
+/* terse_alternate_iauGnssToTt, for n week numbers and seconds of week. Returns -1 for an unknown system, otherwise 0. */
+int terse_alternate_iauGnssToTtv(int system, int n, const int week[], const double sow[], double tt1[], double tt2[]) {
+  long long epoch;
+  if (gnss_epoch_tai_ns(system, &epoch) != 0) return -1;
+  for (int i = 0; i < n; ++i) {
+    terse_alternate_ns_to_jd(epoch + week[i] * SEC_PER_WEEK * NS_PER_SEC + llround(sow[i] * NS_PER_SEC) + TT_MINUS_TAI_NS, &tt1[i], &tt2[i]);
+  }
+  return 0;
+}
+
+/*
+ UTC interval arithmetic, on arrays.
+
+ UTC is the usual SOFA quasi-JD, as from iauDtf2d: on a day with a leap second, the fraction of the day
+ runs over 86401 s. Each UTC is taken to TAI seconds since JD 2440587.5 TAI, with the leap-second table,
+ as a whole number of seconds and a fraction. Differences and sums are then done on those.
+ The results are the same as those of iauUtctai and iauTaiutc, which call iauDat several times per value.
+ Before 1972, when TAI-UTC wasn't a whole number of seconds, iauUtctai and iauTaiutc are used.
+*/
+
+/* A two-part JD, as days since JD 2440587.5 and the fraction of the day. */
+static void split_jd(double d1, double d2, long long *day, double *fd) {
+  if (fabs(d2) > fabs(d1)) {
+    double w = d1;
+    d1 = d2;
+    d2 = w;
+  }
+  double whole1 = floor(d1 - UNIX_EPOCH_JD);
+  double f = (d1 - UNIX_EPOCH_JD - whole1) + d2;
+  double whole2 = floor(f);
+  *day = (long long)whole1 + (long long)whole2;
+  *fd = f - whole2;
+}
+
+/* The leap second at the end of the UTC day that starts at the POSIX time day_start (s), given its table entry i. */
+static int leap_at_end_of_day(int i, long long day_start) {
+  return (i + 1 < num_leap && unix_start[i + 1] == day_start + SEC_PER_DAY) ? dat[i + 1] - dat[i] : 0;
+}
+
+/* UTC to TAI (whole seconds since JD 2440587.5 TAI, and a fraction), with the table. Returns -2 before 1972. */
+static int utc_to_tai_sec(double utc1, double utc2, int *hint, long long *sec, double *frac) {
+  long long day;
+  double fd;
+  split_jd(utc1, utc2, &day, &fd);
+  long long day_start = day * SEC_PER_DAY;
+  int i = leap_index(unix_start, day_start, *hint);
+  if (i < 0) return -2;
+  *hint = i;
+  double s = fd * (double)(SEC_PER_DAY + leap_at_end_of_day(i, day_start));
+  double whole = floor(s);
+  *sec = day_start + dat[i] + (long long)whole;
+  *frac = s - whole;
+  return day_start >= dubious_start ? 1 : 0;
+}
+
+/* TAI (whole seconds since JD 2440587.5 TAI, and a fraction) to UTC, with the table. Returns -2 before 1972. */
+static int tai_sec_to_utc(long long sec, double frac, int *hint, double *utc1, double *utc2) {
+  int i = leap_index(tai_start, sec, *hint);
+  if (i < 0) return -2;
+  *hint = i;
+  long long day_start;
+  double sod;
+  int leap;
+  if (i > 0 && sec < unix_start[i] + dat[i]) {
+    //in the leap second at the end of the day before
+    day_start = unix_start[i] - SEC_PER_DAY;
+    sod = (double)(SEC_PER_DAY + sec - (unix_start[i] + dat[i - 1])) + frac;
+    leap = dat[i] - dat[i - 1];
+  } else {
+    long long u = sec - dat[i];
+    day_start = floor_div(u, SEC_PER_DAY) * SEC_PER_DAY;
+    sod = (double)(u - day_start) + frac;
+    leap = leap_at_end_of_day(i, day_start);
+  }
+  *utc1 = UNIX_EPOCH_JD + (double)(day_start / SEC_PER_DAY);
+  *utc2 = sod / (double)(SEC_PER_DAY + leap);
+  return day_start >= dubious_start ? 1 : 0;
+}
+
+/* UTC to TAI seconds, with the table, or with iauUtctai before 1972. */
+static int utc_to_tai_any(double utc1, double utc2, int *hint, long long *sec, double *frac) {
+  int j = utc_to_tai_sec(utc1, utc2, hint, sec, frac);
+  if (j != -2) return j;
+  double tai1, tai2, fd;
+  long long day;
+  j = iauUtctai(utc1, utc2, &tai1, &tai2);
+  if (j < 0) return j;
+  split_jd(tai1, tai2, &day, &fd);
+  double s = fd * (double)SEC_PER_DAY;
+  double whole = floor(s);
+  *sec = day * SEC_PER_DAY + (long long)whole;
+  *frac = s - whole;
+  return j;
+}
+
+/* TAI seconds to UTC, with the table, or with iauTaiutc before 1972. */
+static int tai_to_utc_any(long long sec, double frac, int *hint, double *utc1, double *utc2) {
+  int j = tai_sec_to_utc(sec, frac, hint, utc1, utc2);
+  if (j != -2) return j;
+  long long day = floor_div(sec, SEC_PER_DAY);
+  return iauTaiutc(UNIX_EPOCH_JD + (double)day, ((double)(sec - day * SEC_PER_DAY) + frac) / (double)SEC_PER_DAY, utc1, utc2);
+}
+
+/* Combine statuses, keeping the worst: any negative status, else +1 if any. */
+static int worst_status(int status, int j) {
+  if (status < 0) return status;
+  return (j < 0 || j > status) ? j : status;
+}
+
+/*
+ The elapsed SI seconds from UTC a to UTC b, for n pairs, counting any leap seconds in between.
+ Returns the worst status, as for iauUtctai: +1 for a dubious year, 0 for OK, -1 for an unacceptable date.
+*/
+int terse_alternate_iauUtcDiffv(int n, const double a1[], const double a2[], const double b1[], const double b2[], double dt[]) {
+  int status = 0, hint_a = -1, hint_b = -1;
+  init_leap_table();
+  for (int i = 0; i < n; ++i) {
+    long long sec_a, sec_b;
+    double frac_a, frac_b;
+    int ja = utc_to_tai_any(a1[i], a2[i], &hint_a, &sec_a, &frac_a);
+    int jb = utc_to_tai_any(b1[i], b2[i], &hint_b, &sec_b, &frac_b);
+    status = worst_status(worst_status(status, ja), jb);
+    dt[i] = (ja < 0 || jb < 0) ? 0.0 : (double)(sec_b - sec_a) + (frac_b - frac_a);
+  }
+  return status;
+}
+
+/*
+ UTC plus dt SI seconds, for n values, counting any leap seconds in between. The result is a two-part
+ quasi-JD, with the whole days (and a half) in the first part. Returns the worst status, as for terse_alternate_iauUtcDiffv.
+*/
+int terse_alternate_iauUtcAddv(int n, const double utc1[], const double utc2[], const double dt[], double out1[], double out2[]) {
+  int status = 0, hint_in = -1, hint_out = -1;
+  init_leap_table();
+  for (int i = 0; i < n; ++i) {
+    long long sec;
+    double frac;
+    int j = utc_to_tai_any(utc1[i], utc2[i], &hint_in, &sec, &frac);
+    if (j >= 0) {
+      double total = frac + dt[i];
+      double whole = floor(total);
+      j = worst_status(j, tai_to_utc_any(sec + (long long)whole, total - whole, &hint_out, &out1[i], &out2[i]));
+    }
+    if (j < 0) out1[i] = out2[i] = 0.0;
+    status = worst_status(status, j);
+  }
+  return status;
+}
@@ -0,0 +1,129 @@
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ Batch topocentric azimuth, elevation and range, of many ITRS positions from many stations, for satellite
+ tracking networks, implemented in C99.
+
+ Per point, the usual route converts the station with iauGd2gc, differences the vectors, and applies the
+ formulas of iauHd2ae. Here each station is prepared once, by terse_alternate_iauTopoStation: its geocentric position and
+ its east, north and up unit vectors (geodetic, as for iauHd2ae). The positions come as separate x[], y[],
+ z[] arrays (structure of arrays), and each block of them is then a plain loop of arithmetic: a difference,
+ a 3x3 rotation, sqrt and the inline fast_atan2, which the compiler can vectorize with whatever SIMD
+ instructions the target has (gcc needs -O3 -fno-math-errno -fno-trapping-math, which don't change the
+ results, to vectorize the sqrt and the selects). The blocks of every station and position are shared
+ among threads.
+
+ Optionally, refraction by the constants of iauRefco raises the elevations, by exactly the treatment of
+ iauAtioq (the A tan(z) + B tan^3(z) model with its Newton-Raphson correction, and the same precautions near
+ and below the horizon); with zero constants, the elevations are topocentric.
+
+ The results agree with those of the per-point route to about 1e-15 radians, and to a few units in the
+ last place of the range (3e-8 m at geostationary distances). They're the same for any number of threads.
+ The reproducible mode (terse_alternate_iauReproducible) doesn't apply: no scalar SOFA function gives these results for them
+ to be identical to. fast_atan2 is plain arithmetic, so it rounds the same on every host only in a build that
+ doesn't contract multiply-adds (-std=c99, or -ffp-contract=off); with contraction, as in -std=gnu99 on a
+ target with FMA, the last bit may differ between builds.
+*/
+
+enum { BLOCK = 256 };
+
+/* Minimum cos(alt) and sin(alt) for refraction purposes (the same values as iauAtioq). */
+static const double CELMIN = 1e-6;
+static const double SELMIN = 0.05;
+
+/*
+ Prepare a station for terse_alternate_iauItrs2aev, given the ellipsoid (as for iauGd2gc), its geodetic longitude elong
+ (radians, east +ve), latitude phi (radians) and height (m), and the refraction constants refa, refb
+ (radians, as from iauRefco; 0 for none). Returns the status of iauGd2gc: 0 OK, -1 illegal ellipsoid
+ identifier, -2 illegal case; in either error the station is unusable.
+*/
+int terse_alternate_iauTopoStation(int ellipsoid, double elong, double phi, double height, double refa, double refb,
+    terse_alternate_iauTOPOSTATION *station) {
+   int j = iauGd2gc(ellipsoid, elong, phi, height, station->pos);
+   double sl = sin(elong), cl = cos(elong), sp = sin(phi), cp = cos(phi);
+   //east, north and up
+   station->enu[0][0] = -sl;
+   station->enu[0][1] = cl;
+   station->enu[0][2] = 0.0;
+   station->enu[1][0] = -sp * cl;
+   station->enu[1][1] = -sp * sl;
+   station->enu[1][2] = cp;
+   station->enu[2][0] = cp * cl;
+   station->enu[2][1] = cp * sl;
+   station->enu[2][2] = sp;
+   station->refa = refa;
+   station->refb = refb;
+   return j;
+}
+
+/* The azimuths, elevations and ranges of count positions from a station, into az[], el[] and range[]. */
+static void topocentric_block(const terse_alternate_iauTOPOSTATION *st, int count, const double x[], const double y[],
+    const double z[], double az[], double el[], double range[]) {
+   double hor[BLOCK], up[BLOCK];
+   for (int i = 0; i < count; ++i) {
+      double dx = x[i] - st->pos[0], dy = y[i] - st->pos[1], dz = z[i] - st->pos[2];
+      double e = st->enu[0][0] * dx + st->enu[0][1] * dy;
+      double n = st->enu[1][0] * dx + st->enu[1][1] * dy + st->enu[1][2] * dz;
+      double u = st->enu[2][0] * dx + st->enu[2][1] * dy + st->enu[2][2] * dz;
+      double h = sqrt(e * e + n * n);
+      double a = fast_atan2(e, n);
+      az[i] = (a < 0.0) ? a + D2PI : a;
+      range[i] = sqrt(h * h + u * u);
+      hor[i] = h;
+      up[i] = u;
+   }
+   double refa = st->refa, refb = st->refb;
+   if (refa == 0.0 && refb == 0.0) {
+      for (int i = 0; i < count; ++i) el[i] = fast_atan2(up[i], hor[i]);
+      return;
+   }
+   //refraction, as in iauAtioq, of the unit vector with horizontal part s and vertical part c
+   for (int i = 0; i < count; ++i) {
+      double rho = (range[i] > 0.0) ? range[i] : 1.0;
+      double s = hor[i] / rho, c = up[i] / rho;
+      double r = s > CELMIN ? s : CELMIN;
+      double zz = c > SELMIN ? c : SELMIN;
+      double tz = r / zz;
+      double w = refb * tz * tz;
+      double del = (refa + w) * tz / (1.0 + (refa + 3.0 * w) / (zz * zz));
+      double cosdel = 1.0 - del * del / 2.0;
+      double f = fabs(cosdel - del * zz / r);
+      el[i] = fast_atan2(cosdel * c + del * r, f * s);
+   }
+}
+
+typedef struct {
+   int nsta, n, nblocks;
+   const terse_alternate_iauTOPOSTATION *station;
+   const double *x, *y, *z;
+   double *az, *el, *range;
+} topocentric_args;
+
+/* Items are (station, block of positions) pairs, station by station. */
+static void topocentric_body(void *ctx, int begin, int end) {
+   const topocentric_args *t = ctx;
+   double scratch[BLOCK];
+   for (int item = begin; item < end; ++item) {
+      int k = item / t->nblocks;
+      int start = (item % t->nblocks) * BLOCK;
+      int count = (t->n - start < BLOCK) ? t->n - start : BLOCK;
+      size_t out = (size_t)k * t->n + start;
+      topocentric_block(&t->station[k], count, t->x + start, t->y + start, t->z + start,
+          t->az + out, t->el + out, t->range ? t->range + out : scratch);
+   }
+}
+
+/*
+ The azimuths, elevations and ranges of n ITRS positions x[], y[], z[] (m) from nsta stations (as from
+ terse_alternate_iauTopoStation), using up to nthreads threads (0 for one per CPU). Returned, for station k and position i,
+ at index k*n + i: az (radians, 0 to 2pi, north through east), el (radians, refracted if the station has
+ refraction constants) and range (m). The range array may be NULL. The positions must be finite.
+*/
+void terse_alternate_iauItrs2aev(int nsta, const terse_alternate_iauTOPOSTATION station[], int n, const double x[], const double y[],
+    const double z[], int nthreads, double az[], double el[], double range[]) {
+   if (nsta <= 0 || n <= 0) return;
+   topocentric_args args = {nsta, n, (n + BLOCK - 1) / BLOCK, station, x, y, z, az, el, range};
+   terse_alternate_iauParallelFor(nsta * args.nblocks, nthreads, topocentric_body, &args);
+}
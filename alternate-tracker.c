@@ -0,0 +1,299 @@
+#define _POSIX_C_SOURCE 200112L
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "sofa.h"
+#include "sofam.h"
+#include "alternate-headers.h"
+
+/*
+ A tracker for one target: observed azimuth, zenith distance and parallactic angle at any time, for mount
+ control, implemented in C99 with POSIX threads.
+
+ Calling iauAtco13 20-100 times a second, for a target that moves smoothly, recomputes the same expensive
+ quantities over and over. Instead, the exact chain (iauApco13, iauAtciq, iauAtioq, iauHd2pa) is evaluated
+ at nodes a few seconds apart, with the rates of az, zd and the parallactic angle from the diurnal motion:
+   d(az)/dt = w (sin(phi) - cos(phi) cos(az) cot(zd))
+   d(zd)/dt = -w cos(phi) sin(az)                       (less the change of refraction with zd)
+   pa = atan2(-sin(az) cos(phi), sin(phi) sin(zd) - cos(phi) cos(zd) cos(az))   (differentiated by the chain rule)
+ where w is the rate of the Earth's rotation and phi the latitude. The rates of az and zd are those of the
+ unrefracted place, with the zd rate scaled by the slope of the refraction; the rate of pa follows from those,
+ as the parallactic angle of the observed (refracted) place. Between the nodes, the values are
+ interpolated by cubic Hermite polynomials: a few arithmetic operations per call.
+
+ Each interval is checked by also evaluating the exact chain at a quarter, half and three quarters of the
+ way through it: the error of the Hermite polynomial itself is largest at the midpoint, and any error in the
+ rates shows most near the quarters (it cancels at the midpoint). The estimated error, at a fraction s of the
+ way through the interval, is the largest of those differences times min(1, 8 s (1-s)). Beyond the interval,
+ when extrapolating, the remainder of the Hermite polynomial, f''''(x) s^2 (s-1)^2 h^4 / 24, still holds, and
+ that largest difference e estimates it at the midpoint; so there the estimate is e (8 d + 32 s^2 (s-1)^2), for
+ d intervals beyond the nearer node: twice the remainder, and a term for the error in the rates, which grows
+ linearly. It never decreases with the distance.
+
+ A background thread computes the nodes ahead of the latest time asked for, so the control thread never
+ waits for iauAtco13. The control thread never blocks either: it keeps its own copy of the current interval,
+ and takes the next one from the background thread's ring of nodes with pthread_mutex_trylock. If the lock
+ is busy, or the background thread has fallen behind, it extrapolates from the interval it has, and says so.
+
+ Near the zenith the azimuth changes too fast to interpolate well (as for any alt-az mount); the error
+ estimate shows it. Intervals containing a leap second aren't interpolated accurately.
+*/
+
+/* The number of nodes kept in the ring, and the number computed ahead of the latest time asked for. */
+enum { RING = 16, LOOKAHEAD = 4 };
+
+/* The rate of the Earth's rotation (radians per second of UT1). */
+static const double EARTH_RATE = D2PI * 1.00273781191135448 / DAYSEC;
+
+/* One node: the time (s from the start), az, zd and pa, their rates (per s), and the interval's error. */
+typedef struct {
+  double t;
+  double value[3];
+  double rate[3];
+  double err;      //the largest error at the checks of the interval from this node to the next
+} track_node;
+
+struct terse_alternate_iauTRACKER {
+  terse_alternate_iauTRACKTARGET target;
+  double utc1, utc2;        //the start
+  double step;              //between nodes (s)
+
+  //shared with the background thread: only under the lock
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+  pthread_t thread;
+  int running;
+  track_node ring[RING];
+  long long count;          //the number of nodes computed; node k is in ring[k % RING]
+  double latest;            //the latest time asked for (s from the start)
+  int status;               //the worst status from iauApco13
+
+  //the control thread's own: its copy of the current interval, and of the status
+  track_node current[2];
+  int known_status;
+};
+
+/* The exact az, zd and pa, and their rates, at t seconds from the start. Returns the status of iauApco13. */
+static int evaluate(const terse_alternate_iauTRACKER *tracker, double t, track_node *node) {
+  const terse_alternate_iauTRACKTARGET *g = &tracker->target;
+  iauASTROM astrom;
+  double eo, ri, di, az, zd, ha, dec, ra;
+  int j = iauApco13(tracker->utc1, tracker->utc2 + t / DAYSEC, g->dut1, g->elong, g->phi, g->hm, g->xp, g->yp,
+      g->phpa, g->tc, g->rh, g->wl, &astrom, &eo);
+  if (j < 0) return j;
+  iauAtciq(g->rc, g->dc, g->pr, g->pd, g->px, g->rv, &astrom, &ri, &di);
+  iauAtioq(ri, di, &astrom, &az, &zd, &ha, &dec, &ra);
+
+  //the diurnal motion is that of the unrefracted zd; iauAtioq refracts it by R/(1+R'), with R = A tan(z) + B tan^3(z)
+  double tz = tan(zd);
+  double zd_topo = zd + (astrom.refa + astrom.refb * tz * tz) * tz;
+  double tt = tan(zd_topo), sec2 = 1.0 + tt * tt;
+  double r0 = (astrom.refa + astrom.refb * tt * tt) * tt;
+  double r1 = (astrom.refa + 3.0 * astrom.refb * tt * tt) * sec2;
+  double r2 = 2.0 * tt * sec2 * (astrom.refa + 3.0 * astrom.refb * (sec2 + tt * tt));
+  double refraction_slope = (r1 * (1.0 + r1) - r0 * r2) / ((1.0 + r1) * (1.0 + r1));
+  //az and zd are about the CIP, from the latitude with polar motion (astrom); pa is iauHd2pa's, from phi
+  double sphi = astrom.sphi, cphi = astrom.cphi, saz = sin(az), caz = cos(az);
+  node->t = t;
+  node->value[0] = az;
+  node->value[1] = zd;
+  node->value[2] = iauHd2pa(ha, dec, g->phi);
+  double daz = EARTH_RATE * (sphi - cphi * caz * cos(zd_topo) / sin(zd_topo));
+  double dzd = -EARTH_RATE * cphi * saz * (1.0 - refraction_slope);
+  double sp = sin(g->phi), cp = cos(g->phi);
+  double qs = -saz * cp, qc = sp * sin(zd) - cp * cos(zd) * caz;
+  double dqs = -caz * cp * daz, dqc = (sp * cos(zd) + cp * sin(zd) * caz) * dzd + cp * cos(zd) * saz * daz;
+  node->rate[0] = daz;
+  node->rate[1] = dzd;
+  node->rate[2] = (qc * dqs - qs * dqc) / (qs * qs + qc * qc);
+  node->err = 0.0;
+  return j;
+}
+
+/* Hermite interpolation (or extrapolation) between two nodes, at time t. */
+static void interpolate(const track_node n[2], double t, double value[3]) {
+  double h = n[1].t - n[0].t;
+  double s = (t - n[0].t) / h;
+  double h00 = (1.0 + 2.0 * s) * (1.0 - s) * (1.0 - s);
+  double h10 = s * (1.0 - s) * (1.0 - s);
+  double h01 = s * s * (3.0 - 2.0 * s);
+  double h11 = s * s * (s - 1.0);
+  for (int k = 0; k < 3; ++k) {
+    //az and pa are angles: take the end value within pi of the start
+    double end = n[0].value[k] + ((k == 1) ? n[1].value[k] - n[0].value[k] : iauAnpm(n[1].value[k] - n[0].value[k]));
+    value[k] = h00 * n[0].value[k] + h10 * h * n[0].rate[k] + h01 * end + h11 * h * n[1].rate[k];
+  }
+  value[0] = iauAnp(value[0]);
+  value[2] = iauAnpm(value[2]);
+}
+
+/* The difference between two sets of az, zd, pa: the larger of the distance on the sky and that in pa. */
+static double difference(const double a[3], const double b[3]) {
+  double on_sky = sqrt(pow(iauAnpm(a[0] - b[0]) * sin(b[1]), 2) + pow(a[1] - b[1], 2));
+  return fmax(on_sky, fabs(iauAnpm(a[2] - b[2])));
+}
+
+/* Compute node k, and the error of the interval before it. Returns the status of iauApco13. */
+static int compute_node(const terse_alternate_iauTRACKER *tracker, const track_node *previous, long long k, track_node *node) {
+  int j = evaluate(tracker, k * tracker->step, node);
+  if (j >= 0 && previous != NULL) {
+    track_node pair[2] = {*previous, *node}, check;
+    node->err = 0.0; //kept with the node until it's published
+    for (int q = 1; q <= 3; ++q) {
+      int jc = evaluate(tracker, (k - 1 + 0.25 * q) * tracker->step, &check);
+      if (jc < 0) return jc;
+      double value[3];
+      interpolate(pair, check.t, value);
+      node->err = fmax(node->err, difference(value, check.value));
+    }
+  }
+  return j;
+}
+
+/* Publish node k, with the error of the interval before it. Called with the lock held. */
+static void publish(terse_alternate_iauTRACKER *tracker, long long k, const track_node *node) {
+  track_node published = *node;
+  published.err = 0.0;
+  if (k > 0) tracker->ring[(k - 1) % RING].err = node->err;
+  tracker->ring[k % RING] = published;
+  tracker->count = k + 1;
+}
+
+static void *background(void *arg) {
+  terse_alternate_iauTRACKER *tracker = arg;
+  pthread_mutex_lock(&tracker->lock);
+  track_node last = tracker->ring[(tracker->count - 1) % RING];
+  while (tracker->running) {
+    long long k = tracker->count;
+    if (tracker->ring[(k - 1) % RING].t < tracker->latest + LOOKAHEAD * tracker->step) {
+      //compute without the lock, so the control thread can take it
+      pthread_mutex_unlock(&tracker->lock);
+      track_node node;
+      int j = compute_node(tracker, &last, k, &node);
+      pthread_mutex_lock(&tracker->lock);
+      if (j < 0) {
+        tracker->status = j;
+        break;
+      }
+      if (j > tracker->status) tracker->status = j;
+      publish(tracker, k, &node);
+      last = node;
+    } else {
+      struct timespec until;
+      clock_gettime(CLOCK_REALTIME, &until);
+      until.tv_sec += 1;
+      pthread_cond_timedwait(&tracker->wake, &tracker->lock, &until);
+    }
+  }
+  pthread_mutex_unlock(&tracker->lock);
+  return NULL;
+}
+
+/*
+ Start tracking a target from the UTC utc1+utc2, with nodes step seconds apart (0 for 5 s).
+ The first nodes are computed before this returns. Returns 0 (or +1 for a dubious year, as iauAtco13),
+ -1 for an unacceptable date or bad arguments, -2 if the background thread can't be started.
+*/
+int terse_alternate_iauTrackerStart(const terse_alternate_iauTRACKTARGET *target, double utc1, double utc2, double step, terse_alternate_iauTRACKER **tracker) {
+  *tracker = NULL;
+  if (step < 0.0) return -1;
+  terse_alternate_iauTRACKER *t = calloc(1, sizeof *t);
+  if (t == NULL) return -2;
+  t->target = *target;
+  t->utc1 = utc1;
+  t->utc2 = utc2;
+  t->step = (step == 0.0) ? 5.0 : step;
+
+  //the first interval, and the nodes ahead of it
+  track_node node, previous;
+  for (long long k = 0; k <= LOOKAHEAD; ++k) {
+    int j = compute_node(t, (k == 0) ? NULL : &previous, k, &node);
+    if (j < 0) {
+      free(t);
+      return -1;
+    }
+    if (j > t->status) t->status = j;
+    publish(t, k, &node);
+    previous = node;
+  }
+  t->current[0] = t->ring[0];
+  t->current[1] = t->ring[1];
+  t->known_status = t->status;
+
+  t->running = 1;
+  if (pthread_mutex_init(&t->lock, NULL) != 0) {
+    free(t);
+    return -2;
+  }
+  if (pthread_cond_init(&t->wake, NULL) != 0) {
+    pthread_mutex_destroy(&t->lock);
+    free(t);
+    return -2;
+  }
+  if (pthread_create(&t->thread, NULL, background, t) != 0) {
+    pthread_cond_destroy(&t->wake);
+    pthread_mutex_destroy(&t->lock);
+    free(t);
+    return -2;
+  }
+  *tracker = t;
+  return t->status;
+}
+
+/* Take the interval for time t from the ring, if the lock is free. */
+static void refresh_interval(terse_alternate_iauTRACKER *tracker, double t) {
+  if (pthread_mutex_trylock(&tracker->lock) != 0) return;
+  if (t > tracker->latest) {
+    tracker->latest = t;
+    pthread_cond_signal(&tracker->wake);
+  }
+  long long first = (tracker->count > RING) ? tracker->count - RING : 0;
+  long long k = (long long)floor(t / tracker->step);
+  if (k < first) k = first;
+  if (k > tracker->count - 2) k = tracker->count - 2;
+  tracker->current[0] = tracker->ring[k % RING];
+  tracker->current[1] = tracker->ring[(k + 1) % RING];
+  tracker->known_status = tracker->status;
+  pthread_mutex_unlock(&tracker->lock);
+}
+
+/*
+ The observed azimuth, zenith distance (as from iauAtco13) and parallactic angle (as from iauHd2pa), all in
+ radians, at the UTC utc1+utc2, with an estimate of their error (radians; the larger of that on the sky and
+ that in the parallactic angle). Never blocks.
+ Returns 0 for interpolated values, +1 for values extrapolated because the nodes weren't ready (or the
+ time is before the nodes kept), -1 if the background thread stopped for an unacceptable date.
+*/
+int terse_alternate_iauTrackerGet(terse_alternate_iauTRACKER *tracker, double utc1, double utc2, double *az, double *zd, double *pa, double *err) {
+  double t = ((utc1 - tracker->utc1) + (utc2 - tracker->utc2)) * DAYSEC;
+  int status = 0;
+  if (t < tracker->current[0].t || t > tracker->current[1].t) {
+    refresh_interval(tracker, t);
+    if (tracker->known_status < 0) return -1;
+    status = (t < tracker->current[0].t || t > tracker->current[1].t);
+  }
+  double value[3];
+  interpolate(tracker->current, t, value);
+  *az = value[0];
+  *zd = value[1];
+  *pa = value[2];
+  double s = (t - tracker->current[0].t) / (tracker->current[1].t - tracker->current[0].t);
+  double within = fmin(fmax(s, 0.0), 1.0), beyond = fabs(s - within);
+  double extrapolation = (beyond > 0.0) ? 8.0 * beyond + 32.0 * s * s * (s - 1.0) * (s - 1.0) : 0.0;
+  *err = tracker->current[0].err * (fmin(1.0, 8.0 * within * (1.0 - within)) + extrapolation);
+  return status;
+}
+
+/* Stop the background thread, and free the tracker. */
+void terse_alternate_iauTrackerStop(terse_alternate_iauTRACKER *tracker) {
+  if (tracker == NULL) return;
+  pthread_mutex_lock(&tracker->lock);
+  tracker->running = 0;
+  pthread_cond_signal(&tracker->wake);
+  pthread_mutex_unlock(&tracker->lock);
+  pthread_join(tracker->thread, NULL);
+  pthread_cond_destroy(&tracker->wake);
+  pthread_mutex_destroy(&tracker->lock);
+  free(tracker);
+}